@@ -39,6 +39,7 @@ DO_TEST=0
 DO_PYTHON=0
 DO_CPP=0
 DO_SETUP_PYTHON=0
+DO_BENCH=0
 VERBOSE=0
 
 # ===========================================================================
@@ -62,6 +63,15 @@ print_error()   { echo -e "${RED}✗ $1${NC}"; }
 print_info()    { echo -e "${YELLOW}→ $1${NC}"; }
 print_warning() { echo -e "${CYAN}⚠ $1${NC}"; }
 
+# Run a Python script with the project's interpreter (Poetry if available)
+run_python() {
+    if command -v poetry &> /dev/null && [[ -f "pyproject.toml" ]]; then
+        poetry run python "$@"
+    else
+        python3 "$@"
+    fi
+}
+
 # ===========================================================================
 # Usage Information
 # ===========================================================================
@@ -80,6 +90,8 @@ OPTIONS:
     --python             Build and run Python example
     --cpp                Build and run C++ main
     --setup-python       Setup Python environment (install deps, copy .so)
+    --bench              Run //lib/bench:calculator_bench (always optimized)
+                         and save JSON to build/bench/calculator_bench_<commit>.json
 
   Compiler Selection:
     --compiler=gcc       Use GCC compiler
@@ -102,6 +114,8 @@ CMAKE-LIKE OUTPUT:
 
 CFFI:
   - --build now also copies the shared lib into python/ automatically.
+  - --build also compiles the API-mode extension (calculator._calculator);
+    the bindings fall back to ABI mode (dlopen) when it is missing.
 EOF
 }
 
@@ -158,6 +172,7 @@ for arg in "$@"; do
         --python)       DO_PYTHON=1 ;;
         --cpp)          DO_CPP=1 ;;
         --setup-python) DO_SETUP_PYTHON=1 ;;
+        --bench)        DO_BENCH=1 ;;
         --compiler=gcc)   COMPILER="gcc" ;;
         --compiler=clang) COMPILER="clang" ;;
         --debug)       BUILD_MODE="debug" ;;
@@ -237,7 +252,7 @@ if [[ $DO_CLEAN -eq 1 ]]; then
 
     print_info "Cleaning Python artifacts..."
     rm -rf python/__pycache__ python/.pytest_cache .pytest_cache htmlcov .coverage
-    rm -f python/*.so python/*.dylib
+    rm -f python/*.so python/*.dylib python/calculator/_calculator*.so python/calculator/_calculator*.pyd
 
     print_success "Clean complete"
     echo ""
@@ -272,6 +287,14 @@ if [[ $DO_BUILD -eq 1 ]]; then
     fi
     echo ""
 
+    print_info "Building CFFI API-mode extension (python/calculator/_calculator)"
+    if run_python python/calculator/_calculator_build.py --build-dir "${BUILD_DIR}/cffi"; then
+        print_success "API-mode extension built"
+    else
+        print_warning "API-mode extension build failed - bindings will use ABI mode"
+    fi
+    echo ""
+
     print_info "Building all targets: bazel build //..."
     bazel $BAZEL_STARTUP_FLAGS build //... $BAZEL_FLAGS
     print_success "Build complete"
@@ -321,7 +344,7 @@ if [[ $DO_TEST -eq 1 ]]; then
     print_header "Running Tests"
 
     print_info "Running C++ tests..."
-    bazel $BAZEL_STARTUP_FLAGS test //lib/test:Calculator_Test $BAZEL_FLAGS
+    bazel $BAZEL_STARTUP_FLAGS test //lib/test/... $BAZEL_FLAGS
     print_success "C++ tests passed"
     echo ""
 
@@ -395,6 +418,31 @@ if [[ $DO_CPP -eq 1 ]]; then
     echo ""
 fi
 
+# ===========================================================================
+# Run Benchmarks
+# ===========================================================================
+# Always built with --config=release: debug timings are meaningless. Results
+# are keyed by commit so two runs can be diffed with Google Benchmark's
+# tools/compare.py.
+if [[ $DO_BENCH -eq 1 ]]; then
+    print_header "Running Benchmarks"
+
+    BENCH_DIR="${BUILD_DIR}/bench"
+    mkdir -p "$BENCH_DIR"
+    BENCH_REV="$(git rev-parse --short HEAD 2>/dev/null || echo local)"
+    if ! git diff --quiet HEAD 2>/dev/null; then
+        BENCH_REV="${BENCH_REV}-dirty"
+    fi
+    BENCH_JSON="$(pwd)/${BENCH_DIR}/calculator_bench_${BENCH_REV}.json"
+
+    BENCH_FLAGS="--config=$COMPILER --config=release --symlink_prefix=$SYMLINK_PREFIX"
+    print_info "Running: bazel run //lib/bench:calculator_bench"
+    bazel $BAZEL_STARTUP_FLAGS run //lib/bench:calculator_bench $BENCH_FLAGS -- \
+        --benchmark_out="$BENCH_JSON" --benchmark_out_format=json
+    print_success "Benchmark results: $BENCH_JSON"
+    echo ""
+fi
+
 # ===========================================================================
 # Summary
 # ===========================================================================
@@ -0,0 +1,802 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "../include/BondPricing.hpp"
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/DatedPresentValue.hpp"
+#include "../include/EarTable.hpp"
+#include "../include/ErrorPolicies.hpp"
+#include "../include/InternalRateOfReturn.hpp"
+#include "../include/SimdKernels.hpp"
+#include "../include/ParallelPresentValuePolicy.hpp"
+#include "../include/MatrixPresentValue.hpp"
+#include "../include/PresentValueSensitivities.hpp"
+#include "../include/RunLengthPresentValue.hpp"
+#include "../include/YieldCurve.hpp"
+#include "../include/calculator_c_api.h"
+
+// ===========================================================================
+// Calculator benchmark suite
+// ===========================================================================
+// Three groups, named so runs can be filtered and diffed:
+//   Policy/...   each policy called directly, over a range of input sizes
+//   Wrapper/...  the same call through Calculator<Policy> (should match the
+//                direct call: the wrapper is expected to inline away)
+//   Batch/...    structure-of-arrays FV: scalar loop vs. vectorized kernel
+//   Matrix/...   4096 streams × 360 periods against 1..64 curves: one dot
+//                product per (stream, curve) vs. the blocked GEMM kernel
+//   Curve/...    360 monthly dated flows on a 20-pillar curve, per
+//                interpolation: CurvePresentValuePolicy (segment hint carried
+//                between flows) vs. a fresh segment search per flow
+//   Xnpv/...     360 monthly dated flows: XnpvPolicy per day count vs. a
+//                std::pow per flow with a full 30/360 date conversion
+//   Irr/...      IRR of a 360-period loan: the native solver from the
+//                default guess and from a nearby one vs. bisection on PV
+//                (what a root finder calling the PV entry point does)
+//   Runs/...     a level 30-year monthly annuity (360 equal payments):
+//                PresentValuePolicy (detects the single run), the per-period
+//                std::pow loop it replaces, the SIMD kernel, and the
+//                pre-encoded RunLengthPresentValuePolicy (O(runs))
+//   Bond/...     prices of 1024 bonds (2..360 coupons) from their terms
+//                in closed form vs. building each schedule and running the
+//                SIMD PV kernel over it; yields to maturity of the same book
+//   Risk/...     PV, dPV/dr and d²PV/dr² of one stream: the fused one-pass
+//                PresentValueSensitivityPolicy vs. three SIMD PVs at the
+//                rate and ±1bp (central differences)
+//   Errors/...   an FV book with every 20th position invalid: per-position
+//                try/catch around the throwing Calculator vs. the
+//                Calculator<FutureValuePolicy, StatusErrorPolicy> Expected path
+//   Ear/...      normalizing a feed of quotes (0.01bp grid) at one frequency:
+//                InterestRateConversionPolicy per quote vs. the EarTable
+//                lookup kernel, serial and over the thread pool
+//   CApi/...     pv_/fv_/ir_calculator_calculate through the C entry points;
+//                pv_calculator_calculate_ex from 1..64 threads on one handle
+//
+// Sizes are cash flows (PV) or periods (FV / IR); items/s counts them.
+//
+//   ./build.sh --bench   (writes build/bench/calculator_bench_<commit>.json)
+//   bazel run --config=gcc --config=release //lib/bench:calculator_bench --
+//       --benchmark_out=out.json --benchmark_out_format=json
+//
+// Rates are passed through DoNotOptimize every iteration so loop-invariant
+// calls cannot be hoisted out of the timing loop.
+// ===========================================================================
+
+namespace {
+
+constexpr double kRate = 0.05 / 12.0;
+constexpr double kPrincipal = 10000.0;
+
+std::vector<double> make_stream(std::size_t n) {
+    std::vector<double> cf(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        cf[i] = 100.0 + static_cast<double>(i % 17);
+    }
+    return cf;
+}
+
+// ===========================================================================
+// Direct Policy Calls
+// ===========================================================================
+
+template <typename Policy>
+void BM_PolicyPresentValue(benchmark::State& state) {
+    const std::vector<double> cash_flows = make_stream(static_cast<std::size_t>(state.range(0)));
+    double rate = kRate;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        benchmark::DoNotOptimize(Policy::calculate(rate, cash_flows));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PolicyFutureValue(benchmark::State& state) {
+    const int periods = static_cast<int>(state.range(0));
+    double rate = kRate;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        benchmark::DoNotOptimize(FutureValuePolicy::calculate(kPrincipal, rate, periods));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_PolicyInterestRate(benchmark::State& state) {
+    const int periods = static_cast<int>(state.range(0));
+    double rate = 0.12;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        benchmark::DoNotOptimize(InterestRateConversionPolicy::calculate(rate, periods));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Deposit book revaluation: one FV per position, monthly periods up to 30y
+struct FvBook {
+    std::vector<double> principals, rates, results;
+    std::vector<int> periods;
+
+    explicit FvBook(std::size_t n) : principals(n), rates(n), results(n), periods(n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            principals[i] = 1000.0 + static_cast<double>(i % 997);
+            rates[i] = 0.0001 * static_cast<double>(i % 83);
+            periods[i] = static_cast<int>(1 + i % 360);
+        }
+    }
+};
+
+void BM_BatchFutureValueLoop(benchmark::State& state) {
+    FvBook book(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < book.results.size(); ++i) {
+            book.results[i] = FutureValuePolicy::calculate(book.principals[i], book.rates[i], book.periods[i]);
+        }
+        benchmark::DoNotOptimize(book.results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_BatchFutureValueSimd(benchmark::State& state) {
+    FvBook book(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        SimdFutureValuePolicy::calculate_batch(book.principals, book.rates, book.periods, book.results);
+        benchmark::DoNotOptimize(book.results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Book of 4096 monthly streams over 30y, priced against n curves
+struct PvBook {
+    static constexpr std::size_t kStreams = 4096;
+    static constexpr std::size_t kPeriods = 360;
+    std::vector<double> cash_flows, curves, results;
+    std::size_t n_curves;
+
+    explicit PvBook(std::size_t n) : cash_flows(kStreams * kPeriods), curves(n * kPeriods),
+                                     results(kStreams * n), n_curves(n) {
+        for (std::size_t i = 0; i < cash_flows.size(); ++i) {
+            cash_flows[i] = 100.0 + static_cast<double>(i % 17);
+        }
+        for (std::size_t c = 0; c < n; ++c) {
+            const std::vector<double> df =
+                MatrixPresentValuePolicy::discount_factors(0.0001 * static_cast<double>(c + 1), kPeriods);
+            std::copy(df.begin(), df.end(), curves.begin() + static_cast<long>(c * kPeriods));
+        }
+    }
+};
+
+void BM_MatrixRowByRow(benchmark::State& state) {
+    PvBook book(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (std::size_t s = 0; s < PvBook::kStreams; ++s) {
+            for (std::size_t c = 0; c < book.n_curves; ++c) {
+                book.results[s * book.n_curves + c] = simd::dot(
+                    book.cash_flows.data() + s * PvBook::kPeriods, book.curves.data() + c * PvBook::kPeriods,
+                    PvBook::kPeriods);
+            }
+        }
+        benchmark::DoNotOptimize(book.results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(book.results.size()));
+}
+
+void BM_MatrixGemm(benchmark::State& state) {
+    PvBook book(static_cast<std::size_t>(state.range(0)));
+    const ConstMatrixView cf{book.cash_flows.data(), PvBook::kStreams, PvBook::kPeriods, PvBook::kPeriods};
+    const ConstMatrixView df{book.curves.data(), book.n_curves, PvBook::kPeriods, PvBook::kPeriods};
+    for (auto _ : state) {
+        MatrixPresentValuePolicy::calculate_matrix(cf, df, book.results);
+        benchmark::DoNotOptimize(book.results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(book.results.size()));
+}
+
+// ===========================================================================
+// Yield Curve PV
+// ===========================================================================
+
+struct CurveBook {
+    static constexpr std::size_t kPillars = 20;
+    static constexpr std::size_t kFlows = 360;
+    YieldCurve curve;
+    std::vector<double> times, cash_flows;
+
+    static YieldCurve make_curve(CurveInterpolation interpolation) {
+        std::vector<double> pillar_times(kPillars), rates(kPillars);
+        for (std::size_t i = 0; i < kPillars; ++i) {
+            pillar_times[i] = 0.25 * static_cast<double>((i + 1) * (i + 2));
+            rates[i] = 0.03 + 0.001 * static_cast<double>(i % 7);
+        }
+        return YieldCurve(pillar_times, rates, CurveQuote::ZeroRate, interpolation);
+    }
+
+    explicit CurveBook(long interpolation)
+        : curve(make_curve(static_cast<CurveInterpolation>(interpolation))), times(kFlows),
+          cash_flows(make_stream(kFlows)) {
+        for (std::size_t i = 0; i < kFlows; ++i) {
+            times[i] = static_cast<double>(i + 1) / 12.0;
+        }
+    }
+};
+
+void BM_CurveHinted(benchmark::State& state) {
+    const CurveBook book(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(CurvePresentValuePolicy::calculate(book.curve, book.times, book.cash_flows));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(CurveBook::kFlows));
+}
+
+void BM_CurvePerFlowSearch(benchmark::State& state) {
+    const CurveBook book(state.range(0));
+    for (auto _ : state) {
+        double pv = 0.0;
+        for (std::size_t i = 0; i < CurveBook::kFlows; ++i) {
+            pv += book.cash_flows[i] * book.curve.discount_factor(book.times[i]);
+        }
+        benchmark::DoNotOptimize(pv);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(CurveBook::kFlows));
+}
+
+// ===========================================================================
+// Dated PV (XNPV)
+// ===========================================================================
+
+struct DatedStream {
+    static constexpr std::size_t kFlows = 360;
+    std::vector<std::int64_t> dates;
+    std::vector<double> cash_flows = make_stream(kFlows);
+
+    DatedStream() : dates(kFlows) {
+        for (std::size_t i = 0; i < kFlows; ++i) {
+            const auto m = static_cast<std::int64_t>(i);
+            dates[i] = days_from_civil(2025 + m / 12, m % 12 + 1, 15 + m % 3);
+        }
+    }
+};
+
+template <typename DayCount>
+void BM_Xnpv(benchmark::State& state) {
+    const DatedStream stream;
+    double rate = 0.05;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        benchmark::DoNotOptimize(XnpvPolicy<DayCount>::calculate(rate, stream.dates, stream.cash_flows));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(DatedStream::kFlows));
+}
+
+void BM_XnpvPowPerFlow(benchmark::State& state) {
+    const DatedStream stream;
+    double rate = 0.05;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        const CivilDate start = civil_from_days(stream.dates[0]);
+        double pv = 0.0;
+        for (std::size_t i = 0; i < DatedStream::kFlows; ++i) {
+            const CivilDate date = civil_from_days(stream.dates[i]);
+            const std::int64_t days = 360 * (date.year - start.year) + 30 * (date.month - start.month)
+                                    + (date.day - start.day);
+            pv += stream.cash_flows[i] / std::pow(1.0 + rate, static_cast<double>(days) / 360.0);
+        }
+        benchmark::DoNotOptimize(pv);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(DatedStream::kFlows));
+}
+
+// ===========================================================================
+// Internal Rate of Return
+// ===========================================================================
+
+std::vector<double> make_loan(std::size_t n) {
+    const double rate = 0.0041;
+    std::vector<double> cf(n + 1, 250000.0 * rate / (1.0 - std::pow(1.0 + rate, -static_cast<double>(n))));
+    cf[0] = -250000.0;
+    return cf;
+}
+
+void BM_IrrSolve(benchmark::State& state) {
+    const std::vector<double> cf = make_loan(360);
+    double guess = state.range(0) == 0 ? InternalRateOfReturnPolicy::kDefaultGuess : 0.004;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(guess);
+        benchmark::DoNotOptimize(InternalRateOfReturnPolicy::solve(cf.data(), cf.size(), guess).rate);
+    }
+}
+
+void BM_IrrPvBisection(benchmark::State& state) {
+    const std::vector<double> cf = make_loan(360);
+    for (auto _ : state) {
+        double lo = -0.5;
+        double hi = 1.0;
+        while (hi - lo > 1e-12) {
+            const double mid = 0.5 * (lo + hi);
+            (simd::present_value(1.0 + mid, cf.data(), cf.size()) < 0.0 ? hi : lo) = mid;
+        }
+        benchmark::DoNotOptimize(lo);
+    }
+}
+
+// ===========================================================================
+// Run-Length PV
+// ===========================================================================
+
+void BM_RunsDetected(benchmark::State& state) {
+    const std::vector<double> annuity(360, 1342.05);
+    double rate = kRate;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        benchmark::DoNotOptimize(PresentValuePolicy::calculate(rate, annuity));
+    }
+    state.SetItemsProcessed(state.iterations() * 360);
+}
+
+void BM_RunsPerPeriodPow(benchmark::State& state) {
+    const std::vector<double> annuity(360, 1342.05);
+    double rate = kRate;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        double pv = 0.0;
+        for (std::size_t i = 0; i < annuity.size(); ++i) {
+            pv += annuity[i] / std::pow(1.0 + rate, static_cast<double>(i) + 1.0);
+        }
+        benchmark::DoNotOptimize(pv);
+    }
+    state.SetItemsProcessed(state.iterations() * 360);
+}
+
+void BM_RunsSimd(benchmark::State& state) {
+    const std::vector<double> annuity(360, 1342.05);
+    double rate = kRate;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        benchmark::DoNotOptimize(SimdPresentValuePolicy::calculate(rate, annuity));
+    }
+    state.SetItemsProcessed(state.iterations() * 360);
+}
+
+void BM_RunsEncoded(benchmark::State& state) {
+    const std::vector<CashFlowRun> annuity = {{1342.05, 360}};
+    double rate = kRate;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        benchmark::DoNotOptimize(RunLengthPresentValuePolicy::calculate(rate, annuity));
+    }
+    state.SetItemsProcessed(state.iterations() * 360);
+}
+
+// ===========================================================================
+// Bonds
+// ===========================================================================
+
+std::vector<BondTerms> make_bond_book() {
+    std::vector<BondTerms> book(1024);
+    for (std::size_t i = 0; i < book.size(); ++i) {
+        const int frequency = i % 3 == 0 ? 12 : 2;
+        book[i] = BondTerms{100.0, 0.02 + 0.0005 * static_cast<double>(i % 80),
+                            2 + static_cast<int>(i * 7 % 359), frequency};
+    }
+    return book;
+}
+
+void BM_BondPriceClosedForm(benchmark::State& state) {
+    const std::vector<BondTerms> book = make_bond_book();
+    double yield = 0.045;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(yield);
+        for (const BondTerms& bond : book) {
+            benchmark::DoNotOptimize(BondPricingPolicy::calculate(bond, yield));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(book.size()));
+}
+
+void BM_BondPriceSchedule(benchmark::State& state) {
+    const std::vector<BondTerms> book = make_bond_book();
+    std::vector<double> schedule;
+    double yield = 0.045;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(yield);
+        for (const BondTerms& bond : book) {
+            const std::size_t n = static_cast<std::size_t>(bond.periods);
+            schedule.assign(n, bond.face * bond.coupon_rate / bond.frequency);
+            schedule[n - 1] += bond.face;
+            benchmark::DoNotOptimize(SimdPresentValuePolicy::calculate(yield / bond.frequency, schedule));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(book.size()));
+}
+
+void BM_BondYieldToMaturity(benchmark::State& state) {
+    const std::vector<BondTerms> book = make_bond_book();
+    std::vector<double> prices(book.size());
+    for (std::size_t i = 0; i < book.size(); ++i) {
+        prices[i] = BondPricingPolicy::calculate(book[i], 0.01 + 0.0001 * static_cast<double>(i % 500));
+    }
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < book.size(); ++i) {
+            benchmark::DoNotOptimize(BondPricingPolicy::yield_to_maturity(book[i], prices[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(book.size()));
+}
+
+// ===========================================================================
+// Rate Sensitivities
+// ===========================================================================
+
+void BM_RiskFused(benchmark::State& state) {
+    const std::vector<double> cash_flows = make_stream(static_cast<std::size_t>(state.range(0)));
+    double rate = kRate;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        benchmark::DoNotOptimize(PresentValueSensitivityPolicy::calculate(rate, cash_flows));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_RiskBumped(benchmark::State& state) {
+    const std::vector<double> cash_flows = make_stream(static_cast<std::size_t>(state.range(0)));
+    constexpr double h = 1e-4;
+    double rate = kRate;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        const double pv = SimdPresentValuePolicy::calculate(rate, cash_flows);
+        const double up = SimdPresentValuePolicy::calculate(rate + h, cash_flows);
+        const double down = SimdPresentValuePolicy::calculate(rate - h, cash_flows);
+        benchmark::DoNotOptimize((up - down) / (2.0 * h));
+        benchmark::DoNotOptimize((up - 2.0 * pv + down) / (h * h));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// ===========================================================================
+// Error Handling
+// ===========================================================================
+
+// Every 20th position carries negative periods (a bad feed row)
+FvBook make_dirty_book(std::size_t n) {
+    FvBook book(n);
+    for (std::size_t i = 0; i < n; i += 20) {
+        book.periods[i] = -1;
+    }
+    return book;
+}
+
+void BM_ErrorsThrowing(benchmark::State& state) {
+    FvBook book = make_dirty_book(static_cast<std::size_t>(state.range(0)));
+    Calculator<FutureValuePolicy> calc;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < book.results.size(); ++i) {
+            try {
+                book.results[i] = calc.calculate(book.principals[i], book.rates[i], book.periods[i]);
+            } catch (const std::invalid_argument&) {
+                book.results[i] = 0.0;
+            }
+        }
+        benchmark::DoNotOptimize(book.results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ErrorsStatus(benchmark::State& state) {
+    FvBook book = make_dirty_book(static_cast<std::size_t>(state.range(0)));
+    Calculator<FutureValuePolicy, StatusErrorPolicy> calc;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < book.results.size(); ++i) {
+            book.results[i] = calc.calculate(book.principals[i], book.rates[i], book.periods[i]).value_or(0.0);
+        }
+        benchmark::DoNotOptimize(book.results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// ===========================================================================
+// Tabulated EAR
+// ===========================================================================
+
+// Quotes on the 0.01bp grid within 2% of 4%, every 8th between grid points
+std::vector<double> make_quote_feed(std::size_t n) {
+    std::vector<double> quotes(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double offset = (i % 8 == 7) ? 0.37 : 0.0;
+        quotes[i] = (20000.0 + static_cast<double>((i * 7919) % 40000) + offset) / 1e6;
+    }
+    return quotes;
+}
+
+void BM_EarExact(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const std::vector<double> quotes = make_quote_feed(static_cast<std::size_t>(state.range(1)));
+    std::vector<double> ears(quotes.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < quotes.size(); ++i) {
+            ears[i] = InterestRateConversionPolicy::evaluate(quotes[i], n);
+        }
+        benchmark::DoNotOptimize(ears.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+void BM_EarTabulated(benchmark::State& state) {
+    const EarTable* table = EarTable::standard(static_cast<int>(state.range(0)));
+    const std::vector<double> quotes = make_quote_feed(static_cast<std::size_t>(state.range(1)));
+    std::vector<double> ears(quotes.size());
+    for (auto _ : state) {
+        table->convert(quotes.data(), quotes.size(), ears.data());
+        benchmark::DoNotOptimize(ears.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+void BM_EarTabulatedParallel(benchmark::State& state) {
+    IRCalculatorHandle calc = ir_calculator_create();
+    ir_calculator_set_tabulated(calc, 1);
+    const int n = static_cast<int>(state.range(0));
+    const std::vector<double> quotes = make_quote_feed(static_cast<std::size_t>(state.range(1)));
+    std::vector<double> ears(quotes.size());
+    for (auto _ : state) {
+        if (ir_calculator_calculate_batch_uniform_parallel(calc, quotes.data(), quotes.size(), n, ears.data(),
+                                                           0) != 0) {
+            state.SkipWithError(ir_calculator_get_error(calc));
+            break;
+        }
+        benchmark::DoNotOptimize(ears.data());
+        benchmark::ClobberMemory();
+    }
+    ir_calculator_destroy(calc);
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+// ===========================================================================
+// Calculator<> Wrapper
+// ===========================================================================
+
+template <typename Policy>
+void BM_WrapperPresentValue(benchmark::State& state) {
+    const std::vector<double> cash_flows = make_stream(static_cast<std::size_t>(state.range(0)));
+    Calculator<Policy> calc;
+    double rate = kRate;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        benchmark::DoNotOptimize(calc.calculate(rate, cash_flows));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_WrapperFutureValue(benchmark::State& state) {
+    const int periods = static_cast<int>(state.range(0));
+    Calculator<FutureValuePolicy> calc;
+    double rate = kRate;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        benchmark::DoNotOptimize(calc.calculate(kPrincipal, rate, periods));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_WrapperInterestRate(benchmark::State& state) {
+    const int periods = static_cast<int>(state.range(0));
+    Calculator<InterestRateConversionPolicy> calc;
+    double rate = 0.12;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rate);
+        benchmark::DoNotOptimize(calc.calculate(rate, periods));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// ===========================================================================
+// C API Entry Points
+// ===========================================================================
+
+void BM_CApiFutureValueBatch(benchmark::State& state) {
+    FvBook book(static_cast<std::size_t>(state.range(0)));
+    FVCalculatorHandle calc = fv_calculator_create();
+    for (auto _ : state) {
+        if (fv_calculator_calculate_batch(calc, book.principals.data(), book.rates.data(),
+                                          book.periods.data(), book.results.size(),
+                                          book.results.data()) != 0) {
+            state.SkipWithError(fv_calculator_get_error(calc));
+            break;
+        }
+        benchmark::ClobberMemory();
+    }
+    fv_calculator_destroy(calc);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CApiPresentValue(benchmark::State& state) {
+    const std::vector<double> cash_flows = make_stream(static_cast<std::size_t>(state.range(0)));
+    PVCalculatorHandle calc = pv_calculator_create();
+    double result = 0.0;
+    for (auto _ : state) {
+        if (pv_calculator_calculate(calc, kRate, cash_flows.data(), cash_flows.size(), &result) != 0) {
+            state.SkipWithError(pv_calculator_get_error(calc));
+            break;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    pv_calculator_destroy(calc);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Threads pricing through one shared handle (read-only *_ex entry point)
+void BM_CApiPresentValueShared(benchmark::State& state) {
+    static PVCalculatorHandle shared = pv_calculator_create();  // lives for the process
+    const std::vector<double> cash_flows = make_stream(360);
+    double result = 0.0;
+    for (auto _ : state) {
+        if (const int status = pv_calculator_calculate_ex(shared, kRate, cash_flows.data(), cash_flows.size(),
+                                                          &result); status != CALC_STATUS_OK) {
+            state.SkipWithError(calculator_status_message(status));
+            break;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * 360);
+}
+
+// Repeated PVs at one rate served from the discount-factor cache
+void BM_CApiPresentValueCached(benchmark::State& state) {
+    const std::vector<double> cash_flows = make_stream(static_cast<std::size_t>(state.range(0)));
+    PVCalculatorHandle calc = pv_calculator_create();
+    pv_calculator_set_cache(calc, 4);
+    double result = 0.0;
+    for (auto _ : state) {
+        if (pv_calculator_calculate(calc, kRate, cash_flows.data(), cash_flows.size(), &result) != 0) {
+            state.SkipWithError(pv_calculator_get_error(calc));
+            break;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    pv_calculator_destroy(calc);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CApiFutureValue(benchmark::State& state) {
+    const int periods = static_cast<int>(state.range(0));
+    FVCalculatorHandle calc = fv_calculator_create();
+    double result = 0.0;
+    for (auto _ : state) {
+        if (fv_calculator_calculate(calc, kPrincipal, kRate, periods, &result) != 0) {
+            state.SkipWithError(fv_calculator_get_error(calc));
+            break;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    fv_calculator_destroy(calc);
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_CApiInterestRate(benchmark::State& state) {
+    const int periods = static_cast<int>(state.range(0));
+    IRCalculatorHandle calc = ir_calculator_create();
+    double result = 0.0;
+    for (auto _ : state) {
+        if (ir_calculator_calculate(calc, 0.12, periods, &result) != 0) {
+            state.SkipWithError(ir_calculator_get_error(calc));
+            break;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    ir_calculator_destroy(calc);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// PV sizes: single bond up to long amortization schedules
+void pv_sizes(benchmark::internal::Benchmark* b) {
+    b->ArgName("n")->RangeMultiplier(8)->Range(8, 32768);
+}
+
+// Stress-scenario streams for serial vs. multi-threaded PV
+void long_stream_sizes(benchmark::internal::Benchmark* b) {
+    b->ArgName("n")->RangeMultiplier(16)->Range(1 << 16, 1 << 24)->UseRealTime();
+}
+
+// FV batch sizes: one desk up to a full deposit book slice
+void book_sizes(benchmark::internal::Benchmark* b) {
+    b->ArgName("positions")->RangeMultiplier(32)->Range(1024, 1 << 20);
+}
+
+// Curves: one (GEMV) up to a full scenario set
+void curve_counts(benchmark::internal::Benchmark* b) {
+    b->ArgName("curves")->Arg(1)->Arg(4)->Arg(16)->Arg(64);
+}
+
+// Feeds: monthly / daily compounding, one L2-sized batch and a full feed
+void quote_feeds(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"n", "quotes"})->ArgsProduct({{12, 365}, {1 << 12, 1 << 20}});
+}
+
+// Interpolations: 0 linear, 1 log-linear, 2 monotone cubic
+void curve_interpolations(benchmark::internal::Benchmark* b) {
+    b->ArgName("interpolation")->Arg(0)->Arg(1)->Arg(2);
+}
+
+// Periods: annual, monthly, daily compounding and 30y of monthly periods
+void period_sizes(benchmark::internal::Benchmark* b) {
+    b->ArgName("periods")->Arg(1)->Arg(12)->Arg(360)->Arg(365);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_PolicyPresentValue, PresentValuePolicy)
+    ->Name("Policy/PresentValue")->Apply(pv_sizes);
+BENCHMARK_TEMPLATE(BM_PolicyPresentValue, RecurrencePresentValuePolicy)
+    ->Name("Policy/RecurrencePresentValue")->Apply(pv_sizes);
+BENCHMARK_TEMPLATE(BM_PolicyPresentValue, HornerPresentValuePolicy)
+    ->Name("Policy/HornerPresentValue")->Apply(pv_sizes);
+BENCHMARK_TEMPLATE(BM_PolicyPresentValue, SimdPresentValuePolicy)
+    ->Name("Policy/SimdPresentValue")->Apply(pv_sizes);
+BENCHMARK_TEMPLATE(BM_PolicyPresentValue, ReproducibleSimdPresentValuePolicy)
+    ->Name("Policy/ReproducibleSimdPresentValue")->Apply(pv_sizes);
+BENCHMARK_TEMPLATE(BM_PolicyPresentValue, SimdPresentValuePolicy)
+    ->Name("Policy/SimdPresentValue")->Apply(long_stream_sizes);
+BENCHMARK_TEMPLATE(BM_PolicyPresentValue, ParallelPresentValuePolicy)
+    ->Name("Policy/ParallelPresentValue")->Apply(long_stream_sizes);
+BENCHMARK(BM_PolicyFutureValue)->Name("Policy/FutureValue")->Apply(period_sizes);
+BENCHMARK(BM_PolicyInterestRate)->Name("Policy/InterestRateConversion")->Apply(period_sizes);
+
+BENCHMARK(BM_BatchFutureValueLoop)->Name("Batch/FutureValueLoop")->Apply(book_sizes);
+BENCHMARK(BM_BatchFutureValueSimd)->Name("Batch/SimdFutureValue")->Apply(book_sizes);
+
+BENCHMARK(BM_MatrixRowByRow)->Name("Matrix/RowByRowDot")->Apply(curve_counts);
+BENCHMARK(BM_MatrixGemm)->Name("Matrix/Gemm")->Apply(curve_counts);
+
+BENCHMARK_TEMPLATE(BM_Xnpv, Actual365Fixed)->Name("Xnpv/Act365");
+BENCHMARK_TEMPLATE(BM_Xnpv, Actual360)->Name("Xnpv/Act360");
+BENCHMARK_TEMPLATE(BM_Xnpv, Thirty360)->Name("Xnpv/Thirty360");
+BENCHMARK(BM_XnpvPowPerFlow)->Name("Xnpv/PowPerFlow");
+
+BENCHMARK(BM_IrrSolve)->Name("Irr/Solve")->ArgName("warm")->Arg(0)->Arg(1);
+BENCHMARK(BM_IrrPvBisection)->Name("Irr/PvBisection");
+
+BENCHMARK(BM_RunsDetected)->Name("Runs/PresentValuePolicy");
+BENCHMARK(BM_RunsPerPeriodPow)->Name("Runs/PerPeriodPow");
+BENCHMARK(BM_RunsSimd)->Name("Runs/SimdPresentValue");
+BENCHMARK(BM_RunsEncoded)->Name("Runs/Encoded");
+
+BENCHMARK(BM_BondPriceClosedForm)->Name("Bond/PriceClosedForm");
+BENCHMARK(BM_BondPriceSchedule)->Name("Bond/PriceSchedule");
+BENCHMARK(BM_BondYieldToMaturity)->Name("Bond/YieldToMaturity");
+
+BENCHMARK(BM_RiskFused)->Name("Risk/FusedSensitivities")->Apply(pv_sizes);
+BENCHMARK(BM_RiskBumped)->Name("Risk/ThreeBumpedPvs")->Apply(pv_sizes);
+
+BENCHMARK(BM_ErrorsThrowing)->Name("Errors/ThrowingTryCatch")->Apply(book_sizes);
+BENCHMARK(BM_ErrorsStatus)->Name("Errors/StatusExpected")->Apply(book_sizes);
+
+BENCHMARK(BM_EarExact)->Name("Ear/ExactPolicy")->Apply(quote_feeds);
+BENCHMARK(BM_EarTabulated)->Name("Ear/Tabulated")->Apply(quote_feeds);
+BENCHMARK(BM_EarTabulatedParallel)->Name("Ear/TabulatedParallel")->Apply(quote_feeds)->UseRealTime();
+
+BENCHMARK(BM_CurveHinted)->Name("Curve/HintedWalk")->Apply(curve_interpolations);
+BENCHMARK(BM_CurvePerFlowSearch)->Name("Curve/PerFlowSearch")->Apply(curve_interpolations);
+
+BENCHMARK_TEMPLATE(BM_WrapperPresentValue, PresentValuePolicy)
+    ->Name("Wrapper/PresentValue")->Apply(pv_sizes);
+BENCHMARK_TEMPLATE(BM_WrapperPresentValue, SimdPresentValuePolicy)
+    ->Name("Wrapper/SimdPresentValue")->Apply(pv_sizes);
+BENCHMARK(BM_WrapperFutureValue)->Name("Wrapper/FutureValue")->Apply(period_sizes);
+BENCHMARK(BM_WrapperInterestRate)->Name("Wrapper/InterestRateConversion")->Apply(period_sizes);
+
+BENCHMARK(BM_CApiPresentValue)->Name("CApi/pv_calculator_calculate")->Apply(pv_sizes);
+BENCHMARK(BM_CApiPresentValueShared)->Name("CApi/pv_calculator_calculate_ex")->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_CApiPresentValueCached)->Name("CApi/pv_calculator_calculate_cached")->Apply(pv_sizes);
+BENCHMARK(BM_CApiFutureValue)->Name("CApi/fv_calculator_calculate")->Apply(period_sizes);
+BENCHMARK(BM_CApiFutureValueBatch)->Name("CApi/fv_calculator_calculate_batch")->Apply(book_sizes);
+BENCHMARK(BM_CApiInterestRate)->Name("CApi/ir_calculator_calculate")->Apply(period_sizes);
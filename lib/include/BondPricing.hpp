@@ -0,0 +1,234 @@
+#ifndef BONDPRICING_HPP
+#define BONDPRICING_HPP
+
+#include "ErrorPolicies.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+// ===========================================================================
+// BondPricingPolicy
+// ===========================================================================
+// Fixed-coupon bond priced from its terms, with no cash-flow vector: the
+// schedule "coupon c for n periods, face F with the last coupon" is
+// PresentValuePolicy's stream {c, ..., c, c + F}, whose PV at the period
+// yield y = yield / frequency has the closed form
+//   P = c · a_n + F · vⁿ,    v = 1 / (1 + y),  a_n = Σ_{t=1..n} vᵗ = (1 - vⁿ) / y
+//
+// Risk comes from the same sums, one level up:
+//   A1 = Σ t·vᵗ        = (1 + y) (a_n - n vⁿ⁺¹) / y
+//   A2 = Σ t(t+1)·vᵗ   = (1 + y) (2 A1 - n(n+1) vⁿ⁺¹) / y
+//   Macaulay duration  = (c A1 + F n vⁿ) / (P · frequency)           years
+//   Modified duration  = Macaulay / (1 + y)                            years
+//   Convexity          = v² (c A2 + F n(n+1) vⁿ) / (P · frequency²)   years²
+// so price, durations and convexity cost a log1p and two exps per bond,
+// whatever its maturity. Close to y = 0 (|n·y| < kSeriesThreshold) the
+// divisions by y cancel badly and the sums are accumulated term by term.
+//
+// Yields are annual, compounded `frequency` times a year. Yield to maturity
+// inverts the price with Newton steps on ln P, using the closed forms for
+// P and dP/dy = -v (c A1 + F n vⁿ). ln P is close to linear in ln(1 + y),
+// so a start far from the answer (deep premium bonds, whose price grows
+// like vⁿ) costs a few steps instead of many. The start is the usual
+// approximation
+//   y₀ = (c + (F - P) / n) / ((F + P) / 2)
+//
+// Throws std::invalid_argument on bad terms (face ≤ 0, coupon_rate < 0,
+// periods or frequency < 1) or a yield ≤ -frequency, and std::domain_error
+// if the yield search does not converge. validate() / evaluate() and the
+// evaluate_analytics / evaluate_yield bodies report the same as CalcError
+// codes (Calculator<BondPricingPolicy, StatusErrorPolicy> prices).
+//
+// Example Usage:
+//   BondTerms bond{1000.0, 0.05, 10, 2};   // 5-year 5% semi-annual
+//   Calculator<BondPricingPolicy> bond_calc;
+//   double price = bond_calc.calculate(bond, 0.04);
+//   double ytm = BondPricingPolicy::yield_to_maturity(bond, price);
+// ===========================================================================
+
+struct BondTerms {
+    double face;         // redemption amount, paid with the last coupon
+    double coupon_rate;  // annual coupon rate (0.05 for 5%)
+    int periods;         // coupons remaining
+    int frequency = 1;   // coupons per year
+};
+
+struct BondPricingPolicy {
+    struct Analytics {
+        double price;
+        double macaulay_duration;  // years
+        double modified_duration;  // years
+        double convexity;          // years²
+    };
+
+    // |n·y| below which the closed-form sums are replaced by a loop
+    static constexpr double kSeriesThreshold = 0.05;
+
+    static constexpr double kYieldTolerance = 1e-13;
+    static constexpr int kMaxIterations = 100;
+
+    // Why the terms are invalid
+    static CalcError validate(const BondTerms& bond) noexcept {
+        if (!(bond.face > 0.0) || !std::isfinite(bond.face)) {
+            return CalcError::Face;
+        }
+        if (!(bond.coupon_rate >= 0.0) || !std::isfinite(bond.coupon_rate)) {
+            return CalcError::CouponRate;
+        }
+        if (bond.periods < 1) {
+            return CalcError::BondPeriods;
+        }
+        if (bond.frequency < 1) {
+            return CalcError::Frequency;
+        }
+        return CalcError::None;
+    }
+
+    // Terms and a yield to price (or analyse) them at
+    static CalcError validate(const BondTerms& bond, double yield) noexcept {
+        if (const CalcError error = validate(bond); error != CalcError::None) {
+            return error;
+        }
+        if (!(yield > -bond.frequency) || !std::isfinite(yield)) {
+            return CalcError::Yield;
+        }
+        return CalcError::None;
+    }
+
+    // Terms and a market price to invert
+    static CalcError validate_price(const BondTerms& bond, double price) noexcept {
+        if (const CalcError error = validate(bond); error != CalcError::None) {
+            return error;
+        }
+        if (!(price > 0.0) || !std::isfinite(price)) {
+            return CalcError::Price;
+        }
+        return CalcError::None;
+    }
+
+    // Price (PV per the face given) at an annual yield
+    static double calculate(const BondTerms& bond, double yield) {
+        throw_on_error(validate(bond, yield));
+        return evaluate(bond, yield);
+    }
+
+    // Unchecked body (validate() passed)
+    static double evaluate(const BondTerms& bond, double yield) noexcept {
+        const double y = yield / bond.frequency;
+        const double n = bond.periods;
+        const double c = coupon(bond);
+        if (y == 0.0) {
+            return c * n + bond.face;
+        }
+        const double log_v = -std::log1p(y);
+        return c * (-std::expm1(n * log_v) / y) + bond.face * std::exp(n * log_v);
+    }
+
+    static Analytics analytics(const BondTerms& bond, double yield) {
+        throw_on_error(validate(bond, yield));
+        return evaluate_analytics(bond, yield);
+    }
+
+    // Unchecked analytics (validate() passed)
+    static Analytics evaluate_analytics(const BondTerms& bond, double yield) noexcept {
+        const double y = yield / bond.frequency;
+        const Sums s = sums(bond.periods, y);
+        const double n = bond.periods;
+        const double c = coupon(bond);
+        const double f = bond.frequency;
+
+        const double price = c * s.a0 + bond.face * s.q;
+        const double macaulay = (c * s.a1 + bond.face * n * s.q) / (price * f);
+        const double v = 1.0 / (1.0 + y);
+        const double convexity = v * v * (c * s.a2 + bond.face * n * (n + 1.0) * s.q) / (price * f * f);
+        return {price, macaulay, macaulay * v, convexity};
+    }
+
+    // Annual yield at which the bond prices to `price` (> 0)
+    static double yield_to_maturity(const BondTerms& bond, double price) {
+        throw_on_error(validate_price(bond, price));
+        const Expected<double> yield = evaluate_yield(bond, price);
+        if (!yield) {
+            throw std::domain_error(error_message(yield.error()));
+        }
+        return *yield;
+    }
+
+    // Unchecked yield search (validate_price() passed): the yield, or
+    // CalcError::YieldNotFound
+    static Expected<double> evaluate_yield(const BondTerms& bond, double price) noexcept {
+        const double n = bond.periods;
+        const double c = coupon(bond);
+        const double f = bond.frequency;
+
+        double y = (c + (bond.face - price) / n) / (0.5 * (bond.face + price));
+        if (y <= -0.5) {
+            y = -0.5;
+        }
+        for (int i = 0; i < kMaxIterations; ++i) {
+            const Sums s = sums(bond.periods, y);
+            const double model = c * s.a0 + bond.face * s.q;
+            const double slope = -(c * s.a1 + bond.face * n * s.q) / (1.0 + y);  // dP/dy
+            double next = y - std::log(model / price) * model / slope;
+            if (next <= -1.0) {
+                next = 0.5 * (y - 1.0);  // halfway to the pole at -1
+            }
+            if (std::fabs(next - y) <= kYieldTolerance * std::fmax(1.0, std::fabs(next))) {
+                return next * f;
+            }
+            y = next;
+        }
+        return CalcError::YieldNotFound;
+    }
+
+    // Prices of a portfolio, one yield per bond
+    static void calculate_batch(std::span<const BondTerms> bonds, std::span<const double> yields,
+                                std::span<double> results) {
+        if (yields.size() != bonds.size() || results.size() != bonds.size()) {
+            throw std::invalid_argument("bonds, yields and results must have the same length");
+        }
+        for (std::size_t i = 0; i < bonds.size(); ++i) {
+            results[i] = calculate(bonds[i], yields[i]);
+        }
+    }
+
+private:
+    // vⁿ and the annuity sums a_n, A1, A2 at period yield y
+    struct Sums {
+        double q;
+        double a0;
+        double a1;
+        double a2;
+    };
+
+    static Sums sums(int periods, double y) noexcept {
+        const double n = periods;
+        if (std::fabs(n * y) < kSeriesThreshold) {
+            const double v = 1.0 / (1.0 + y);
+            Sums s{1.0, 0.0, 0.0, 0.0};
+            for (int t = 1; t <= periods; ++t) {
+                const double k = t;
+                s.q *= v;
+                s.a0 += s.q;
+                s.a1 += k * s.q;
+                s.a2 += k * (k + 1.0) * s.q;
+            }
+            return s;
+        }
+        const double log_v = -std::log1p(y);
+        const double q = std::exp(n * log_v);
+        const double a0 = -std::expm1(n * log_v) / y;
+        const double qv = q / (1.0 + y);
+        const double growth = (1.0 + y) / y;
+        const double a1 = growth * (a0 - n * qv);
+        return {q, a0, a1, growth * (2.0 * a1 - n * (n + 1.0) * qv)};
+    }
+
+    static double coupon(const BondTerms& bond) noexcept {
+        return bond.face * bond.coupon_rate / bond.frequency;
+    }
+};
+
+#endif // BONDPRICING_HPP
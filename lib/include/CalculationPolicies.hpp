@@ -1,24 +1,48 @@
 #ifndef CALCULATIONPOLICIES_HPP
 #define CALCULATIONPOLICIES_HPP
 
-#include <vector>
+#include "ErrorPolicies.hpp"
+#include "IntegerPower.hpp"
+#include "RunLengthPresentValue.hpp"
+
+#include <span>
 #include <cmath>
 #include <stdexcept>
 #include <cstddef>
+#include <type_traits>
 
 // ===========================================================================
 // PresentValuePolicy
 // PV = Σ_{i=0..n-1} CF_i / (1 + r)^(i+1)
 //   • All cash flows are future-dated: the first element occurs at t = 1
 //   • discount_rate is decimal (e.g., 0.05 for 5%)
+//   • cash_flows is a non-owning view: vectors, arrays and raw C buffers
+//     are all passed without copying
+//   • Streams made of long runs of equal payments (level annuities, bond
+//     coupons) are detected and priced with the closed-form annuity factor
+//     per run (RunLengthPresentValue.hpp) instead of a std::pow per period
+//   • constexpr: in a constant expression each discount factor comes from
+//     the integer power engine (IntegerPower.hpp) and runs are not
+//     detected; agrees with the runtime result to a few ulp
 // ===========================================================================
 struct PresentValuePolicy {
-    static double calculate(double discount_rate, const std::vector<double>& cash_flows) {
-        if (discount_rate <= -1.0) {
-            throw std::invalid_argument("discount_rate must be > -1");
+    static constexpr CalcError validate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        return present_value_error(discount_rate, cash_flows.size());
+    }
+
+    static constexpr double calculate(double discount_rate, std::span<const double> cash_flows) {
+        throw_on_error(validate(discount_rate, cash_flows));
+        return evaluate(discount_rate, cash_flows);
+    }
+
+    // Unchecked body (validate() passed)
+    static constexpr double evaluate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        if (std::is_constant_evaluated()) {
+            return constant_evaluate(discount_rate, cash_flows);
         }
-        if (cash_flows.empty()) {
-            throw std::invalid_argument("cash_flows must not be empty");
+        if (RunLengthPresentValuePolicy::worthwhile(cash_flows.data(), cash_flows.size())) {
+            return RunLengthPresentValuePolicy::accumulate_detected(discount_rate, cash_flows.data(),
+                                                                    cash_flows.size());
         }
 
         const double base = 1.0 + discount_rate;
@@ -29,6 +53,99 @@ struct PresentValuePolicy {
         }
         return pv;
     }
+
+    // The same in-order sum for constant evaluation (std::pow is not constexpr)
+    static constexpr double constant_evaluate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        const double base = 1.0 + discount_rate;
+        double pv = 0.0;
+        for (std::size_t i = 0; i < cash_flows.size(); ++i) {
+            pv += cash_flows[i] / integer_power(base, static_cast<unsigned>(i + 1));
+        }
+        return pv;
+    }
+};
+
+// ===========================================================================
+// RecurrencePresentValuePolicy
+// Same PV as PresentValuePolicy, but discount factors are built by running
+// multiplication df_{t+1} = df_t * v with v = 1 / (1 + r), instead of one
+// std::pow + division per cash flow.
+//   • Every kAnchorInterval periods df is re-anchored to 1 / (1 + r)^t so the
+//     rounding drift of the running product cannot accumulate past one block
+//   • Error bound vs. PresentValuePolicy (u = 2^-53 unit roundoff):
+//       each df carries at most (kAnchorInterval + 2)·u relative error against
+//       ~2u for the pow path, so with identical (naive, in-order) summation
+//       |PV_rec - PV_pow| <= (kAnchorInterval + 4)·u·Σ|CF_i·df_i| + γ_{n-1}·Σ|CF_i·df_i|
+//     i.e. ~36 ulps of the absolute discounted mass for the default interval
+// ===========================================================================
+struct RecurrencePresentValuePolicy {
+    static constexpr std::size_t kAnchorInterval = 32;
+
+    static constexpr CalcError validate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        return present_value_error(discount_rate, cash_flows.size());
+    }
+
+    static double calculate(double discount_rate, std::span<const double> cash_flows) {
+        throw_on_error(validate(discount_rate, cash_flows));
+        return evaluate(discount_rate, cash_flows);
+    }
+
+    // Unchecked body (validate() passed)
+    static double evaluate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        return accumulate(1.0 + discount_rate, cash_flows.data(), cash_flows.size());
+    }
+
+    // Unchecked kernel over a raw buffer; shared with the SIMD scalar path.
+    // Real is the working precision (double, or long double for
+    // PrecisionPresentValuePolicy); float flows are widened as they are read.
+    template <typename Real, typename Flow>
+    static Real accumulate(Real base, const Flow* cash_flows, std::size_t n) noexcept {
+        const Real v = Real(1) / base;
+
+        Real pv = 0;
+        for (std::size_t start = 0; start < n; start += kAnchorInterval) {
+            // Anchor: exact (pow-based) discount factor at t = start + 1
+            Real df = Real(1) / std::pow(base, static_cast<Real>(start) + Real(1));
+            const std::size_t end = (n - start < kAnchorInterval) ? n : start + kAnchorInterval;
+            for (std::size_t i = start; i < end; ++i) {
+                pv += cash_flows[i] * df;
+                df *= v;
+            }
+        }
+        return pv;
+    }
+};
+
+// ===========================================================================
+// HornerPresentValuePolicy
+// PV written as a polynomial in v = 1 / (1 + r) and evaluated Horner-style
+// from the last cash flow backwards:
+//   PV = v·(CF_0 + v·(CF_1 + v·(... + v·CF_{n-1})))
+//   • One multiply + one add per cash flow, no pow, no division in the loop
+//   • Error bound vs. the exact PV: |PV_horner - PV| <= γ_{3n}·Σ|CF_i·df_i|
+//     (γ_k = k·u / (1 - k·u); 2n from Horner, n from the rounding of v
+//     propagated through v^n). Prefer RecurrencePresentValuePolicy when n is
+//     large and the flows are strongly mixed-sign.
+// ===========================================================================
+struct HornerPresentValuePolicy {
+    static constexpr CalcError validate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        return present_value_error(discount_rate, cash_flows.size());
+    }
+
+    static double calculate(double discount_rate, std::span<const double> cash_flows) {
+        throw_on_error(validate(discount_rate, cash_flows));
+        return evaluate(discount_rate, cash_flows);
+    }
+
+    // Unchecked body (validate() passed)
+    static double evaluate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        const double v = 1.0 / (1.0 + discount_rate);
+        double acc = 0.0;
+        for (std::size_t i = cash_flows.size(); i-- > 0;) {
+            acc = (acc + cash_flows[i]) * v;
+        }
+        return acc;
+    }
 };
 
 // ===========================================================================
@@ -36,19 +153,36 @@ struct PresentValuePolicy {
 // FV = PV * (1 + r)^n
 //   • interest_rate is decimal (e.g., 0.05 for 5%)
 //   • periods is a nonnegative integer
+//   • Small n (integer_power_fast_path) go through the integer power engine
+//     (IntegerPower.hpp) instead of std::pow: cheaper, and ≤ 0.5 ulp
+//   • constexpr: a constant expression uses the engine for every n (larger
+//     n may then differ from the runtime std::pow result in the last bit)
 // ===========================================================================
 struct FutureValuePolicy {
-    static double calculate(double principal, double interest_rate, int periods) {
+    static constexpr CalcError validate(double principal, double interest_rate, int periods) noexcept {
         if (principal < 0.0) {
-            throw std::invalid_argument("principal must be >= 0");
+            return CalcError::Principal;
         }
         if (interest_rate <= -1.0) {
-            throw std::invalid_argument("interest_rate must be > -1");
+            return CalcError::InterestRate;
         }
         if (periods < 0) {
-            throw std::invalid_argument("periods must be >= 0");
+            return CalcError::Periods;
         }
+        return CalcError::None;
+    }
+
+    static constexpr double calculate(double principal, double interest_rate, int periods) {
+        throw_on_error(validate(principal, interest_rate, periods));
+        return evaluate(principal, interest_rate, periods);
+    }
 
+    // Unchecked body (validate() passed)
+    static constexpr double evaluate(double principal, double interest_rate, int periods) noexcept {
+        const unsigned n = static_cast<unsigned>(periods);
+        if (std::is_constant_evaluated() || integer_power_fast_path(n)) {
+            return scaled_integer_power(principal, 1.0 + interest_rate, n);
+        }
         return principal * std::pow(1.0 + interest_rate, static_cast<double>(periods));
     }
 };
@@ -58,20 +192,38 @@ struct FutureValuePolicy {
 // Effective Annual Rate (EAR) from nominal r with n compounding periods/year:
 // EAR = (1 + r/n)^n - 1
 //   • For n = 1, return r exactly (avoids tiny FP diffs in strict tests)
+//   • Small n (integer_power_fast_path) go through the integer power engine
+//     (IntegerPower.hpp), which also subtracts the 1 before the final
+//     rounding, so small rates keep their low-order digits
+//   • constexpr: a constant expression uses the engine for every n, as
+//     FutureValuePolicy does
 // ===========================================================================
 struct InterestRateConversionPolicy {
-    static double calculate(double nominal_rate, int compounding_periods) {
+    static constexpr CalcError validate(double nominal_rate, int compounding_periods) noexcept {
         if (nominal_rate <= -1.0) {
-            throw std::invalid_argument("nominal_rate must be > -1");
+            return CalcError::NominalRate;
         }
         if (compounding_periods <= 0) {
-            throw std::invalid_argument("compounding_periods must be > 0");
+            return CalcError::CompoundingPeriods;
         }
+        return CalcError::None;
+    }
 
+    static constexpr double calculate(double nominal_rate, int compounding_periods) {
+        throw_on_error(validate(nominal_rate, compounding_periods));
+        return evaluate(nominal_rate, compounding_periods);
+    }
+
+    // Unchecked body (validate() passed)
+    static constexpr double evaluate(double nominal_rate, int compounding_periods) noexcept {
         if (compounding_periods == 1) {
             return nominal_rate;
         }
         const double n = static_cast<double>(compounding_periods);
+        const unsigned m = static_cast<unsigned>(compounding_periods);
+        if (std::is_constant_evaluated() || integer_power_fast_path(m)) {
+            return integer_power_minus_one(1.0 + nominal_rate / n, m);
+        }
         return std::pow(1.0 + nominal_rate / n, n) - 1.0;
     }
 };
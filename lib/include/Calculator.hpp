@@ -1,9 +1,19 @@
 #ifndef Calculator_HPP
 #define Calculator_HPP
 
+#include "ErrorPolicies.hpp"
+
+#include <concepts>
+#include <cstdint>
 #include <iostream>
 #include <string>
-#include <vector>
+#include <span>
+#include <initializer_list>
+#include <type_traits>
+
+struct BondTerms;
+struct CashFlowRun;
+class YieldCurve;
 
 // ===========================================================================
 // Calculator Template Class
@@ -11,39 +21,176 @@
 // Policy-based calculator that delegates calculations to the policy class.
 // The policy determines the calculation logic and signature.
 //
-// Template Parameter:
+// Template Parameters:
 //   CalculationPolicy - A policy class that provides a static calculate() method
+//   ErrorPolicy       - How invalid arguments are reported (ErrorPolicies.hpp):
+//                       ThrowingErrorPolicy (default) throws
+//                       std::invalid_argument; StatusErrorPolicy returns
+//                       Expected<T> and never throws
+//
+// calculate() is constexpr: with PresentValuePolicy, FutureValuePolicy and
+// InterestRateConversionPolicy it can run at compile time (an invalid
+// argument is then a compile error under ThrowingErrorPolicy).
 //
 // Example Usage:
 //   Calculator<PresentValuePolicy> pv_calc;
 //   double result = pv_calc.calculate(0.05, {100.0, 200.0, 300.0});
+//
+//   constexpr Calculator<FutureValuePolicy> fv_calc;
+//   static_assert(fv_calc.calculate(100.0, 0.0, 10) == 100.0);
+//
+//   Calculator<PresentValuePolicy, StatusErrorPolicy> status_calc;
+//   Expected<double> pv = status_calc.calculate(0.05, cash_flows);
+//
+// calculate_batch() and calculate_matrix() fill a caller's span and have
+// no Expected<> form, so they exist only under ThrowingErrorPolicy (the C
+// API's *_batch_status calls are the per-element status route).
 // ===========================================================================
 
-template <typename CalculationPolicy>
+template <typename CalculationPolicy, typename ErrorPolicy = ThrowingErrorPolicy>
 class Calculator {
 public:
     // ========================================================================
     // Present Value Calculation
     // For Calculator<PresentValuePolicy>
+    // Any contiguous range of double (std::vector, std::array, std::span,
+    // raw buffers wrapped in a span) binds to the view without a copy.
+    // Returns the policy's result: a double, or PvSensitivities for
+    // Calculator<PresentValueSensitivityPolicy> (PresentValueSensitivities.hpp);
+    // wrapped in Expected<> under StatusErrorPolicy
     // ========================================================================
-    double calculate(double discount_rate, const std::vector<double>& cash_flows) {
-        return CalculationPolicy::calculate(discount_rate, cash_flows);
+    constexpr auto calculate(double discount_rate, std::span<const double> cash_flows) const {
+        return ErrorPolicy::template call<CalculationPolicy>(discount_rate, cash_flows);
+    }
+
+    constexpr auto calculate(double discount_rate, std::initializer_list<double> cash_flows) const {
+        return ErrorPolicy::template call<CalculationPolicy>(
+            discount_rate, std::span<const double>(cash_flows.begin(), cash_flows.size()));
     }
     
+    // ========================================================================
+    // Run-Length Present Value Calculation
+    // For Calculator<RunLengthPresentValuePolicy> (RunLengthPresentValue.hpp):
+    // level-payment runs, priced in O(runs)
+    // ========================================================================
+    constexpr auto calculate(double discount_rate, std::span<const CashFlowRun> runs) const {
+        return ErrorPolicy::template call<CalculationPolicy>(discount_rate, runs);
+    }
+
+    // ========================================================================
+    // Dated Present Value Calculation
+    // For Calculator<XnpvPolicy<DayCount>> (DatedPresentValue.hpp): cash
+    // flows on day-serial dates
+    // ========================================================================
+    constexpr auto calculate(double discount_rate, std::span<const std::int64_t> dates,
+                             std::span<const double> cash_flows) const {
+        return ErrorPolicy::template call<CalculationPolicy>(discount_rate, dates, cash_flows);
+    }
+
+    // ========================================================================
+    // Curve Present Value Calculation
+    // For Calculator<CurvePresentValuePolicy> (YieldCurve.hpp): dated cash
+    // flows discounted on a yield curve
+    // ========================================================================
+    constexpr auto calculate(const YieldCurve& curve, std::span<const double> times,
+                             std::span<const double> cash_flows) const {
+        return ErrorPolicy::template call<CalculationPolicy>(curve, times, cash_flows);
+    }
+
+    // ========================================================================
+    // Bond Pricing
+    // For Calculator<BondPricingPolicy> (BondPricing.hpp): price of a
+    // fixed-coupon bond at an annual yield
+    // ========================================================================
+    constexpr auto calculate(const BondTerms& bond, double yield) const {
+        return ErrorPolicy::template call<CalculationPolicy>(bond, yield);
+    }
+
     // ========================================================================
     // Future Value Calculation
     // For Calculator<FutureValuePolicy>
     // ========================================================================
-    double calculate(double principal, double interest_rate, int periods) {
-        return CalculationPolicy::calculate(principal, interest_rate, periods);
+    constexpr auto calculate(double principal, double interest_rate, int periods) const {
+        return ErrorPolicy::template call<CalculationPolicy>(principal, interest_rate, periods);
+    }
+
+    // Structure-of-arrays batch, for policies that provide calculate_batch
+    // (e.g. Calculator<SimdFutureValuePolicy>); throws on invalid elements
+    void calculate_batch(std::span<const double> principals,
+                         std::span<const double> interest_rates,
+                         std::span<const int> periods,
+                         std::span<double> results) const
+        requires std::same_as<ErrorPolicy, ThrowingErrorPolicy> {
+        CalculationPolicy::calculate_batch(principals, interest_rates, periods, results);
+    }
+
+    // Rates at one compounding frequency, for policies that provide it
+    // (e.g. Calculator<TabulatedInterestRateConversionPolicy>); throws on
+    // invalid elements
+    void calculate_batch(std::span<const double> nominal_rates, int compounding_periods,
+                         std::span<double> results) const
+        requires std::same_as<ErrorPolicy, ThrowingErrorPolicy> {
+        CalculationPolicy::calculate_batch(nominal_rates, compounding_periods, results);
+    }
+
+    // ========================================================================
+    // Matrix Present Value
+    // For policies that provide calculate_matrix
+    // (e.g. Calculator<MatrixPresentValuePolicy>); throws on bad shapes
+    // ========================================================================
+    template <typename Matrix>
+        requires std::same_as<ErrorPolicy, ThrowingErrorPolicy>
+    void calculate_matrix(const Matrix& cash_flows, const Matrix& discount_factors,
+                          std::span<double> results) const {
+        CalculationPolicy::calculate_matrix(cash_flows, discount_factors, results);
     }
     
+    // ========================================================================
+    // Internal Rate of Return
+    // For Calculator<InternalRateOfReturnPolicy> (InternalRateOfReturn.hpp);
+    // guess warm-starts the solver
+    // ========================================================================
+    constexpr auto calculate(std::span<const double> cash_flows, double guess) const {
+        return ErrorPolicy::template call<CalculationPolicy>(cash_flows, guess);
+    }
+
     // ========================================================================
     // Interest Rate Conversion
     // For Calculator<InterestRateConversionPolicy>
     // ========================================================================
-    double calculate(double nominal_rate, int compounding_periods) {
-        return CalculationPolicy::calculate(nominal_rate, compounding_periods);
+    constexpr auto calculate(double nominal_rate, int compounding_periods) const {
+        return ErrorPolicy::template call<CalculationPolicy>(nominal_rate, compounding_periods);
+    }
+
+    // ========================================================================
+    // Other Precisions
+    // For Calculator<PrecisionPresentValuePolicy<Real>> and the FV / EAR
+    // counterparts (PrecisionPolicies.hpp) with Real = float or long double,
+    // deduced from the first argument; the other arguments convert to it
+    // ========================================================================
+    template <std::floating_point Real>
+        requires (!std::same_as<Real, double>)
+    constexpr auto calculate(Real discount_rate,
+                             std::type_identity_t<std::span<const Real>> cash_flows) const {
+        return ErrorPolicy::template call<CalculationPolicy>(discount_rate, cash_flows);
+    }
+
+    template <std::floating_point Real>
+        requires (!std::same_as<Real, double>)
+    constexpr auto calculate(Real principal, std::type_identity_t<Real> interest_rate, int periods) const {
+        return ErrorPolicy::template call<CalculationPolicy>(principal, interest_rate, periods);
+    }
+
+    template <std::floating_point Real>
+        requires (!std::same_as<Real, double>)
+    constexpr auto calculate(Real nominal_rate, int compounding_periods) const {
+        return ErrorPolicy::template call<CalculationPolicy>(nominal_rate, compounding_periods);
+    }
+
+    // Float cash flows at a double rate
+    // (Calculator<MixedPrecisionPresentValuePolicy>)
+    constexpr auto calculate(double discount_rate, std::span<const float> cash_flows) const {
+        return ErrorPolicy::template call<CalculationPolicy>(discount_rate, cash_flows);
     }
 };
 
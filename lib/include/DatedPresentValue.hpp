@@ -0,0 +1,207 @@
+#ifndef DATEDPRESENTVALUE_HPP
+#define DATEDPRESENTVALUE_HPP
+
+#include "ErrorPolicies.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+// ===========================================================================
+// Dated Present Value (XNPV)
+// ===========================================================================
+// PV of cash flows paid on arbitrary dates, discounted from the first date:
+//   XNPV = Σ CF_i / (1 + r)^yf(d_0, d_i)
+// with the year fraction yf given by a day-count policy:
+//   • Actual365Fixed  yf = actual days / 365   (Excel XNPV)
+//   • Actual360       yf = actual days / 360
+//   • Thirty360       yf = 30/360 days / 360   (bond basis: a 31st start is
+//                     the 30th; a 31st end is the 30th when the start is)
+//
+// Dates are day serials: days since 1970-01-01, the layout of NumPy's
+// datetime64[D]. days_from_civil / civil_from_days convert to and from
+// calendar dates.
+//
+// Every policy counts days with a Counter anchored at d_0, so the day count
+// of a flow is integer arithmetic on its serial: a subtraction for the
+// actual conventions, and for 30/360 a month window the counter carries from
+// one flow to the next (sorted schedules step one month at a time instead of
+// converting every date to year / month / day). The discount factor is then
+//   exp(count · -ln(1 + r) / basis)
+// with the logarithm taken once per stream, not one std::pow per flow.
+//
+// Example Usage:
+//   std::vector<std::int64_t> dates = {days_from_civil(2024, 1, 15), ...};
+//   Calculator<XnpvPolicy<Thirty360>> xnpv;
+//   double pv = xnpv.calculate(0.05, dates, cash_flows);
+// ===========================================================================
+
+struct CivilDate {
+    std::int64_t year;
+    std::int64_t month;  // 1..12
+    std::int64_t day;    // 1..31
+};
+
+// Day serial of a proleptic Gregorian date (H. Hinnant's algorithm)
+constexpr std::int64_t days_from_civil(std::int64_t year, std::int64_t month, std::int64_t day) {
+    const std::int64_t y = month <= 2 ? year - 1 : year;
+    const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const std::int64_t yoe = y - era * 400;
+    const std::int64_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const std::int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+constexpr CivilDate civil_from_days(std::int64_t serial) {
+    const std::int64_t z = serial + 719468;
+    const std::int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const std::int64_t doe = z - era * 146097;
+    const std::int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const std::int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const std::int64_t mp = (5 * doy + 2) / 153;
+    const std::int64_t month = mp < 10 ? mp + 3 : mp - 9;
+    return {yoe + era * 400 + (month <= 2 ? 1 : 0), month, doy - (153 * mp + 2) / 5 + 1};
+}
+
+constexpr std::int64_t days_in_month(std::int64_t year, std::int64_t month) {
+    if (month == 2) {
+        const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+        return leap ? 29 : 28;
+    }
+    return (month == 4 || month == 6 || month == 9 || month == 11) ? 30 : 31;
+}
+
+// ===========================================================================
+// Day-Count Policies
+// Each provides kDaysPerYear and a Counter: Counter(start).days(date) is the
+// convention's day count from start to date (negative before start).
+// ===========================================================================
+
+struct Actual365Fixed {
+    static constexpr double kDaysPerYear = 365.0;
+
+    class Counter {
+    public:
+        explicit constexpr Counter(std::int64_t start) : start_(start) {}
+        constexpr std::int64_t days(std::int64_t date) const { return date - start_; }
+
+    private:
+        std::int64_t start_;
+    };
+};
+
+struct Actual360 {
+    static constexpr double kDaysPerYear = 360.0;
+    using Counter = Actual365Fixed::Counter;
+};
+
+struct Thirty360 {
+    static constexpr double kDaysPerYear = 360.0;
+
+    class Counter {
+    public:
+        explicit constexpr Counter(std::int64_t start) {
+            convert(start);
+            start_year_ = year_;
+            start_month_ = month_;
+            const std::int64_t day = start - month_start_ + 1;
+            start_day_ = day == 31 ? 30 : day;
+        }
+
+        constexpr std::int64_t days(std::int64_t date) {
+            if (date < month_start_ || date >= next_month_start_) {
+                locate(date);
+            }
+            std::int64_t day = date - month_start_ + 1;
+            if (day == 31 && start_day_ == 30) {
+                day = 30;
+            }
+            return 360 * (year_ - start_year_) + 30 * (month_ - start_month_) + (day - start_day_);
+        }
+
+    private:
+        // Move the month window to the month holding date: one step for the
+        // next month, a full conversion otherwise
+        constexpr void locate(std::int64_t date) {
+            const std::int64_t next_year = month_ == 12 ? year_ + 1 : year_;
+            const std::int64_t next_month = month_ == 12 ? 1 : month_ + 1;
+            const std::int64_t next_end = next_month_start_ + days_in_month(next_year, next_month);
+            if (date < next_month_start_ || date >= next_end) {
+                convert(date);
+                return;
+            }
+            year_ = next_year;
+            month_ = next_month;
+            month_start_ = next_month_start_;
+            next_month_start_ = next_end;
+        }
+
+        constexpr void convert(std::int64_t date) {
+            const CivilDate civil = civil_from_days(date);
+            year_ = civil.year;
+            month_ = civil.month;
+            month_start_ = date - civil.day + 1;
+            next_month_start_ = month_start_ + days_in_month(year_, month_);
+        }
+
+        std::int64_t year_ = 0;
+        std::int64_t month_ = 0;
+        std::int64_t month_start_ = 0;       // serial of the 1st of month_
+        std::int64_t next_month_start_ = 0;  // serial of the 1st of the next month
+        std::int64_t start_year_ = 0;
+        std::int64_t start_month_ = 0;
+        std::int64_t start_day_ = 0;         // adjusted: 31 → 30
+    };
+};
+
+// ===========================================================================
+// XnpvPolicy
+// XNPV of (date, amount) pairs given as parallel arrays, discounted at an
+// annually compounded rate from dates[0] under the DayCount convention.
+// Dates may be in any order (flows before dates[0] compound forward);
+// sorted dates are the fast path for Thirty360.
+// ===========================================================================
+template <typename DayCount = Actual365Fixed>
+struct XnpvPolicy {
+    static constexpr CalcError validate(double discount_rate, std::span<const std::int64_t> dates,
+                                        std::span<const double> cash_flows) noexcept {
+        if (cash_flows.empty()) {
+            return CalcError::EmptyCashFlows;
+        }
+        if (dates.size() != cash_flows.size()) {
+            return CalcError::DateCount;
+        }
+        if (discount_rate <= -1.0) {
+            return CalcError::DiscountRate;
+        }
+        return CalcError::None;
+    }
+
+    static double calculate(double discount_rate, std::span<const std::int64_t> dates,
+                            std::span<const double> cash_flows) {
+        throw_on_error(validate(discount_rate, dates, cash_flows));
+        return evaluate(discount_rate, dates, cash_flows);
+    }
+
+    // Unchecked body (validate() passed)
+    static double evaluate(double discount_rate, std::span<const std::int64_t> dates,
+                           std::span<const double> cash_flows) noexcept {
+        return accumulate(discount_rate, dates.data(), cash_flows.data(), cash_flows.size());
+    }
+
+    // Unchecked kernel over raw buffers (n ≥ 1, discount_rate > -1)
+    static double accumulate(double discount_rate, const std::int64_t* dates, const double* cash_flows,
+                             std::size_t n) noexcept {
+        const double log_discount = -std::log1p(discount_rate) / DayCount::kDaysPerYear;
+        typename DayCount::Counter counter(dates[0]);
+        double pv = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            pv += cash_flows[i] * std::exp(log_discount * static_cast<double>(counter.days(dates[i])));
+        }
+        return pv;
+    }
+};
+
+#endif // DATEDPRESENTVALUE_HPP
@@ -0,0 +1,132 @@
+#ifndef DISCOUNTFACTORCACHE_HPP
+#define DISCOUNTFACTORCACHE_HPP
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+// ===========================================================================
+// DiscountFactorCache
+// ===========================================================================
+// Discount-factor tables df_t = (1 + r)^-(t+1), kept per discount rate so
+// that repeated PVs at the same rates reduce to a dot product:
+//   PV = Σ CF_t · df_t
+//   • Tables are built lazily and only ever extended: a longer stream at a
+//     cached rate computes just the missing factors
+//   • At most max_rates (≥ 1) tables are kept; the least recently used rate is
+//     dropped to make room for a new one
+//   • Rates are matched by value (bit pattern, with -0.0 == 0.0), so only
+//     exactly repeated rates hit
+//   • Every factor is 1 / std::pow(1 + r, t + 1), as in PresentValuePolicy
+//
+// Not thread-safe: one cache per thread (or per calculator handle). Only
+// find() may run on several threads at once, and only while no thread
+// calls factors() or clear().
+//
+// Example Usage:
+//   DiscountFactorCache cache(16);
+//   std::span<const double> df = cache.factors(0.05, cash_flows.size());
+//   double pv = simd::dot(cash_flows.data(), df.data(), df.size());
+// ===========================================================================
+
+class DiscountFactorCache {
+public:
+    struct Stats {
+        std::size_t hits = 0;        // lookups served from an existing table
+        std::size_t misses = 0;      // lookups that built or extended a table
+        std::size_t evictions = 0;   // tables dropped for a new rate
+        std::size_t rates = 0;       // tables currently held
+        std::size_t factors = 0;     // discount factors currently held
+    };
+
+    explicit DiscountFactorCache(std::size_t max_rates) : max_rates_(max_rates) {}
+
+    std::size_t max_rates() const { return max_rates_; }
+
+    // ========================================================================
+    // Factors df_0 .. df_{n-1} for discount_rate (> -1, checked by caller).
+    // The view stays valid until the next call to factors() or clear().
+    // ========================================================================
+    std::span<const double> factors(double discount_rate, std::size_t n) {
+        const std::uint64_t key = std::bit_cast<std::uint64_t>(discount_rate + 0.0);
+
+        const auto found = index_.find(key);
+        if (found != index_.end()) {
+            lru_.splice(lru_.begin(), lru_, found->second);
+        } else {
+            if (lru_.size() >= max_rates_ && !lru_.empty()) {
+                stats_.factors -= lru_.back().df.size();
+                index_.erase(lru_.back().key);
+                lru_.pop_back();
+                ++stats_.evictions;
+            }
+            lru_.push_front(Entry{key, discount_rate, {}});
+            index_.emplace(key, lru_.begin());
+        }
+
+        Entry& entry = lru_.front();
+        if (entry.df.size() >= n) {
+            ++stats_.hits;
+        } else {
+            ++stats_.misses;
+            extend(entry, n);
+        }
+        return {entry.df.data(), n};
+    }
+
+    // ========================================================================
+    // Factors df_0 .. df_{n-1} if a table for discount_rate already holds
+    // them, else an empty view. Touches neither the LRU order nor the
+    // counters, so several threads may call it at once provided nothing
+    // calls factors() or clear() meanwhile.
+    // ========================================================================
+    std::span<const double> find(double discount_rate, std::size_t n) const {
+        const auto found = index_.find(std::bit_cast<std::uint64_t>(discount_rate + 0.0));
+        if (found == index_.end() || found->second->df.size() < n) {
+            return {};
+        }
+        return {found->second->df.data(), n};
+    }
+
+    Stats stats() const {
+        Stats s = stats_;
+        s.rates = lru_.size();
+        return s;
+    }
+
+    // Drop every table and reset the counters
+    void clear() {
+        lru_.clear();
+        index_.clear();
+        stats_ = Stats{};
+    }
+
+private:
+    struct Entry {
+        std::uint64_t key;
+        double rate;
+        std::vector<double> df;
+    };
+
+    void extend(Entry& entry, std::size_t n) {
+        const double base = 1.0 + entry.rate;
+        const std::size_t old_size = entry.df.size();
+        entry.df.resize(n);
+        for (std::size_t t = old_size; t < n; ++t) {
+            entry.df[t] = 1.0 / std::pow(base, static_cast<double>(t) + 1.0);
+        }
+        stats_.factors += n - old_size;
+    }
+
+    std::size_t max_rates_;
+    std::list<Entry> lru_;  // most recently used first
+    std::unordered_map<std::uint64_t, std::list<Entry>::iterator> index_;
+    Stats stats_;
+};
+
+#endif // DISCOUNTFACTORCACHE_HPP
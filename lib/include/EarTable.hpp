@@ -0,0 +1,178 @@
+#ifndef EARTABLE_HPP
+#define EARTABLE_HPP
+
+#include "CalculationPolicies.hpp"
+#include "ErrorPolicies.hpp"
+#include "SimdKernels.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ===========================================================================
+// EAR Lookup Table
+// ===========================================================================
+// EAR = (1 + r/n)^n - 1 tabulated for one compounding frequency n on a
+// 0.01bp rate grid, for rate feeds that convert millions of quotes at a few
+// standard frequencies.
+//   • Node k holds the grid rate r_k = k / 10^6 (correctly rounded, i.e. the
+//     double a parsed quote holds), InterestRateConversionPolicy's EAR at
+//     r_k, and the first and half the second derivative there
+//   • A rate in [min_rate, max_rate] is read off its nearest node as
+//     EAR(r_k) + d·(EAR'(r_k) + d·EAR''(r_k)/2), d = r - r_k, |d| ≤ 0.5e-6.
+//     On the grid d = 0 and the node's EAR comes back bit for bit; between
+//     grid points the dropped cubic term is below 1e-19, so the result is
+//     within the policy's own rounding error of InterestRateConversionPolicy
+//   • Rates outside the table (and NaN) go to InterestRateConversionPolicy
+//
+// convert() over an array gathers the nodes with AVX-512F / AVX2 (runtime
+// dispatch as in SimdKernels.hpp; SSE2 runs the scalar loop). Off-grid
+// results may differ between ISAs in the last bit (fused vs. separate
+// multiply-add).
+//
+// A table is immutable once built and can be shared across threads.
+// standard() builds the tables of the standard frequencies lazily, once per
+// process; build_standard() at startup keeps the build (a few ms and 11 MB
+// per table) off the first conversion, after which no lookup allocates.
+//
+// Example Usage:
+//   EarTable::build_standard();  // at startup
+//   const EarTable* monthly = EarTable::standard(12);
+//   monthly->convert(quotes.data(), quotes.size(), ears.data());
+//
+//   Calculator<TabulatedInterestRateConversionPolicy> ir_calc;
+//   double ear = ir_calc.calculate(0.0523, 365);
+//   ir_calc.calculate_batch(quotes, 365, ears);
+// ===========================================================================
+
+class EarTable {
+public:
+    struct Node {
+        double rate;
+        double ear;
+        double slope;           // dEAR/dr
+        double half_curvature;  // d²EAR/dr² / 2
+    };
+
+    // Grid points per unit of rate (0.01bp spacing)
+    static constexpr double kGridStepsPerUnit = 1e6;
+
+    // Default range: every rate a feed quotes in practice (350001 nodes,
+    // 11 MB per frequency)
+    static constexpr double kDefaultMinRate = -0.05;
+    static constexpr double kDefaultMaxRate = 0.30;
+
+    // Largest table accepted (512 MB; keeps gather indices in 32 bits)
+    static constexpr std::size_t kMaxNodes = std::size_t{1} << 24;
+
+    // Frequencies with a shared table (standard())
+    static constexpr int kStandardFrequencies[] = {2, 4, 12, 52, 360, 365};
+
+    // Nodes run from the grid point nearest min_rate to the one nearest
+    // max_rate. Throws std::invalid_argument unless compounding_periods > 0,
+    // -1 < min_rate < max_rate and the range spans at most kMaxNodes points
+    explicit EarTable(int compounding_periods, double min_rate = kDefaultMinRate,
+                      double max_rate = kDefaultMaxRate);
+
+    int compounding_periods() const noexcept { return compounding_periods_; }
+    double min_rate() const noexcept { return nodes_.front().rate; }
+    double max_rate() const noexcept { return nodes_.back().rate; }
+    std::span<const Node> nodes() const noexcept { return nodes_; }
+
+    // EAR of one rate (> -1, unchecked)
+    double convert(double nominal_rate) const noexcept {
+        const double offset = std::nearbyint(nominal_rate * kGridStepsPerUnit) - first_index_;
+        if (!(offset >= 0.0 && offset < node_count_)) {
+            return InterestRateConversionPolicy::evaluate(nominal_rate, compounding_periods_);
+        }
+        const Node& node = nodes_[static_cast<std::size_t>(offset)];
+        const double d = nominal_rate - node.rate;
+        return node.ear + d * (node.slope + d * node.half_curvature);
+    }
+
+    // results[i] = EAR of nominal_rates[i] (each > -1, unchecked) using the
+    // detected path
+    void convert(const double* nominal_rates, std::size_t n, double* results) const noexcept;
+
+    // Array conversion forcing a specific path (must satisfy isa_supported)
+    void convert(simd::Isa isa, const double* nominal_rates, std::size_t n, double* results) const noexcept;
+
+    // Shared table (default range) for n = 2, 4, 12, 52, 360 or 365, built on
+    // first use; nullptr for any other frequency (n = 1 needs none: EAR = r)
+    // or if the table cannot be allocated
+    static const EarTable* standard(int compounding_periods) noexcept;
+
+    // Builds every standard table now; false if one could not be allocated
+    // (that frequency then computes exactly, and is not retried)
+    static bool build_standard() noexcept;
+
+private:
+    int compounding_periods_;
+    double first_index_;  // grid index of nodes_[0]
+    double node_count_;
+    std::vector<Node> nodes_;
+};
+
+// ===========================================================================
+// TabulatedInterestRateConversionPolicy
+// InterestRateConversionPolicy semantics read from EarTable::standard, plus
+// a batch form for one compounding frequency. Other frequencies compute
+// exactly.
+//   • calculate_batch validates everything before writing any result and
+//     throws std::invalid_argument naming the first bad element
+//   • Scalar and batch calls agree exactly on the grid (and everywhere on
+//     a scalar build)
+// ===========================================================================
+struct TabulatedInterestRateConversionPolicy {
+    static constexpr CalcError validate(double nominal_rate, int compounding_periods) noexcept {
+        return InterestRateConversionPolicy::validate(nominal_rate, compounding_periods);
+    }
+
+    static double calculate(double nominal_rate, int compounding_periods) {
+        throw_on_error(validate(nominal_rate, compounding_periods));
+        return evaluate(nominal_rate, compounding_periods);
+    }
+
+    // Unchecked body (validate() passed)
+    static double evaluate(double nominal_rate, int compounding_periods) noexcept {
+        if (const EarTable* table = EarTable::standard(compounding_periods)) {
+            return table->convert(nominal_rate);
+        }
+        return InterestRateConversionPolicy::evaluate(nominal_rate, compounding_periods);
+    }
+
+    static void calculate_batch(std::span<const double> nominal_rates, int compounding_periods,
+                                std::span<double> results) {
+        const std::size_t n = nominal_rates.size();
+        if (results.size() != n) {
+            throw std::invalid_argument("nominal_rates and results must have the same length");
+        }
+        if (compounding_periods <= 0) {
+            throw_on_error(CalcError::CompoundingPeriods);
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            if (const char* error = error_message(validate(nominal_rates[i], compounding_periods))) {
+                throw std::invalid_argument("element " + std::to_string(i) + ": " + error);
+            }
+        }
+
+        evaluate_batch(nominal_rates.data(), n, compounding_periods, results.data());
+    }
+
+    // Unchecked batch body (every element passes validate())
+    static void evaluate_batch(const double* nominal_rates, std::size_t n, int compounding_periods,
+                               double* results) noexcept {
+        if (const EarTable* table = EarTable::standard(compounding_periods)) {
+            table->convert(nominal_rates, n, results);
+            return;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            results[i] = InterestRateConversionPolicy::evaluate(nominal_rates[i], compounding_periods);
+        }
+    }
+};
+
+#endif // EARTABLE_HPP
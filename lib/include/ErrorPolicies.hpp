@@ -0,0 +1,172 @@
+#ifndef ERRORPOLICIES_HPP
+#define ERRORPOLICIES_HPP
+
+#include <cstddef>
+#include <stdexcept>
+
+// ===========================================================================
+// CalcError
+// ===========================================================================
+// Why a policy rejected its arguments. Values match the CALC_STATUS_*
+// codes in calculator_c_api.h; error_message() gives the text the throwing
+// path puts in std::invalid_argument (nullptr for None).
+// ===========================================================================
+
+enum class CalcError : int {
+    None = 0,
+    DiscountRate = 1,        // discount_rate <= -1
+    EmptyCashFlows = 2,
+    Principal = 3,           // principal < 0
+    InterestRate = 4,        // interest_rate <= -1
+    Periods = 5,             // periods < 0
+    NominalRate = 6,         // nominal_rate <= -1
+    CompoundingPeriods = 7,  // compounding_periods <= 0
+    Offsets = 8,             // CSR offsets decrease
+    // 9 is CALC_STATUS_NULL_POINTER (C API only)
+    SignChange = 10,         // cash flows all of one sign (IRR)
+    Guess = 11,              // IRR guess <= -1
+    IrrNotFound = 12,        // no IRR reached from the guess
+    Face = 13,               // bond face <= 0
+    CouponRate = 14,         // bond coupon_rate < 0
+    BondPeriods = 15,        // bond periods < 1
+    Frequency = 16,          // bond frequency < 1
+    Yield = 17,              // yield <= -frequency
+    Price = 18,              // price <= 0
+    YieldNotFound = 19,      // yield to maturity did not converge
+    DateCount = 20,          // dates (or times) and cash_flows differ in length
+    NegativeTime = 21,       // payment time < 0
+};
+
+constexpr const char* error_message(CalcError error) noexcept {
+    switch (error) {
+        case CalcError::None:               return nullptr;
+        case CalcError::DiscountRate:       return "discount_rate must be > -1";
+        case CalcError::EmptyCashFlows:     return "cash_flows must not be empty";
+        case CalcError::Principal:          return "principal must be >= 0";
+        case CalcError::InterestRate:       return "interest_rate must be > -1";
+        case CalcError::Periods:            return "periods must be >= 0";
+        case CalcError::NominalRate:        return "nominal_rate must be > -1";
+        case CalcError::CompoundingPeriods: return "compounding_periods must be > 0";
+        case CalcError::Offsets:            return "offsets must be non-decreasing";
+        case CalcError::SignChange:         return "cash_flows must change sign";
+        case CalcError::Guess:              return "guess must be > -1";
+        case CalcError::IrrNotFound:        return "IRR not found: no sign change of PV over rates > -1";
+        case CalcError::Face:               return "face must be > 0";
+        case CalcError::CouponRate:         return "coupon_rate must be >= 0";
+        case CalcError::BondPeriods:        return "periods must be >= 1";
+        case CalcError::Frequency:          return "frequency must be >= 1";
+        case CalcError::Yield:              return "yield must be > -frequency";
+        case CalcError::Price:              return "price must be > 0";
+        case CalcError::YieldNotFound:      return "yield_to_maturity did not converge";
+        case CalcError::DateCount:          return "dates and cash_flows must have the same length";
+        case CalcError::NegativeTime:              return "times must be >= 0";
+    }
+    return "unknown error";
+}
+
+// Throwing side of a validate(): std::invalid_argument with the message.
+// In a constant expression an invalid argument is a compile error instead.
+constexpr void throw_on_error(CalcError error) {
+    if (error != CalcError::None) {
+        throw std::invalid_argument(error_message(error));
+    }
+}
+
+// Argument check shared by every periodic PV policy
+constexpr CalcError present_value_error(double discount_rate, std::size_t n_cash_flows) noexcept {
+    if (discount_rate <= -1.0) {
+        return CalcError::DiscountRate;
+    }
+    if (n_cash_flows == 0) {
+        return CalcError::EmptyCashFlows;
+    }
+    return CalcError::None;
+}
+
+// ===========================================================================
+// Expected<T>
+// ===========================================================================
+// A result or the CalcError that prevented it (std::expected<T, CalcError>
+// in spirit; this tree builds as C++20). T must be default-constructible.
+//
+// Example Usage:
+//   Expected<double> pv = status_calc.calculate(rate, cash_flows);
+//   if (!pv) { log(error_message(pv.error())); }
+//   double value = pv.value_or(0.0);
+// ===========================================================================
+
+template <typename T>
+class Expected {
+public:
+    constexpr Expected(T value) noexcept : value_(value) {}
+    constexpr Expected(CalcError error) noexcept : error_(error) {}
+
+    constexpr bool has_value() const noexcept { return error_ == CalcError::None; }
+    constexpr explicit operator bool() const noexcept { return has_value(); }
+    constexpr CalcError error() const noexcept { return error_; }
+
+    // Unchecked access (has_value() must hold)
+    constexpr const T& operator*() const noexcept { return value_; }
+    constexpr const T* operator->() const noexcept { return &value_; }
+
+    // Checked access: throws what the throwing policy would have
+    constexpr const T& value() const {
+        if (!has_value()) {
+            throw std::invalid_argument(error_message(error_));
+        }
+        return value_;
+    }
+
+    constexpr T value_or(T fallback) const noexcept { return has_value() ? value_ : fallback; }
+
+private:
+    T value_{};
+    CalcError error_ = CalcError::None;
+};
+
+// T, or the value type of an Expected<T> (a solver's evaluate can fail)
+template <typename T>
+struct ExpectedValue { using type = T; };
+
+template <typename T>
+struct ExpectedValue<Expected<T>> { using type = T; };
+
+// ===========================================================================
+// Error Policies (second template parameter of Calculator)
+// ===========================================================================
+// ThrowingErrorPolicy (default): calls Policy::calculate, which throws
+//   std::invalid_argument on bad input. Works with every policy.
+// StatusErrorPolicy: calls Policy::validate and, when it passes,
+//   Policy::evaluate (the unchecked body), returning Expected<T>. No
+//   exception is thrown or caught, so invalid inputs cost a compare and a
+//   branch instead of an unwind. Needs a policy with that pair: the PV
+//   family (run-length and curve PV included), FV, EAR, the sensitivity
+//   policy, XNPV, bond prices and IRR.
+//   A solver's evaluate may itself fail (IRR: no root); it returns
+//   Expected<T>, passed through as is.
+//
+// Example Usage:
+//   Calculator<PresentValuePolicy, StatusErrorPolicy> pv_calc;
+//   Expected<double> pv = pv_calc.calculate(-2.0, cash_flows);  // no throw
+//   pv.error() == CalcError::DiscountRate
+// ===========================================================================
+
+struct ThrowingErrorPolicy {
+    template <typename Policy, typename... Args>
+    static constexpr auto call(const Args&... args) {
+        return Policy::calculate(args...);
+    }
+};
+
+struct StatusErrorPolicy {
+    template <typename Policy, typename... Args>
+    static constexpr auto call(const Args&... args) noexcept(noexcept(Policy::evaluate(args...)))
+        -> Expected<typename ExpectedValue<decltype(Policy::evaluate(args...))>::type> {
+        if (const CalcError error = Policy::validate(args...); error != CalcError::None) {
+            return error;
+        }
+        return Policy::evaluate(args...);
+    }
+};
+
+#endif // ERRORPOLICIES_HPP
@@ -0,0 +1,293 @@
+#ifndef INTERNALRATEOFRETURN_HPP
+#define INTERNALRATEOFRETURN_HPP
+
+#include "ErrorPolicies.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+// ===========================================================================
+// InternalRateOfReturnPolicy
+// ===========================================================================
+// IRR of a periodic stream: the rate r > -1 at which PresentValuePolicy's
+// PV is zero,
+//   PV(r) = Σ CF_t / (1 + r)^(t+1) = 0
+// (equivalently Σ CF_t / (1 + r)^t = 0: the extra factor has no roots).
+//
+// Each iteration evaluates PV, dPV/dr and d²PV/dr² in one fused Horner pass
+// over the cash flows (evaluate_pv()), so a step costs one sweep, not three.
+//   1. Halley steps from the caller's guess (warm start: a guess near the
+//      answer, e.g. yesterday's IRR, converges in two or three steps)
+//   2. If Halley leaves the domain or stalls, PV is sampled on a fixed
+//      rate grid, the sign change nearest the guess is taken as a bracket
+//      and the root is polished by Newton steps that fall back to
+//      bisection whenever a step would leave the bracket
+// A stream whose PV changes sign more than once has several IRRs; the one
+// found is the one reached from the guess.
+//
+// Throws std::invalid_argument on bad input (empty stream, no sign change
+// in the cash flows, guess ≤ -1) and std::domain_error when no root is found.
+// Under StatusErrorPolicy both come back as CalcError codes, the latter as
+// CalcError::IrrNotFound.
+//
+// Example Usage:
+//   Calculator<InternalRateOfReturnPolicy> irr_calc;
+//   double irr = irr_calc.calculate(std::vector<double>{-1000.0, 300.0, 400.0, 500.0}, 0.1);
+//
+//   Calculator<InternalRateOfReturnPolicy, StatusErrorPolicy> status_calc;
+//   Expected<double> irr = status_calc.calculate(cash_flows, 0.1);
+// ===========================================================================
+
+struct IrrOptions {
+    double tolerance = 1e-12;   // converged when |step| ≤ tolerance · max(1, |r|)
+    int max_iterations = 100;   // per phase (Halley, then bracketed Newton)
+};
+
+struct IrrSolution {
+    double rate;
+    int iterations;  // PV evaluations
+};
+
+struct InternalRateOfReturnPolicy {
+    static constexpr double kDefaultGuess = 0.1;
+
+    // Halley steps before falling back to the bracket (it converges in a
+    // handful when it converges at all)
+    static constexpr int kHalleyIterations = 20;
+
+    // Bracket search grid. Off round numbers, so that typical roots (10%,
+    // 20%, ...) fall strictly between two points instead of on one
+    static constexpr std::array<double, 27> kBracketGrid = {
+        -0.999, -0.99, -0.9, -0.7, -0.5, -0.3, -0.15, -0.05, 0.003, 0.03, 0.07, 0.12, 0.17, 0.25,
+        0.4, 0.6, 0.8, 1.1, 1.5, 2.2, 3.3, 5.5, 11.0, 33.0, 110.0, 1.1e3, 1.1e4,
+    };
+
+    // PV and its first two derivatives with respect to the rate
+    struct Evaluation {
+        double pv;
+        double dpv;
+        double d2pv;
+    };
+
+    // ========================================================================
+    // Fused evaluation (n ≥ 1, rate > -1). With v = 1 / (1 + r) the PV is
+    // the polynomial g(v) = Σ CF_t v^(t+1); one Horner pass yields g, g'
+    // and g''/2, and the chain rule (dv/dr = -v²) gives the rate derivatives.
+    // ========================================================================
+    static Evaluation evaluate_pv(double rate, const double* cash_flows, std::size_t n) noexcept {
+        const double v = 1.0 / (1.0 + rate);
+        double p = cash_flows[n - 1];
+        double d1 = 0.0;
+        double d2 = 0.0;
+        for (std::size_t t = n - 1; t-- > 0;) {
+            d2 = d2 * v + d1;
+            d1 = d1 * v + p;
+            p = p * v + cash_flows[t];
+        }
+        // Constant term of g is zero
+        d2 = d2 * v + d1;
+        d1 = d1 * v + p;
+        p = p * v;
+
+        const double v2 = v * v;
+        return {p, -v2 * d1, 2.0 * v2 * v * (v * d2 + d1)};
+    }
+
+    // Why the stream has no IRR to look for from the guess
+    static CalcError validate(std::span<const double> cash_flows, double guess) noexcept {
+        return validate(cash_flows.data(), cash_flows.size(), guess);
+    }
+
+    static CalcError validate(const double* cash_flows, std::size_t n, double guess) noexcept {
+        if (n == 0) {
+            return CalcError::EmptyCashFlows;
+        }
+        bool positive = false;
+        bool negative = false;
+        for (std::size_t t = 0; t < n; ++t) {
+            positive = positive || cash_flows[t] > 0.0;
+            negative = negative || cash_flows[t] < 0.0;
+        }
+        if (!(positive && negative)) {
+            return CalcError::SignChange;
+        }
+        if (!(guess > -1.0) || !std::isfinite(guess)) {
+            return CalcError::Guess;
+        }
+        return CalcError::None;
+    }
+
+    static double calculate(std::span<const double> cash_flows, double guess = kDefaultGuess) {
+        return solve(cash_flows.data(), cash_flows.size(), guess).rate;
+    }
+
+    // Unchecked body (validate() passed): the IRR, or CalcError::IrrNotFound
+    static Expected<double> evaluate(std::span<const double> cash_flows, double guess) noexcept {
+        const Expected<IrrSolution> solution = search(cash_flows.data(), cash_flows.size(), guess, {});
+        if (!solution) {
+            return solution.error();
+        }
+        return solution->rate;
+    }
+
+    static IrrSolution solve(const double* cash_flows, std::size_t n, double guess,
+                             const IrrOptions& options = {}) {
+        throw_on_error(validate(cash_flows, n, guess));
+        const Expected<IrrSolution> solution = search(cash_flows, n, guess, options);
+        if (!solution) {
+            throw std::domain_error(error_message(solution.error()));
+        }
+        return *solution;
+    }
+
+    // Unchecked solver (validate() passed): the root reached from the guess,
+    // or CalcError::IrrNotFound
+    static Expected<IrrSolution> search(const double* cash_flows, std::size_t n, double guess,
+                                        const IrrOptions& options) noexcept {
+        IrrSolution solution{guess, 0};
+        if (halley(cash_flows, n, options, solution)) {
+            return solution;
+        }
+        if (bracketed_newton(cash_flows, n, guess, options, solution)) {
+            return solution;
+        }
+        return CalcError::IrrNotFound;
+    }
+
+private:
+    static bool converged(double step, double rate, double tolerance) {
+        return std::fabs(step) <= tolerance * std::fmax(1.0, std::fabs(rate));
+    }
+
+    // Halley from solution.rate; false if it leaves the domain or stops
+    // contracting (a step no shorter than the one before: from a guess on
+    // the far side of PV's extremum the iterates run off towards +inf)
+    static bool halley(const double* cash_flows, std::size_t n, const IrrOptions& options,
+                       IrrSolution& solution) {
+        double r = solution.rate;
+        double previous_step = INFINITY;
+        const int limit = options.max_iterations < kHalleyIterations ? options.max_iterations : kHalleyIterations;
+        for (int i = 0; i < limit; ++i) {
+            const Evaluation e = evaluate_pv(r, cash_flows, n);
+            ++solution.iterations;
+            if (e.pv == 0.0) {
+                solution.rate = r;
+                return true;
+            }
+            const double denominator = 2.0 * e.dpv * e.dpv - e.pv * e.d2pv;
+            const double step = denominator != 0.0 ? -2.0 * e.pv * e.dpv / denominator : -e.pv / e.dpv;
+            if (!std::isfinite(step) || !(std::fabs(step) < previous_step)) {
+                return false;
+            }
+            double next = r + step;
+            if (next > kBracketGrid.back()) {
+                return false;  // running off to +inf, where PV → 0
+            }
+            if (next <= -1.0) {
+                next = 0.5 * (r - 1.0);  // halfway to the pole at -1
+            }
+            if (converged(next - r, next, options.tolerance)) {
+                solution.rate = next;
+                return true;
+            }
+            previous_step = std::fabs(next - r);
+            r = next;
+        }
+        return false;
+    }
+
+    // Sign change of PV nearest the guess on a fixed grid, then Newton
+    // safeguarded by bisection inside it. Grid intervals are visited in
+    // order of distance from the guess and PV is sampled lazily, so a
+    // bracket next to the guess costs a few evaluations, not the whole grid.
+    static bool bracketed_newton(const double* cash_flows, std::size_t n, double guess,
+                                 const IrrOptions& options, IrrSolution& solution) {
+        constexpr std::size_t kPoints = kBracketGrid.size();
+        std::array<double, kPoints> f;
+        std::array<bool, kPoints> sampled{};
+        const auto sample = [&](std::size_t k) {
+            if (!sampled[k]) {
+                f[k] = evaluate_pv(kBracketGrid[k], cash_flows, n).pv;
+                sampled[k] = true;
+                ++solution.iterations;
+            }
+            return f[k];
+        };
+        const auto distance = [&](std::size_t k) {  // interval [grid[k], grid[k + 1]]
+            return guess < kBracketGrid[k] ? kBracketGrid[k] - guess
+                                           : (guess > kBracketGrid[k + 1] ? guess - kBracketGrid[k + 1] : 0.0);
+        };
+
+        // Intervals left of the guess are below..0, right of it above..kPoints - 2
+        std::size_t above = 0;
+        while (above + 2 < kPoints && kBracketGrid[above + 1] < guess) {
+            ++above;
+        }
+        std::size_t below = above;  // one past the next left interval
+        double lo = 0.0;
+        double hi = 0.0;
+        double f_lo = 0.0;
+        bool found = false;
+        while (!found && (below > 0 || above + 1 < kPoints)) {
+            std::size_t k;
+            if (above + 1 < kPoints && (below == 0 || distance(above) <= distance(below - 1))) {
+                k = above++;
+            } else {
+                k = --below;
+            }
+            const double a = sample(k);
+            const double b = sample(k + 1);
+            if (a == 0.0 || b == 0.0) {
+                solution.rate = a == 0.0 ? kBracketGrid[k] : kBracketGrid[k + 1];
+                return true;
+            }
+            if (std::isfinite(a) && std::isfinite(b) && (a < 0.0) != (b < 0.0)) {
+                lo = kBracketGrid[k];
+                hi = kBracketGrid[k + 1];
+                f_lo = a;
+                found = true;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+
+        // Orient so PV(neg) < 0 < PV(pos)
+        double neg = f_lo < 0.0 ? lo : hi;
+        double pos = f_lo < 0.0 ? hi : lo;
+        double r = 0.5 * (lo + hi);
+        double step_before = hi - lo;
+        double step = step_before;
+        Evaluation e = evaluate_pv(r, cash_flows, n);
+        ++solution.iterations;
+        for (int i = 0; i < options.max_iterations; ++i) {
+            const bool newton_leaves = ((r - pos) * e.dpv - e.pv) * ((r - neg) * e.dpv - e.pv) > 0.0;
+            const bool newton_slow = std::fabs(2.0 * e.pv) > std::fabs(step_before * e.dpv);
+            step_before = step;
+            if (newton_leaves || newton_slow) {
+                step = 0.5 * (pos - neg);
+                r = neg + step;
+            } else {
+                step = e.pv / e.dpv;
+                r -= step;
+            }
+            if (converged(step, r, options.tolerance)) {
+                solution.rate = r;
+                return true;
+            }
+            e = evaluate_pv(r, cash_flows, n);
+            ++solution.iterations;
+            if (e.pv == 0.0) {
+                solution.rate = r;
+                return true;
+            }
+            (e.pv < 0.0 ? neg : pos) = r;
+        }
+        return false;
+    }
+};
+
+#endif // INTERNALRATEOFRETURN_HPP
@@ -0,0 +1,145 @@
+#ifndef MATRIXPRESENTVALUE_HPP
+#define MATRIXPRESENTVALUE_HPP
+
+#include "SimdKernels.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+// ===========================================================================
+// Matrix Present Value
+// ===========================================================================
+// PVs of many cash-flow streams against one or many discount-factor vectors
+// (curves) in one call, as a matrix product:
+//   PV[s][c] = Σ_t CF[s][t] · DF[c][t]        i.e. PV = CF · DFᵀ
+// One curve is a matrix-vector product (GEMV), several a GEMM.
+//
+// Both inputs are row-major with period t contiguous; row r starts at
+// data + r·stride, so rows may be padded (stride ≥ cols). Padding is never
+// read. Rows padded to padded_stride(cols) and a 64-byte aligned base keep
+// every row on cache-line boundaries.
+//
+// The kernel is cache-blocked and register-tiled:
+//   • curves are cut into kMatrixBlockCurves blocks and, when a block of
+//     curves exceeds kMatrixCacheDoubles, periods into kMatrixBlockPeriods
+//     blocks, so the discount factors in use stay in L2 while every stream
+//     passes over them
+//   • each micro-kernel call keeps an MR × NR tile of PVs in vector
+//     registers (AVX-512: 4 × 4, AVX2: 4 × 2), loading each cash-flow and
+//     discount-factor vector once per tile
+//   • period tails use masked loads, edge rows / curves narrower tiles
+//
+// Runtime dispatch as in SimdKernels.hpp (AVX-512F > AVX2 + FMA > scalar;
+// SSE2 runs the scalar tiles). Results depend only on the shapes and the
+// ISA, not on strides or alignment, and may differ between ISAs in the
+// last bits.
+//
+// Example Usage:
+//   ConstMatrixView cf{flows.data(), n_streams, n_periods, n_periods};
+//   std::vector<double> df = MatrixPresentValuePolicy::discount_factors(0.05, n_periods);
+//   std::vector<double> pv(n_streams);
+//   Calculator<MatrixPresentValuePolicy> calc;
+//   calc.calculate_matrix(cf, ConstMatrixView{df.data(), 1, n_periods, n_periods}, pv);
+// ===========================================================================
+
+struct ConstMatrixView {
+    const double* data = nullptr;
+    std::size_t rows = 0;
+    std::size_t cols = 0;
+    std::size_t stride = 0;  // elements between row starts (≥ cols)
+};
+
+// Periods per cache block (2 KiB of each row)
+inline constexpr std::size_t kMatrixBlockPeriods = 256;
+
+// Curves per cache block (≤ 128 KiB of discount factors per period block)
+inline constexpr std::size_t kMatrixBlockCurves = 64;
+
+// Discount factors (128 KiB) below which periods are not blocked at all
+inline constexpr std::size_t kMatrixCacheDoubles = 16384;
+
+// Row stride (in doubles) that keeps rows of cols periods 64-byte aligned
+constexpr std::size_t padded_stride(std::size_t cols) {
+    return (cols + 7) / 8 * 8;
+}
+
+namespace simd {
+
+// Unchecked PV = CF · DFᵀ using the detected path. results is
+// cash_flows.rows × discount_factors.rows, row-major with results_stride;
+// both inputs must have the same (non-zero) number of columns.
+void present_value_matrix(const ConstMatrixView& cash_flows, const ConstMatrixView& discount_factors,
+                          double* results, std::size_t results_stride) noexcept;
+
+// Unchecked matrix PV forcing a specific path (must satisfy isa_supported)
+void present_value_matrix(Isa isa, const ConstMatrixView& cash_flows,
+                          const ConstMatrixView& discount_factors,
+                          double* results, std::size_t results_stride) noexcept;
+
+} // namespace simd
+
+// ===========================================================================
+// MatrixPresentValuePolicy
+// Checked front end of the matrix kernel. results is n_streams × n_curves,
+// row-major and dense. Throws std::invalid_argument on bad shapes.
+// ===========================================================================
+struct MatrixPresentValuePolicy {
+    // Reason the shapes are invalid, or nullptr
+    static const char* check(const ConstMatrixView& cash_flows,
+                             const ConstMatrixView& discount_factors,
+                             std::size_t n_results) noexcept {
+        if (cash_flows.cols == 0) {
+            return "cash_flows must not be empty";
+        }
+        if (discount_factors.cols != cash_flows.cols) {
+            return "cash_flows and discount_factors must have the same number of periods";
+        }
+        if (cash_flows.stride < cash_flows.cols || discount_factors.stride < discount_factors.cols) {
+            return "row stride must be >= number of periods";
+        }
+        if ((cash_flows.rows != 0 && !cash_flows.data)
+            || (discount_factors.rows != 0 && !discount_factors.data)) {
+            return "matrix data must not be null";
+        }
+        if (n_results != cash_flows.rows * discount_factors.rows) {
+            return "results must hold n_streams * n_curves values";
+        }
+        return nullptr;
+    }
+
+    static void calculate_matrix(const ConstMatrixView& cash_flows,
+                                 const ConstMatrixView& discount_factors,
+                                 std::span<double> results) {
+        if (const char* error = check(cash_flows, discount_factors, results.size())) {
+            throw std::invalid_argument(error);
+        }
+        evaluate(cash_flows, discount_factors, results);
+    }
+
+    // Unchecked body (check() passed)
+    static void evaluate(const ConstMatrixView& cash_flows, const ConstMatrixView& discount_factors,
+                         std::span<double> results) {
+        if (results.empty()) {
+            return;
+        }
+        simd::present_value_matrix(cash_flows, discount_factors, results.data(), discount_factors.rows);
+    }
+
+    // Flat-rate curve: df_t = (1 + r)^-(t+1), as in PresentValuePolicy
+    static std::vector<double> discount_factors(double discount_rate, std::size_t n_periods) {
+        if (discount_rate <= -1.0) {
+            throw std::invalid_argument("discount_rate must be > -1");
+        }
+        std::vector<double> df(n_periods);
+        const double base = 1.0 + discount_rate;
+        for (std::size_t t = 0; t < n_periods; ++t) {
+            df[t] = 1.0 / std::pow(base, static_cast<double>(t) + 1.0);
+        }
+        return df;
+    }
+};
+
+#endif // MATRIXPRESENTVALUE_HPP
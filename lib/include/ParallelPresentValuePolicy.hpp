@@ -0,0 +1,86 @@
+#ifndef PARALLELPRESENTVALUEPOLICY_HPP
+#define PARALLELPRESENTVALUEPOLICY_HPP
+
+#include "SimdKernels.hpp"
+#include "ThreadPool.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+// ===========================================================================
+// ParallelPresentValuePolicy
+// PresentValuePolicy semantics for very long streams, split over the shared
+// ThreadPool. The stream is cut into fixed kChunkPeriods-period chunks:
+//   PV = Σ_c v^(s_c) · PV_c      (s_c = first period index of chunk c)
+// where PV_c is the chunk priced on its own as if it started at t = 1.
+//   • Chunk boundaries depend only on the stream length, and the partials
+//     are summed in chunk order, so the result does not depend on the
+//     thread count or on scheduling
+//   • Streams of at most kChunkPeriods periods run on the calling thread
+//     and match the serial SIMD policy bit for bit
+//   • Reproducible = true prices chunks with the fixed-order scalar kernel
+//     (bit-identical across CPUs as well as thread counts)
+// ===========================================================================
+template <bool Reproducible = false>
+struct BasicParallelPresentValuePolicy {
+    // ~40 µs of SIMD work per chunk: well above the cost of claiming one,
+    // and a multiple of every kernel's anchor interval
+    static constexpr std::size_t kChunkPeriods = std::size_t{1} << 16;
+
+    static constexpr CalcError validate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        return present_value_error(discount_rate, cash_flows.size());
+    }
+
+    static double calculate(double discount_rate, std::span<const double> cash_flows) {
+        return calculate(discount_rate, cash_flows, 0);
+    }
+
+    // max_threads bounds the threads used, including the caller (0 = all)
+    static double calculate(double discount_rate, std::span<const double> cash_flows,
+                            std::size_t max_threads) {
+        throw_on_error(validate(discount_rate, cash_flows));
+        return evaluate(discount_rate, cash_flows, max_threads);
+    }
+
+    // Unchecked body (validate() passed); may throw std::bad_alloc
+    static double evaluate(double discount_rate, std::span<const double> cash_flows,
+                           std::size_t max_threads = 0) {
+        const double base = 1.0 + discount_rate;
+        const std::size_t n = cash_flows.size();
+        if (n <= kChunkPeriods) {
+            return chunk_value(base, cash_flows.data(), n);
+        }
+
+        const std::size_t n_chunks = (n + kChunkPeriods - 1) / kChunkPeriods;
+        std::vector<double> partials(n_chunks);
+        ThreadPool::instance().parallel_for(n_chunks, max_threads, [&](std::size_t chunk) {
+            const std::size_t start = chunk * kChunkPeriods;
+            const std::size_t len = (n - start < kChunkPeriods) ? n - start : kChunkPeriods;
+            const double scale = 1.0 / std::pow(base, static_cast<double>(start));
+            partials[chunk] = scale * chunk_value(base, cash_flows.data() + start, len);
+        });
+
+        double pv = 0.0;
+        for (const double partial : partials) {
+            pv += partial;
+        }
+        return pv;
+    }
+
+private:
+    static double chunk_value(double base, const double* cash_flows, std::size_t n) {
+        if constexpr (Reproducible) {
+            return simd::present_value_reproducible(base, cash_flows, n);
+        } else {
+            return simd::present_value(base, cash_flows, n);
+        }
+    }
+};
+
+using ParallelPresentValuePolicy = BasicParallelPresentValuePolicy<false>;
+using ReproducibleParallelPresentValuePolicy = BasicParallelPresentValuePolicy<true>;
+
+#endif // PARALLELPRESENTVALUEPOLICY_HPP
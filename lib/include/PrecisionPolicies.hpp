@@ -0,0 +1,158 @@
+#ifndef PRECISIONPOLICIES_HPP
+#define PRECISIONPOLICIES_HPP
+
+#include "CalculationPolicies.hpp"
+#include "ErrorPolicies.hpp"
+#include "SimdKernels.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+// ===========================================================================
+// Precision Policies
+// ===========================================================================
+// PV, FV and EAR with the floating-point type as a template parameter, for
+// callers that need less (or more) than double:
+//   float        bulk scenario generation (~6-7 significant digits). PV runs
+//                the single-precision SIMD kernel: twice the lanes and half
+//                the memory traffic of double. FV / EAR round the double
+//                result once (float inputs widen exactly).
+//   double       the default policies (SimdPresentValuePolicy,
+//                FutureValuePolicy, InterestRateConversionPolicy)
+//   long double  scalar reference paths (anchored recurrence, powl,
+//                expm1l / log1pl); no vector kernel
+//
+// MixedPrecisionPresentValuePolicy stores flows as float but discounts and
+// accumulates in double: the double kernel's accuracy on the stored values
+// at half the memory traffic.
+//
+// Validation matches the double policies, evaluated in Real; errors are the
+// same CalcError codes / messages (ErrorPolicies.hpp).
+//
+// Example Usage:
+//   Calculator<PrecisionPresentValuePolicy<float>> pv32;
+//   float pv = pv32.calculate(0.05f, scenario_flows);          // std::span<const float>
+//
+//   Calculator<MixedPrecisionPresentValuePolicy> mixed;
+//   double pv_mixed = mixed.calculate(0.05, scenario_flows);    // float flows, double sum
+// ===========================================================================
+
+template <typename Real>
+struct PrecisionPresentValuePolicy {
+    static_assert(std::is_floating_point_v<Real>, "Real must be float, double or long double");
+
+    static constexpr CalcError validate(Real discount_rate, std::span<const Real> cash_flows) noexcept {
+        if (discount_rate <= Real(-1)) {
+            return CalcError::DiscountRate;
+        }
+        if (cash_flows.empty()) {
+            return CalcError::EmptyCashFlows;
+        }
+        return CalcError::None;
+    }
+
+    static Real calculate(Real discount_rate, std::span<const Real> cash_flows) {
+        throw_on_error(validate(discount_rate, cash_flows));
+        return evaluate(discount_rate, cash_flows);
+    }
+
+    // Unchecked body (validate() passed)
+    static Real evaluate(Real discount_rate, std::span<const Real> cash_flows) noexcept {
+        if constexpr (std::is_same_v<Real, float>) {
+            // 1 + r in double is exact for a float r
+            return simd::present_value_f32(1.0 + static_cast<double>(discount_rate), cash_flows.data(),
+                                           cash_flows.size());
+        } else if constexpr (std::is_same_v<Real, double>) {
+            return simd::present_value(1.0 + discount_rate, cash_flows.data(), cash_flows.size());
+        } else {
+            return RecurrencePresentValuePolicy::accumulate(Real(1) + discount_rate, cash_flows.data(),
+                                                            cash_flows.size());
+        }
+    }
+};
+
+struct MixedPrecisionPresentValuePolicy {
+    static constexpr CalcError validate(double discount_rate, std::span<const float> cash_flows) noexcept {
+        return present_value_error(discount_rate, cash_flows.size());
+    }
+
+    static double calculate(double discount_rate, std::span<const float> cash_flows) {
+        throw_on_error(validate(discount_rate, cash_flows));
+        return evaluate(discount_rate, cash_flows);
+    }
+
+    // Unchecked body (validate() passed)
+    static double evaluate(double discount_rate, std::span<const float> cash_flows) noexcept {
+        return simd::present_value_mixed(1.0 + discount_rate, cash_flows.data(), cash_flows.size());
+    }
+};
+
+template <typename Real>
+struct PrecisionFutureValuePolicy {
+    static_assert(std::is_floating_point_v<Real>, "Real must be float, double or long double");
+
+    static constexpr CalcError validate(Real principal, Real interest_rate, int periods) noexcept {
+        if (principal < Real(0)) {
+            return CalcError::Principal;
+        }
+        if (interest_rate <= Real(-1)) {
+            return CalcError::InterestRate;
+        }
+        if (periods < 0) {
+            return CalcError::Periods;
+        }
+        return CalcError::None;
+    }
+
+    static Real calculate(Real principal, Real interest_rate, int periods) {
+        throw_on_error(validate(principal, interest_rate, periods));
+        return evaluate(principal, interest_rate, periods);
+    }
+
+    // Unchecked body (validate() passed)
+    static Real evaluate(Real principal, Real interest_rate, int periods) noexcept {
+        if constexpr (std::is_same_v<Real, long double>) {
+            return principal * std::pow(Real(1) + interest_rate, static_cast<Real>(periods));
+        } else {
+            return static_cast<Real>(FutureValuePolicy::evaluate(principal, interest_rate, periods));
+        }
+    }
+};
+
+template <typename Real>
+struct PrecisionInterestRateConversionPolicy {
+    static_assert(std::is_floating_point_v<Real>, "Real must be float, double or long double");
+
+    static constexpr CalcError validate(Real nominal_rate, int compounding_periods) noexcept {
+        if (nominal_rate <= Real(-1)) {
+            return CalcError::NominalRate;
+        }
+        if (compounding_periods <= 0) {
+            return CalcError::CompoundingPeriods;
+        }
+        return CalcError::None;
+    }
+
+    static Real calculate(Real nominal_rate, int compounding_periods) {
+        throw_on_error(validate(nominal_rate, compounding_periods));
+        return evaluate(nominal_rate, compounding_periods);
+    }
+
+    // Unchecked body (validate() passed)
+    static Real evaluate(Real nominal_rate, int compounding_periods) noexcept {
+        if constexpr (std::is_same_v<Real, long double>) {
+            if (compounding_periods == 1) {
+                return nominal_rate;
+            }
+            // (1 + r/n)^n - 1 without cancelling the 1 away for small rates
+            const Real n = static_cast<Real>(compounding_periods);
+            return std::expm1(n * std::log1p(nominal_rate / n));
+        } else {
+            return static_cast<Real>(InterestRateConversionPolicy::evaluate(nominal_rate, compounding_periods));
+        }
+    }
+};
+
+#endif // PRECISIONPOLICIES_HPP
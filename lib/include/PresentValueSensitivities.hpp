@@ -0,0 +1,88 @@
+#ifndef PRESENTVALUESENSITIVITIES_HPP
+#define PRESENTVALUESENSITIVITIES_HPP
+
+#include "ErrorPolicies.hpp"
+#include "SimdKernels.hpp"
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+// ===========================================================================
+// PresentValueSensitivityPolicy
+// ===========================================================================
+// PV of a periodic stream together with its first two derivatives in the
+// discount rate, from one pass over the cash flows. With v = 1 / (1 + r)
+// and k = t + 1 periods of discounting,
+//   PV        = Σ CF_t vᵏ
+//   dPV/dr    = -v  · Σ k · CF_t vᵏ
+//   d²PV/dr²  =  v² · Σ k(k+1) · CF_t vᵏ
+// The three sums share each discount factor (simd::discounted_moments), so
+// the pass costs little more than a PV, where bumping the rate up and down
+// prices the stream three times and leaves finite-difference error in the
+// derivatives.
+//
+// Derived risk, in the units of the rate (periods when r is per period):
+//   DV01               -dPV/dr · 1bp: PV gained when the rate falls 1bp
+//   modified duration  -dPV/dr / PV
+//   convexity          d²PV/dr² / PV
+// Duration and convexity are ±inf or NaN when PV is 0.
+//
+//   • Reproducible = true runs the fixed-order scalar kernel (bit-identical
+//     across CPUs)
+//
+// Example Usage:
+//   Calculator<PresentValueSensitivityPolicy> risk_calc;
+//   PvSensitivities risk = risk_calc.calculate(0.05, cash_flows);
+//   double pv_down_10bp = risk.pv + 10.0 * risk.dv01;
+// ===========================================================================
+
+struct PvSensitivities {
+    double pv;
+    double dpv_dr;             // dPV/dr
+    double d2pv_dr2;           // d²PV/dr²
+    double dv01;               // -dPV/dr · 1bp
+    double modified_duration;  // -dPV/dr / PV
+    double convexity;          // d²PV/dr² / PV
+};
+
+template <bool Reproducible = false>
+struct BasicPresentValueSensitivityPolicy {
+    static constexpr double kBasisPoint = 1e-4;
+
+    static constexpr CalcError validate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        return present_value_error(discount_rate, cash_flows.size());
+    }
+
+    static PvSensitivities calculate(double discount_rate, std::span<const double> cash_flows) {
+        throw_on_error(validate(discount_rate, cash_flows));
+        return evaluate(discount_rate, cash_flows);
+    }
+
+    // Unchecked body (validate() passed)
+    static PvSensitivities evaluate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        return accumulate(discount_rate, cash_flows.data(), cash_flows.size());
+    }
+
+    // Unchecked kernel over a raw buffer (discount_rate > -1, n ≥ 1)
+    static PvSensitivities accumulate(double discount_rate, const double* cash_flows, std::size_t n) noexcept {
+        const double base = 1.0 + discount_rate;
+        if constexpr (Reproducible) {
+            return from_moments(base, simd::discounted_moments(simd::Isa::Scalar, base, cash_flows, n));
+        } else {
+            return from_moments(base, simd::discounted_moments(base, cash_flows, n));
+        }
+    }
+
+    static PvSensitivities from_moments(double base, const simd::DiscountedMoments& m) noexcept {
+        const double v = 1.0 / base;
+        const double dpv = -v * m.first;
+        const double d2pv = v * v * m.second;
+        return {m.pv, dpv, d2pv, -dpv * kBasisPoint, -dpv / m.pv, d2pv / m.pv};
+    }
+};
+
+using PresentValueSensitivityPolicy = BasicPresentValueSensitivityPolicy<false>;
+using ReproducibleSensitivityPolicy = BasicPresentValueSensitivityPolicy<true>;
+
+#endif // PRESENTVALUESENSITIVITIES_HPP
@@ -0,0 +1,194 @@
+#ifndef RUNLENGTHPRESENTVALUE_HPP
+#define RUNLENGTHPRESENTVALUE_HPP
+
+#include "ErrorPolicies.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+// ===========================================================================
+// Run-Length Present Value
+// ===========================================================================
+// Level payments (loan installments, bond coupons, rents) are runs of one
+// value. A run of value c over periods s+1 .. s+k has the closed form
+//   PV_run = c · Σ_{t=s+1..s+k} vᵗ = c · vˢ · (1 - vᵏ) / r,   v = 1 / (1 + r)
+// (c · k at r = 0), evaluated as
+//   c · exp(-s·L) · -expm1(-k·L) / r,   L = ln(1 + r)
+// which stays accurate for small r·k. A stream stored as (value, count) runs
+// costs O(runs): a 30-year monthly annuity is one run, a bullet bond two.
+//
+// PresentValuePolicy detects runs itself: one comparison pass over the
+// stream counts them (giving up as soon as they are too many to pay off),
+// and when the mean run is at least kMinMeanRunLength periods the stream is
+// priced run by run, in place, instead of one std::pow per period. A run is
+// a stretch of bitwise-identical values; the scans compare bit patterns
+// kLane periods at a time without branches.
+//
+// Example Usage:
+//   std::vector<CashFlowRun> runs = {{1500.0, 359}, {1500.0 + 250000.0, 1}};
+//   Calculator<RunLengthPresentValuePolicy> rle_calc;
+//   double pv = rle_calc.calculate(0.004, runs);
+// ===========================================================================
+
+struct CashFlowRun {
+    double value;       // cash flow paid every period of the run
+    std::size_t count;  // periods in the run
+};
+
+struct RunLengthPresentValuePolicy {
+    // Mean run length (periods per run) from which pricing by runs beats a
+    // std::pow per period: a run costs an exp and an expm1
+    static constexpr std::size_t kMinMeanRunLength = 4;
+
+    // The runs must span at least one period
+    static constexpr CalcError validate(double discount_rate, std::span<const CashFlowRun> runs) noexcept {
+        std::size_t periods = 0;
+        for (const CashFlowRun& run : runs) {
+            periods += run.count;
+        }
+        return present_value_error(discount_rate, periods);
+    }
+
+    static double calculate(double discount_rate, std::span<const CashFlowRun> runs) {
+        throw_on_error(validate(discount_rate, runs));
+        return evaluate(discount_rate, runs);
+    }
+
+    // Unchecked body (validate() passed)
+    static double evaluate(double discount_rate, std::span<const CashFlowRun> runs) noexcept {
+        return accumulate(discount_rate, runs.data(), runs.size());
+    }
+
+    // Unchecked kernel over raw runs (discount_rate > -1)
+    static double accumulate(double discount_rate, const CashFlowRun* runs, std::size_t n_runs) noexcept {
+        const Discount discount(discount_rate);
+        double pv = 0.0;
+        std::size_t start = 0;
+        for (std::size_t i = 0; i < n_runs; ++i) {
+            pv += discount.run(runs[i].value, start, runs[i].count);
+            start += runs[i].count;
+        }
+        return pv;
+    }
+
+    // Unchecked kernel over runs held as parallel value / count arrays
+    static double accumulate(double discount_rate, const double* values, const std::size_t* counts,
+                             std::size_t n_runs) noexcept {
+        const Discount discount(discount_rate);
+        double pv = 0.0;
+        std::size_t start = 0;
+        for (std::size_t i = 0; i < n_runs; ++i) {
+            pv += discount.run(values[i], start, counts[i]);
+            start += counts[i];
+        }
+        return pv;
+    }
+
+    // Whether the stream's runs are long enough to price run by run; stops
+    // reading once too many runs have been seen
+    static bool worthwhile(const double* cash_flows, std::size_t n) noexcept {
+        if (n < kMinMeanRunLength) {
+            return false;
+        }
+        const std::size_t max_runs = n / kMinMeanRunLength;
+        std::size_t runs = 1;
+        std::size_t i = 1;
+        while (i + 8 * kLane <= n) {
+            for (std::size_t end = i + 8 * kLane; i < end; i += kLane) {
+                runs += changes(cash_flows + i);
+            }
+            if (runs > max_runs) {
+                return false;
+            }
+        }
+        for (; i < n; ++i) {
+            runs += bits(cash_flows[i]) != bits(cash_flows[i - 1]) ? 1u : 0u;
+        }
+        return runs <= max_runs;
+    }
+
+    // Unchecked PV of a plain stream, walking its runs in place (n ≥ 1)
+    static double accumulate_detected(double discount_rate, const double* cash_flows, std::size_t n) {
+        const Discount discount(discount_rate);
+        double pv = 0.0;
+        std::size_t start = 0;
+        while (start < n) {
+            const double value = cash_flows[start];
+            std::size_t end = start + 1;
+            while (end + kLane <= n && level(cash_flows + end, value)) {
+                end += kLane;
+            }
+            while (end < n && bits(cash_flows[end]) == bits(value)) {
+                ++end;
+            }
+            pv += discount.run(value, start, end - start);
+            start = end;
+        }
+        return pv;
+    }
+
+    static std::vector<CashFlowRun> encode(std::span<const double> cash_flows) {
+        std::vector<CashFlowRun> runs;
+        for (std::size_t i = 0; i < cash_flows.size(); ++i) {
+            if (runs.empty() || bits(cash_flows[i]) != bits(runs.back().value)) {
+                runs.push_back({cash_flows[i], 0});
+            }
+            ++runs.back().count;
+        }
+        return runs;
+    }
+
+private:
+    // Periods compared per step by the scans
+    static constexpr std::size_t kLane = 8;
+
+    static std::uint64_t bits(double x) noexcept {
+        return std::bit_cast<std::uint64_t>(x);
+    }
+
+    // Value changes between p[-1], p[0], ..., p[kLane - 1]
+    static std::size_t changes(const double* p) noexcept {
+        std::size_t count = 0;
+        #pragma GCC unroll 8
+        for (std::size_t j = 0; j < kLane; ++j) {
+            count += bits(p[j]) != bits(p[j - 1]) ? 1u : 0u;
+        }
+        return count;
+    }
+
+    // Whether p[0 .. kLane) all equal value
+    static bool level(const double* p, double value) noexcept {
+        const std::uint64_t pattern = bits(value);
+        std::uint64_t differs = 0;
+        #pragma GCC unroll 8
+        for (std::size_t j = 0; j < kLane; ++j) {
+            differs |= bits(p[j]) ^ pattern;
+        }
+        return differs == 0;
+    }
+
+    class Discount {
+    public:
+        explicit Discount(double discount_rate) noexcept
+            : rate_(discount_rate), log_base_(std::log1p(discount_rate)) {}
+
+        // PV of value paid at periods start+1 .. start+count
+        double run(double value, std::size_t start, std::size_t count) const noexcept {
+            const double s = static_cast<double>(start);
+            const double k = static_cast<double>(count);
+            const double annuity = rate_ == 0.0 ? k : -std::expm1(-k * log_base_) / rate_;
+            return value * std::exp(-s * log_base_) * annuity;
+        }
+
+    private:
+        double rate_;
+        double log_base_;
+    };
+};
+
+#endif // RUNLENGTHPRESENTVALUE_HPP
@@ -0,0 +1,196 @@
+#ifndef SIMDKERNELS_HPP
+#define SIMDKERNELS_HPP
+
+#include "CalculationPolicies.hpp"
+#include "ErrorPolicies.hpp"
+
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <cstddef>
+
+// ===========================================================================
+// SIMD Present Value Kernels
+// ===========================================================================
+// Vectorized PV with runtime CPU dispatch. Each vector lane holds one
+// discount factor; a W-lane register covers periods t .. t+W-1 and steps
+// forward by multiplying with v^W (lane-strided powers of v = 1 / (1 + r)).
+// Lanes are re-anchored against std::pow every kAnchorInterval periods, as
+// in RecurrencePresentValuePolicy, so drift stays bounded.
+//
+// The best path supported by the running CPU is picked once, on first use:
+//   AVX-512F (8 lanes) > AVX2 + FMA (4 lanes) > SSE2 (2 lanes) > scalar
+// Non-x86 builds always use the scalar path.
+//
+// Vector paths sum in lane order, so results may differ in the last bits
+// between ISAs. Reproducible mode always runs the scalar recurrence with a
+// fixed left-to-right reduction and is bit-identical on every CPU.
+// ===========================================================================
+
+namespace simd {
+
+enum class Isa {
+    Scalar,
+    SSE2,
+    AVX2,
+    AVX512,
+};
+
+// Periods between std::pow re-anchors (multiple of every lane count)
+inline constexpr std::size_t kAnchorInterval = 64;
+
+// Best ISA supported by this CPU (detected once, thread-safe)
+Isa detected_isa() noexcept;
+
+// Human-readable ISA name ("scalar", "sse2", "avx2", "avx512")
+const char* isa_name(Isa isa) noexcept;
+
+// True if this CPU (and build) can run the given path
+bool isa_supported(Isa isa) noexcept;
+
+// Unchecked PV over a raw buffer using the detected path.
+// base = 1 + discount_rate (> 0), cash_flows[i] is discounted (i + 1) times.
+double present_value(double base, const double* cash_flows, std::size_t n) noexcept;
+
+// Unchecked PV forcing a specific path (must satisfy isa_supported)
+double present_value(Isa isa, double base, const double* cash_flows, std::size_t n) noexcept;
+
+// Unchecked PV with a fixed reduction order, bit-identical across CPUs
+double present_value_reproducible(double base, const double* cash_flows, std::size_t n) noexcept;
+
+// Single precision: float flows in float lanes, twice the lanes of the
+// double kernel (SSE2 4, AVX2 8, AVX-512 16) at half the bytes per period.
+// Partial sums are widened to double every 1024 periods, so long streams
+// keep ~6-7 significant digits. base = 1 + discount_rate (> 0) stays a
+// double: rounding it to float would cost up to n·2⁻²⁴ over n periods.
+float present_value_f32(double base, const float* cash_flows, std::size_t n) noexcept;
+
+// Single-precision PV forcing a specific path (must satisfy isa_supported)
+float present_value_f32(Isa isa, double base, const float* cash_flows, std::size_t n) noexcept;
+
+// Mixed precision: float flows widened to double as they are loaded, then
+// the double kernel. Double accuracy on the stored flows at half the memory
+// traffic; Isa::Scalar is the fixed-order, bit-reproducible path.
+double present_value_mixed(double base, const float* cash_flows, std::size_t n) noexcept;
+
+// Mixed-precision PV forcing a specific path (must satisfy isa_supported)
+double present_value_mixed(Isa isa, double base, const float* cash_flows, std::size_t n) noexcept;
+
+// Unchecked elementwise FV over structure-of-arrays inputs:
+//   results[i] = principals[i] · (1 + rates[i])^periods[i]   (periods[i] >= 0)
+// The integer power engine (IntegerPower.hpp, FmaProducts) lane-wise:
+// ≤ 0.5 ulp for any period count, and bit-identical on every path
+// (AVX-512 / AVX2 / scalar).
+void future_value(const double* principals, const double* rates, const int* periods,
+                  std::size_t n, double* results) noexcept;
+
+// Unchecked FV forcing a specific path (must satisfy isa_supported)
+void future_value(Isa isa, const double* principals, const double* rates, const int* periods,
+                  std::size_t n, double* results) noexcept;
+
+// Unchecked dot product Σ a[i] · b[i] using the detected path. Vector paths
+// sum in lane order, so results may differ in the last bits between ISAs.
+double dot(const double* a, const double* b, std::size_t n) noexcept;
+
+// Unchecked dot product forcing a specific path (must satisfy isa_supported)
+double dot(Isa isa, const double* a, const double* b, std::size_t n) noexcept;
+
+// Discounted moments of a stream, k = t + 1 periods of discounting:
+//   pv = Σ CF_t v^k,   first = Σ k · CF_t v^k,   second = Σ k(k+1) · CF_t v^k
+// (dPV/dr = -v · first, d²PV/dr² = v² · second; PresentValueSensitivities.hpp)
+struct DiscountedMoments {
+    double pv;
+    double first;
+    double second;
+};
+
+// Unchecked moments over a raw buffer using the detected path, in one pass
+// over the cash flows (base = 1 + discount_rate > 0). Vector paths sum in
+// lane order; Isa::Scalar is the fixed-order, bit-reproducible path.
+DiscountedMoments discounted_moments(double base, const double* cash_flows, std::size_t n) noexcept;
+
+// Unchecked moments forcing a specific path (must satisfy isa_supported)
+DiscountedMoments discounted_moments(Isa isa, double base, const double* cash_flows, std::size_t n) noexcept;
+
+} // namespace simd
+
+// ===========================================================================
+// SimdPresentValuePolicy
+// PresentValuePolicy semantics on the runtime-dispatched SIMD kernel.
+//   • Reproducible = true selects the deterministic reduction order
+// ===========================================================================
+template <bool Reproducible = false>
+struct BasicSimdPresentValuePolicy {
+    static constexpr CalcError validate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        return present_value_error(discount_rate, cash_flows.size());
+    }
+
+    static double calculate(double discount_rate, std::span<const double> cash_flows) {
+        throw_on_error(validate(discount_rate, cash_flows));
+        return evaluate(discount_rate, cash_flows);
+    }
+
+    // Unchecked body (validate() passed)
+    static double evaluate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        const double base = 1.0 + discount_rate;
+        if constexpr (Reproducible) {
+            return simd::present_value_reproducible(base, cash_flows.data(), cash_flows.size());
+        } else {
+            return simd::present_value(base, cash_flows.data(), cash_flows.size());
+        }
+    }
+};
+
+using SimdPresentValuePolicy = BasicSimdPresentValuePolicy<false>;
+using ReproducibleSimdPresentValuePolicy = BasicSimdPresentValuePolicy<true>;
+
+// ===========================================================================
+// SimdFutureValuePolicy
+// FutureValuePolicy semantics on the vectorized FV kernel, plus a
+// structure-of-arrays batch form for revaluing many positions at once.
+//   • calculate_batch validates everything before writing any result and
+//     throws std::invalid_argument naming the first bad element
+//   • Scalar and batch calls return identical bits for the same inputs
+// ===========================================================================
+struct SimdFutureValuePolicy {
+    static constexpr CalcError validate(double principal, double interest_rate, int periods) noexcept {
+        return FutureValuePolicy::validate(principal, interest_rate, periods);
+    }
+
+    // Reason (principal, interest_rate, periods) is invalid, or nullptr
+    static const char* check(double principal, double interest_rate, int periods) noexcept {
+        return error_message(validate(principal, interest_rate, periods));
+    }
+
+    static double calculate(double principal, double interest_rate, int periods) {
+        throw_on_error(validate(principal, interest_rate, periods));
+        return evaluate(principal, interest_rate, periods);
+    }
+
+    // Unchecked body (validate() passed)
+    static double evaluate(double principal, double interest_rate, int periods) noexcept {
+        double result = 0.0;
+        simd::future_value(&principal, &interest_rate, &periods, 1, &result);
+        return result;
+    }
+
+    static void calculate_batch(std::span<const double> principals,
+                                std::span<const double> interest_rates,
+                                std::span<const int> periods,
+                                std::span<double> results) {
+        const std::size_t n = principals.size();
+        if (interest_rates.size() != n || periods.size() != n || results.size() != n) {
+            throw std::invalid_argument(
+                "principals, interest_rates, periods and results must have the same length");
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            if (const char* error = check(principals[i], interest_rates[i], periods[i])) {
+                throw std::invalid_argument("element " + std::to_string(i) + ": " + error);
+            }
+        }
+
+        simd::future_value(principals.data(), interest_rates.data(), periods.data(), n, results.data());
+    }
+};
+
+#endif // SIMDKERNELS_HPP
@@ -0,0 +1,256 @@
+#ifndef SUMMATIONPOLICIES_HPP
+#define SUMMATIONPOLICIES_HPP
+
+#include "CalculationPolicies.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+// ===========================================================================
+// Summation Policies
+// ===========================================================================
+// Interchangeable ways of adding up the discounted terms CF_i · df_i of a PV.
+// Each policy provides an Accumulator that consumes terms in blocks:
+//   Accumulator acc;  acc.add(terms, n);  ...  double s = acc.result();
+//
+// Error of the sum S = Σ x_i (u = 2^-53 unit roundoff):
+//   NaiveSummation              γ_{n-1}·Σ|x_i|                  1 add / term
+//   PairwiseSummation           γ_{kLeaf + log2 n}·Σ|x_i|        ~1 add / term
+//   NeumaierSummation           2u·|S| + O(n·u²)·Σ|x_i|          4 flops + branch
+//   VectorCompensatedSummation  2u·|S| + O(n·u²)·Σ|x_i|          6 flops, no branch,
+//                                                               kLanes independent chains
+//
+// The compensated forms rely on strict IEEE evaluation: never build them
+// with -ffast-math / -fassociative-math, which deletes the correction terms.
+// ===========================================================================
+
+// ===========================================================================
+// NaiveSummation
+// Left-to-right running sum (what the PV policies have always done)
+// ===========================================================================
+struct NaiveSummation {
+    class Accumulator {
+    public:
+        void add(const double* terms, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                sum_ += terms[i];
+            }
+        }
+
+        double result() const { return sum_; }
+
+    private:
+        double sum_ = 0.0;
+    };
+};
+
+// ===========================================================================
+// PairwiseSummation
+// Terms are summed naively in kLeaf-term leaves; leaf sums are combined as a
+// balanced binary tree, built incrementally like a binary counter so no
+// storage beyond one partial per tree level is needed.
+// ===========================================================================
+struct PairwiseSummation {
+    static constexpr std::size_t kLeaf = 64;
+
+    class Accumulator {
+    public:
+        void add(const double* terms, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                leaf_ += terms[i];
+                if (++leaf_count_ == kLeaf) {
+                    push(leaf_);
+                    leaf_ = 0.0;
+                    leaf_count_ = 0;
+                }
+            }
+        }
+
+        double result() const {
+            // Combine the pending levels smallest (most recent) first
+            double sum = leaf_;
+            for (std::size_t k = 0; k < kLevels; ++k) {
+                if ((n_leaves_ >> k) & 1u) {
+                    sum = levels_[k] + sum;
+                }
+            }
+            return sum;
+        }
+
+    private:
+        static constexpr std::size_t kLevels = 64;
+
+        // Binary-counter carry: level k holds the sum of 2^k leaves
+        void push(double value) {
+            std::size_t k = 0;
+            while ((n_leaves_ >> k) & 1u) {
+                value = levels_[k] + value;
+                ++k;
+            }
+            levels_[k] = value;
+            ++n_leaves_;
+        }
+
+        double levels_[kLevels] = {};
+        std::uint64_t n_leaves_ = 0;
+        double leaf_ = 0.0;
+        std::size_t leaf_count_ = 0;
+    };
+};
+
+// ===========================================================================
+// NeumaierSummation
+// Kahan summation with Neumaier's fix: the rounding error of every addition
+// is recovered exactly and accumulated separately, whichever operand is
+// larger, so the result is as if summed in twice the working precision.
+// ===========================================================================
+struct NeumaierSummation {
+    class Accumulator {
+    public:
+        void add(const double* terms, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                const double x = terms[i];
+                const double t = sum_ + x;
+                if (std::fabs(sum_) >= std::fabs(x)) {
+                    compensation_ += (sum_ - t) + x;
+                } else {
+                    compensation_ += (x - t) + sum_;
+                }
+                sum_ = t;
+            }
+        }
+
+        double result() const { return sum_ + compensation_; }
+
+    private:
+        double sum_ = 0.0;
+        double compensation_ = 0.0;
+    };
+};
+
+// ===========================================================================
+// VectorCompensatedSummation
+// kLanes independent compensated sums (term i goes to lane i % kLanes within
+// a block), each using Knuth's branch-free TwoSum so the lane loop maps
+// onto SIMD registers. Lanes are merged with Neumaier at the end.
+//   • Same accuracy class as NeumaierSummation; lane order differs, so the
+//     two can disagree in the last bit
+// ===========================================================================
+struct VectorCompensatedSummation {
+    static constexpr std::size_t kLanes = 8;
+
+    class Accumulator {
+    public:
+        void add(const double* terms, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + kLanes <= n; i += kLanes) {
+                for (std::size_t j = 0; j < kLanes; ++j) {
+                    two_sum(j, terms[i + j]);
+                }
+            }
+            for (std::size_t j = 0; j < kLanes && i + j < n; ++j) {
+                two_sum(j, terms[i + j]);
+            }
+        }
+
+        double result() const {
+            NeumaierSummation::Accumulator merge;
+            merge.add(sum_, kLanes);
+            merge.add(compensation_, kLanes);
+            return merge.result();
+        }
+
+    private:
+        void two_sum(std::size_t lane, double x) {
+            const double s = sum_[lane];
+            const double t = s + x;
+            const double x_part = t - s;
+            compensation_[lane] += (s - (t - x_part)) + (x - x_part);
+            sum_[lane] = t;
+        }
+
+        double sum_[kLanes] = {};
+        double compensation_[kLanes] = {};
+    };
+};
+
+// ===========================================================================
+// Discount Factor Generators (for SummedPresentValuePolicy)
+// fill() writes terms[j] = CF_{start+j} · df_{start+j} for one block.
+// ===========================================================================
+
+// Running product re-anchored with std::pow every block (the recurrence
+// kernel): ≤ (kBlock + 2)·u relative error per discount factor
+struct RecurrenceDiscountFactors {
+    static constexpr std::size_t kBlock = RecurrencePresentValuePolicy::kAnchorInterval;
+
+    static void fill(double base, double v, std::size_t start, const double* cash_flows,
+                     std::size_t n, double* terms) {
+        double df = 1.0 / std::pow(base, static_cast<double>(start) + 1.0);
+        for (std::size_t j = 0; j < n; ++j) {
+            terms[j] = cash_flows[j] * df;
+            df *= v;
+        }
+    }
+};
+
+// One std::pow per cash flow (PresentValuePolicy's discounting): ~2u
+// relative error per term, at pow cost. Use when cancellation is extreme and
+// the term error, not the summation error, dominates.
+struct PowDiscountFactors {
+    static constexpr std::size_t kBlock = 32;
+
+    static void fill(double base, double /*v*/, std::size_t start, const double* cash_flows,
+                     std::size_t n, double* terms) {
+        for (std::size_t j = 0; j < n; ++j) {
+            terms[j] = cash_flows[j] / std::pow(base, static_cast<double>(start + j) + 1.0);
+        }
+    }
+};
+
+// ===========================================================================
+// SummedPresentValuePolicy
+// PresentValuePolicy semantics with a selectable summation policy.
+// Terms are generated one block at a time into a stack buffer and handed to
+// the accumulator, so no memory is allocated whatever the stream length.
+//   • SummedPresentValuePolicy<NaiveSummation> is bit-identical to
+//     RecurrencePresentValuePolicy
+//   • Total error ≈ summation error (above) + term error (generator) · Σ|x_i|
+//
+// Example Usage:
+//   Calculator<SummedPresentValuePolicy<NeumaierSummation>> pv_calc;
+//   double pv = pv_calc.calculate(0.05, cash_flows);
+// ===========================================================================
+template <typename Summation, typename DiscountFactors = RecurrenceDiscountFactors>
+struct SummedPresentValuePolicy {
+    static constexpr CalcError validate(double discount_rate, std::span<const double> cash_flows) noexcept {
+        return present_value_error(discount_rate, cash_flows.size());
+    }
+
+    static double calculate(double discount_rate, std::span<const double> cash_flows) {
+        throw_on_error(validate(discount_rate, cash_flows));
+        return evaluate(discount_rate, cash_flows);
+    }
+
+    // Unchecked body (validate() passed)
+    static double evaluate(double discount_rate, std::span<const double> cash_flows) {
+        constexpr std::size_t kBlock = DiscountFactors::kBlock;
+        const double base = 1.0 + discount_rate;
+        const double v = 1.0 / base;
+        const std::size_t n = cash_flows.size();
+
+        double terms[kBlock];
+        typename Summation::Accumulator acc;
+        for (std::size_t start = 0; start < n; start += kBlock) {
+            const std::size_t len = (n - start < kBlock) ? n - start : kBlock;
+            DiscountFactors::fill(base, v, start, cash_flows.data() + start, len, terms);
+            acc.add(terms, len);
+        }
+        return acc.result();
+    }
+};
+
+#endif // SUMMATIONPOLICIES_HPP
@@ -0,0 +1,176 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ===========================================================================
+// ThreadPool
+// ===========================================================================
+// Fixed set of worker threads used by the batch and parallel calculation
+// paths. Work is expressed as parallel_for over chunk indices:
+//   • the calling thread always participates, so progress never depends on
+//     a worker being free (safe for concurrent and nested callers)
+//   • chunks are claimed dynamically from a shared atomic counter
+//   • parallel_for returns once every chunk has run; the first exception
+//     thrown by a chunk is rethrown on the calling thread
+//
+// Example Usage:
+//   ThreadPool::instance().parallel_for(n_chunks, 0, [&](std::size_t chunk) {
+//       process(chunk);
+//   });
+// ===========================================================================
+
+class ThreadPool {
+public:
+    explicit ThreadPool(std::size_t n_workers) {
+        workers_.reserve(n_workers);
+        for (std::size_t i = 0; i < n_workers; ++i) {
+            workers_.emplace_back([this] { worker_loop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // ========================================================================
+    // Process-wide pool with one thread per hardware thread (the caller of
+    // parallel_for is one of them). Intentionally never destroyed: joining
+    // workers during static destruction of a dlopen'ed library is unsafe.
+    // ========================================================================
+    static ThreadPool& instance() {
+        static ThreadPool* pool = new ThreadPool(default_concurrency() - 1);
+        return *pool;
+    }
+
+    static std::size_t default_concurrency() {
+        const unsigned hw = std::thread::hardware_concurrency();
+        return hw == 0 ? 1 : static_cast<std::size_t>(hw);
+    }
+
+    // Threads available to one parallel_for: the workers plus the caller
+    std::size_t concurrency() const {
+        return workers_.size() + 1;
+    }
+
+    // ========================================================================
+    // Run fn(chunk) for every chunk in [0, n_chunks) on at most max_threads
+    // threads including the caller (0 = all). Blocks until all chunks ran.
+    // ========================================================================
+    template <typename Fn>
+    void parallel_for(std::size_t n_chunks, std::size_t max_threads, Fn&& fn) {
+        if (n_chunks == 0) {
+            return;
+        }
+        std::size_t threads = (max_threads == 0) ? concurrency() : std::min(max_threads, concurrency());
+        threads = std::min(threads, n_chunks);
+        if (threads <= 1) {
+            for (std::size_t chunk = 0; chunk < n_chunks; ++chunk) {
+                fn(chunk);
+            }
+            return;
+        }
+
+        // Shared with helper tasks that may start after the caller returns;
+        // they only touch `body` after successfully claiming a chunk.
+        auto job = std::make_shared<Job>();
+        job->n_chunks = n_chunks;
+        job->body = [&fn](std::size_t chunk) { fn(chunk); };
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (std::size_t i = 1; i < threads; ++i) {
+                tasks_.emplace_back([job] { run_chunks(*job); });
+            }
+        }
+        cv_.notify_all();
+
+        run_chunks(*job);
+
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->done_cv.wait(lock, [&] { return job->completed == job->n_chunks; });
+        if (job->error) {
+            std::rethrow_exception(job->error);
+        }
+    }
+
+private:
+    struct Job {
+        std::size_t n_chunks = 0;
+        std::atomic<std::size_t> next{0};
+        std::function<void(std::size_t)> body;
+
+        std::mutex mutex;
+        std::condition_variable done_cv;
+        std::size_t completed = 0;
+        std::exception_ptr error;
+    };
+
+    static void run_chunks(Job& job) {
+        for (;;) {
+            const std::size_t chunk = job.next.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= job.n_chunks) {
+                return;
+            }
+
+            std::exception_ptr error;
+            try {
+                job.body(chunk);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(job.mutex);
+            if (error && !job.error) {
+                job.error = error;
+            }
+            if (++job.completed == job.n_chunks) {
+                job.done_cv.notify_all();
+            }
+        }
+    }
+
+    void worker_loop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;  // stopping and drained
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+};
+
+#endif // THREADPOOL_HPP
@@ -0,0 +1,255 @@
+#ifndef YIELDCURVE_HPP
+#define YIELDCURVE_HPP
+
+#include "ErrorPolicies.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ===========================================================================
+// YieldCurve
+// ===========================================================================
+// Discount curve built from pillars (t_i, value_i), t in years:
+//   • CurveQuote::ZeroRate        value_i = continuously compounded zero
+//                                 rate r_i, DF(t_i) = exp(-r_i · t_i)
+//   • CurveQuote::DiscountFactor  value_i = DF(t_i) > 0
+//
+// Between pillars (CurveInterpolation):
+//   • Linear         zero rate linear in t
+//   • LogLinear      ln DF linear in t (piecewise-flat forward rates)
+//   • MonotoneCubic  zero rate by a monotone cubic Hermite spline
+//                    (Fritsch–Butland slopes: no overshoot between pillars)
+// Before the first pillar the zero rate is flat at r_0 (so DF(0) = 1), after
+// the last one flat at r_{n-1}.
+//
+// Every piece of the curve is stored as a per-segment polynomial, built once
+// with the curve:
+//   q(t) = a + b·dt + c·dt² + d·dt³,   dt = t - segment start
+// with q = ln DF for LogLinear and q = zero rate otherwise, so a lookup is a
+// segment search plus one polynomial and one exp. discount_factor(t, hint)
+// starts the search at a caller-kept segment index: walking time-ordered
+// cash flows stays in the cached segment and steps forward, instead of a
+// binary search per flow.
+//
+// Example Usage:
+//   YieldCurve curve({0.5, 1.0, 2.0, 5.0}, {0.030, 0.032, 0.035, 0.040},
+//                    CurveQuote::ZeroRate, CurveInterpolation::MonotoneCubic);
+//   double df = curve.discount_factor(1.5);
+// ===========================================================================
+
+enum class CurveQuote {
+    ZeroRate,
+    DiscountFactor,
+};
+
+enum class CurveInterpolation {
+    Linear,
+    LogLinear,
+    MonotoneCubic,
+};
+
+class YieldCurve {
+public:
+    YieldCurve(std::span<const double> times, std::span<const double> values,
+               CurveQuote quote = CurveQuote::ZeroRate,
+               CurveInterpolation interpolation = CurveInterpolation::Linear)
+        : interpolation_(interpolation) {
+        const std::size_t n = times.size();
+        if (n == 0) {
+            throw std::invalid_argument("yield curve needs at least one pillar");
+        }
+        if (values.size() != n) {
+            throw std::invalid_argument("times and values must have the same length");
+        }
+
+        std::vector<double> rates(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!(times[i] > 0.0) || !std::isfinite(times[i]) || (i > 0 && !(times[i] > times[i - 1]))) {
+                throw std::invalid_argument("pillar " + std::to_string(i)
+                                            + ": times must be positive and strictly increasing");
+            }
+            if (quote == CurveQuote::DiscountFactor && !(values[i] > 0.0)) {
+                throw std::invalid_argument("pillar " + std::to_string(i) + ": discount factor must be > 0");
+            }
+            rates[i] = quote == CurveQuote::ZeroRate ? values[i] : -std::log(values[i]) / times[i];
+            if (!std::isfinite(rates[i])) {
+                throw std::invalid_argument("pillar " + std::to_string(i) + ": value must be finite");
+            }
+        }
+        build(times, rates);
+    }
+
+    CurveInterpolation interpolation() const { return interpolation_; }
+    std::size_t pillars() const { return segments_.size() - 1; }
+
+    // Segment holding t (t ≥ 0), searched from hint; the returned index is
+    // the hint for the next, later t
+    std::size_t segment(double t, std::size_t hint = 0) const {
+        std::size_t k = hint < segments_.size() ? hint : 0;
+        if (t < segments_[k].start) {
+            // Moved backwards: binary search for the last start ≤ t
+            const auto after = std::upper_bound(segments_.begin(), segments_.end(), t,
+                                                [](double x, const Segment& s) { return x < s.start; });
+            return after == segments_.begin() ? 0 : static_cast<std::size_t>(after - segments_.begin()) - 1;
+        }
+        while (k + 1 < segments_.size() && t >= segments_[k + 1].start) {
+            ++k;
+        }
+        return k;
+    }
+
+    double discount_factor(double t) const {
+        std::size_t hint = 0;
+        return discount_factor(t, hint);
+    }
+
+    // DF(t) starting the segment search at hint (updated in place)
+    double discount_factor(double t, std::size_t& hint) const {
+        hint = segment(t, hint);
+        const Segment& s = segments_[hint];
+        const double dt = t - s.start;
+        const double q = s.a + dt * (s.b + dt * (s.c + dt * s.d));
+        return interpolation_ == CurveInterpolation::LogLinear ? std::exp(q) : std::exp(-q * t);
+    }
+
+    // Continuously compounded zero rate (r_0 at t = 0)
+    double zero_rate(double t) const {
+        if (t <= 0.0) {
+            return first_rate_;
+        }
+        return -std::log(discount_factor(t)) / t;
+    }
+
+private:
+    struct Segment {
+        double start;
+        double a, b, c, d;
+    };
+
+    void build(std::span<const double> times, const std::vector<double>& rates) {
+        const std::size_t n = times.size();
+        first_rate_ = rates[0];
+        segments_.reserve(n + 1);
+
+        if (interpolation_ == CurveInterpolation::LogLinear) {
+            // ln DF: from 0 at t = 0 through -r_i·t_i, then slope -r_{n-1}
+            double prev_t = 0.0;
+            double prev_q = 0.0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const double q = -rates[i] * times[i];
+                segments_.push_back({prev_t, prev_q, (q - prev_q) / (times[i] - prev_t), 0.0, 0.0});
+                prev_t = times[i];
+                prev_q = q;
+            }
+            segments_.push_back({prev_t, prev_q, -rates[n - 1], 0.0, 0.0});
+            return;
+        }
+
+        // Zero rate: flat r_0 up to the first pillar
+        segments_.push_back({0.0, rates[0], 0.0, 0.0, 0.0});
+
+        std::vector<double> slopes(n, 0.0);
+        if (interpolation_ == CurveInterpolation::MonotoneCubic && n > 1) {
+            slopes = monotone_slopes(times, rates);
+        }
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            const double h = times[i + 1] - times[i];
+            const double secant = (rates[i + 1] - rates[i]) / h;
+            if (interpolation_ == CurveInterpolation::Linear) {
+                segments_.push_back({times[i], rates[i], secant, 0.0, 0.0});
+            } else {
+                const double m0 = slopes[i];
+                const double m1 = slopes[i + 1];
+                segments_.push_back({times[i], rates[i], m0,
+                                     (3.0 * secant - 2.0 * m0 - m1) / h,
+                                     (m0 + m1 - 2.0 * secant) / (h * h)});
+            }
+        }
+        segments_.push_back({times[n - 1], rates[n - 1], 0.0, 0.0, 0.0});
+    }
+
+    // Fritsch–Butland pillar slopes: zero where the data turn, a weighted
+    // harmonic mean of the neighbouring secants elsewhere
+    static std::vector<double> monotone_slopes(std::span<const double> times, const std::vector<double>& rates) {
+        const std::size_t n = times.size();
+        std::vector<double> h(n - 1), secant(n - 1), slopes(n, 0.0);
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            h[i] = times[i + 1] - times[i];
+            secant[i] = (rates[i + 1] - rates[i]) / h[i];
+        }
+        slopes[0] = secant[0];
+        slopes[n - 1] = secant[n - 2];
+        for (std::size_t i = 1; i + 1 < n; ++i) {
+            if (secant[i - 1] * secant[i] > 0.0) {
+                const double w1 = 2.0 * h[i] + h[i - 1];
+                const double w2 = h[i] + 2.0 * h[i - 1];
+                slopes[i] = (w1 + w2) / (w1 / secant[i - 1] + w2 / secant[i]);
+            }
+        }
+        return slopes;
+    }
+
+    CurveInterpolation interpolation_;
+    double first_rate_ = 0.0;
+    std::vector<Segment> segments_;  // first starts at t = 0, last is open-ended
+};
+
+// ===========================================================================
+// CurvePresentValuePolicy
+// PV = Σ CF_i · DF(t_i) for dated cash flows against a YieldCurve.
+//   • times[i] is the payment time of cash_flows[i] in years (≥ 0)
+//   • Time-ordered flows walk the curve's segments with a running hint
+//     (unordered flows are fine, they just restart the search)
+// ===========================================================================
+struct CurvePresentValuePolicy {
+    static constexpr CalcError validate(const YieldCurve&, std::span<const double> times,
+                                        std::span<const double> cash_flows) noexcept {
+        if (cash_flows.empty()) {
+            return CalcError::EmptyCashFlows;
+        }
+        if (times.size() != cash_flows.size()) {
+            return CalcError::DateCount;
+        }
+        return time_error(times.data(), times.size());
+    }
+
+    // Payment times must be >= 0 (and not NaN)
+    static constexpr CalcError time_error(const double* times, std::size_t n) noexcept {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!(times[i] >= 0.0)) {
+                return CalcError::NegativeTime;
+            }
+        }
+        return CalcError::None;
+    }
+
+    static double calculate(const YieldCurve& curve, std::span<const double> times,
+                            std::span<const double> cash_flows) {
+        throw_on_error(validate(curve, times, cash_flows));
+        return evaluate(curve, times, cash_flows);
+    }
+
+    // Unchecked body (validate() passed)
+    static double evaluate(const YieldCurve& curve, std::span<const double> times,
+                           std::span<const double> cash_flows) noexcept {
+        return accumulate(curve, times.data(), cash_flows.data(), cash_flows.size());
+    }
+
+    // Unchecked kernel over raw buffers (times already validated)
+    static double accumulate(const YieldCurve& curve, const double* times, const double* cash_flows,
+                             std::size_t n) noexcept {
+        std::size_t hint = 0;
+        double pv = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            pv += cash_flows[i] * curve.discount_factor(times[i], hint);
+        }
+        return pv;
+    }
+};
+
+#endif // YIELDCURVE_HPP
@@ -2,6 +2,7 @@
 #define CALCULATOR_C_API_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -14,6 +15,88 @@ extern "C" {
 typedef struct PVCalculator_t* PVCalculatorHandle;
 typedef struct FVCalculator_t* FVCalculatorHandle;
 typedef struct IRCalculator_t* IRCalculatorHandle;
+typedef struct IRRCalculator_t* IRRCalculatorHandle;
+typedef struct YieldCurve_t* YieldCurveHandle;
+typedef struct BondCalculator_t* BondCalculatorHandle;
+
+// ===========================================================================
+// Per-Element Status Codes
+// ===========================================================================
+// Written by the *_batch_status entry points, one per element: those calls
+// price every valid element and mark the rest instead of stopping at the
+// first. calculator_status_message() gives the text.
+#define CALC_STATUS_OK 0
+#define CALC_STATUS_DISCOUNT_RATE 1        /* discount_rate <= -1 */
+#define CALC_STATUS_EMPTY_CASH_FLOWS 2     /* stream has no cash flows */
+#define CALC_STATUS_PRINCIPAL 3            /* principal < 0 */
+#define CALC_STATUS_INTEREST_RATE 4        /* interest_rate <= -1 */
+#define CALC_STATUS_PERIODS 5              /* periods < 0 */
+#define CALC_STATUS_NOMINAL_RATE 6         /* nominal_rate <= -1 */
+#define CALC_STATUS_COMPOUNDING_PERIODS 7  /* compounding_periods <= 0 */
+#define CALC_STATUS_OFFSETS 8              /* offsets[i + 1] < offsets[i] */
+#define CALC_STATUS_NULL_POINTER 9         /* required pointer is NULL (*_ex calls) */
+#define CALC_STATUS_SIGN_CHANGE 10         /* IRR stream's cash flows do not change sign */
+#define CALC_STATUS_GUESS 11               /* IRR guess <= -1 */
+#define CALC_STATUS_IRR_NOT_FOUND 12       /* no IRR reached from the guess */
+#define CALC_STATUS_FACE 13                /* bond face <= 0 */
+#define CALC_STATUS_COUPON_RATE 14         /* bond coupon_rate < 0 */
+#define CALC_STATUS_BOND_PERIODS 15        /* bond periods < 1 */
+#define CALC_STATUS_FREQUENCY 16           /* bond frequency < 1 */
+#define CALC_STATUS_YIELD 17               /* yield <= -frequency */
+#define CALC_STATUS_PRICE 18               /* price <= 0 */
+#define CALC_STATUS_YIELD_NOT_FOUND 19     /* yield to maturity did not converge */
+#define CALC_STATUS_DATE_COUNT 20          /* dates (or curve times) and cash_flows differ in length */
+#define CALC_STATUS_NEGATIVE_TIME 21       /* curve payment time < 0 */
+
+/**
+ * Discount-factor cache counters (see pv_calculator_set_cache)
+ *   hits:      PVs served entirely from cached factors
+ *   misses:    PVs that computed a new table or extended one
+ *   evictions: tables dropped (least recently used) for a new rate
+ *   rates:     tables currently cached
+ *   factors:   discount factors currently cached, over all rates
+ */
+typedef struct PVCacheStats {
+    size_t hits;
+    size_t misses;
+    size_t evictions;
+    size_t rates;
+    size_t factors;
+} PVCacheStats;
+
+/**
+ * Price and risk of a fixed-coupon bond (see bond_calculator_analytics)
+ *   price:             PV of coupons and face at the yield
+ *   macaulay_duration: PV-weighted average time of the flows, in years
+ *   modified_duration: -(dP/dyield) / P, in years
+ *   convexity:         (d²P/dyield²) / P, in years²
+ */
+typedef struct BondAnalytics {
+    double price;
+    double macaulay_duration;
+    double modified_duration;
+    double convexity;
+} BondAnalytics;
+
+/**
+ * PV and its rate sensitivities (see pv_calculator_calculate_sensitivities).
+ * Durations and convexity are in the units of the rate (periods when the
+ * rate is per period).
+ *   pv:                present value
+ *   dpv_dr:            dPV/d(discount_rate)
+ *   d2pv_dr2:          d²PV/d(discount_rate)²
+ *   dv01:              -dpv_dr * 0.0001: PV gained when the rate falls 1bp
+ *   modified_duration: -dpv_dr / pv
+ *   convexity:         d2pv_dr2 / pv
+ */
+typedef struct PVSensitivities {
+    double pv;
+    double dpv_dr;
+    double d2pv_dr2;
+    double dv01;
+    double modified_duration;
+    double convexity;
+} PVSensitivities;
 
 // ===========================================================================
 // Present Value Calculator API
@@ -45,6 +128,566 @@ int pv_calculator_calculate(
     double* result
 );
 
+/**
+ * Calculate present values of many cash-flow streams in one call
+ *
+ * Streams are passed in CSR layout: stream i consists of
+ * cash_flows[offsets[i]] .. cash_flows[offsets[i + 1] - 1] and is
+ * discounted at discount_rates[i]. No memory is allocated per stream.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   discount_rates: Array of n_streams discount rates
+ *   cash_flows: Flat array of all cash flows, stream after stream
+ *   offsets: Array of n_streams + 1 non-decreasing offsets into cash_flows
+ *   n_streams: Number of streams
+ *   results: Output array of n_streams present values
+ *
+ * Returns: 0 on success, -1 on error (stops at the first invalid stream;
+ *          results of earlier streams are written, the error names the index)
+ */
+int pv_calculator_calculate_batch(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results
+);
+
+/**
+ * Multi-threaded pv_calculator_calculate_batch
+ *
+ * Streams are split into chunks priced on the library's shared thread pool;
+ * the calling thread takes part. Each result is computed exactly as in the
+ * serial call, so results do not depend on n_threads. Holds no Python
+ * state, so CFFI callers run it with the GIL released.
+ *
+ * Args:
+ *   (as pv_calculator_calculate_batch)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: 0 on success, -1 on error (the error names the lowest invalid
+ *          index; every result before it is written, later ones may not be)
+ *
+ * A handle must not be used by two threads at once; create one per thread.
+ */
+int pv_calculator_calculate_batch_parallel(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    size_t n_threads
+);
+
+/**
+ * pv_calculator_calculate_batch that skips invalid streams
+ *
+ * Every valid stream is priced; an invalid one gets NaN and its
+ * CALC_STATUS_* code, and pricing carries on. Validation never throws, so
+ * a few bad rows in a large batch cost a compare each.
+ *
+ * Args:
+ *   (as pv_calculator_calculate_batch)
+ *   statuses: Output array of n_streams CALC_STATUS_* codes
+ *
+ * Returns: the number of invalid streams (0 = all priced; the error names
+ *          the first), or -1 on null arguments
+ */
+int pv_calculator_calculate_batch_status(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    int* statuses
+);
+
+/**
+ * Multi-threaded pv_calculator_calculate_batch_status
+ *
+ * Args:
+ *   (as pv_calculator_calculate_batch_status)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: as pv_calculator_calculate_batch_status
+ */
+int pv_calculator_calculate_batch_status_parallel(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    int* statuses,
+    size_t n_threads
+);
+
+/**
+ * Present value and its first two rate derivatives in one pass
+ *
+ * Same PV as pv_calculator_calculate, with dPV/dr and d²PV/dr² accumulated
+ * from the same discount factors in the same loop: about the cost of one PV,
+ * instead of three PVs at bumped rates (whose finite differences are also
+ * less accurate). Honors reproducible mode; the discount-factor cache is
+ * not used.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   discount_rate: Discount rate per period (> -1)
+ *   cash_flows: Array of cash flows
+ *   n_cash_flows: Number of cash flows (> 0)
+ *   result: Output parameter for the PV and its sensitivities
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int pv_calculator_calculate_sensitivities(
+    PVCalculatorHandle calc,
+    double discount_rate,
+    const double* cash_flows,
+    size_t n_cash_flows,
+    PVSensitivities* result
+);
+
+/**
+ * Sensitivities of many streams in one call
+ *
+ * Streams use the CSR layout of pv_calculator_calculate_batch.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   discount_rates: Array of n_streams discount rates
+ *   cash_flows: Flat array of all cash flows, stream after stream
+ *   offsets: Array of n_streams + 1 non-decreasing offsets into cash_flows
+ *   n_streams: Number of streams
+ *   results: Output array of n_streams results
+ *
+ * Returns: 0 on success, -1 on error (stops at the first invalid stream;
+ *          results of earlier streams are written, the error names the index)
+ */
+int pv_calculator_calculate_sensitivities_batch(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    PVSensitivities* results
+);
+
+/**
+ * Multi-threaded pv_calculator_calculate_sensitivities_batch
+ *
+ * Args:
+ *   (as pv_calculator_calculate_sensitivities_batch)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: 0 on success, -1 on error (the error names the lowest invalid
+ *          index; every result before it is written, later ones may not be)
+ */
+int pv_calculator_calculate_sensitivities_batch_parallel(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    PVSensitivities* results,
+    size_t n_threads
+);
+
+/**
+ * Present value of single-precision cash flows, in single precision
+ *
+ * For bulk scenario work where ~6-7 significant digits suffice: the kernel
+ * runs twice the SIMD lanes of the double path and reads half the bytes.
+ * The discount base 1 + r is formed in double, and partial sums are widened
+ * to double periodically, so the error stays within a few float ulps of the
+ * discounted mass. Reproducible mode pins the fixed-order scalar kernel; the
+ * discount-factor cache is not used.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   discount_rate: Discount rate per period (> -1)
+ *   cash_flows: Array of float cash flows
+ *   n_cash_flows: Number of cash flows (> 0)
+ *   result: Output parameter for the calculated PV
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int pv_calculator_calculate_f32(
+    PVCalculatorHandle calc,
+    float discount_rate,
+    const float* cash_flows,
+    size_t n_cash_flows,
+    float* result
+);
+
+/**
+ * Present value of single-precision cash flows, accumulated in double
+ *
+ * Same result as pv_calculator_calculate on the flows widened to double, at
+ * half the memory traffic: flows are stored as float, discounted and summed
+ * in double. Reproducible mode and the cache as pv_calculator_calculate_f32.
+ *
+ * Args:
+ *   (as pv_calculator_calculate_f32, with a double rate and result)
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int pv_calculator_calculate_mixed(
+    PVCalculatorHandle calc,
+    double discount_rate,
+    const float* cash_flows,
+    size_t n_cash_flows,
+    double* result
+);
+
+/**
+ * pv_calculator_calculate_f32 over many streams
+ *
+ * Streams use the CSR layout of pv_calculator_calculate_batch.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   discount_rates: Array of n_streams float discount rates
+ *   cash_flows: Flat array of all float cash flows, stream after stream
+ *   offsets: Array of n_streams + 1 non-decreasing offsets into cash_flows
+ *   n_streams: Number of streams
+ *   results: Output array of n_streams float present values
+ *
+ * Returns: 0 on success, -1 on error (stops at the first invalid stream;
+ *          results of earlier streams are written, the error names the index)
+ */
+int pv_calculator_calculate_batch_f32(
+    PVCalculatorHandle calc,
+    const float* discount_rates,
+    const float* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    float* results
+);
+
+/**
+ * Multi-threaded pv_calculator_calculate_batch_f32
+ *
+ * Args:
+ *   (as pv_calculator_calculate_batch_f32)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: 0 on success, -1 on error (the error names the lowest invalid
+ *          index; every result before it is written, later ones may not be)
+ */
+int pv_calculator_calculate_batch_f32_parallel(
+    PVCalculatorHandle calc,
+    const float* discount_rates,
+    const float* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    float* results,
+    size_t n_threads
+);
+
+/**
+ * pv_calculator_calculate_mixed over many streams
+ *
+ * Args:
+ *   (as pv_calculator_calculate_batch_f32, with double rates and results)
+ *
+ * Returns: as pv_calculator_calculate_batch_f32
+ */
+int pv_calculator_calculate_batch_mixed(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const float* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results
+);
+
+/**
+ * Multi-threaded pv_calculator_calculate_batch_mixed
+ *
+ * Args:
+ *   (as pv_calculator_calculate_batch_mixed)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: as pv_calculator_calculate_batch_f32_parallel
+ */
+int pv_calculator_calculate_batch_mixed_parallel(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const float* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    size_t n_threads
+);
+
+/**
+ * Present values of many streams against one or many discount curves
+ *
+ * results[s * n_curves + c] = sum over t of
+ *     cash_flows[s * cash_flow_stride + t] * discount_factors[c * discount_factor_stride + t]
+ *
+ * i.e. the matrix product of the n_streams x n_periods cash-flow matrix and
+ * the transposed n_curves x n_periods discount-factor matrix, computed with a
+ * cache-blocked, register-tiled SIMD kernel. Rows may be padded (stride >
+ * n_periods); padding is never read. Every stream has n_periods periods
+ * (pad shorter streams with zeros). Unaffected by reproducible mode and by
+ * the discount-factor cache.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   cash_flows: Row-major cash-flow matrix, one stream per row
+ *   n_streams: Number of streams (rows of cash_flows)
+ *   n_periods: Periods per stream and per curve (> 0)
+ *   cash_flow_stride: Elements between stream rows (0 = n_periods)
+ *   discount_factors: Row-major discount-factor matrix, one curve per row
+ *                     (factor t discounts period t + 1)
+ *   n_curves: Number of curves (rows of discount_factors)
+ *   discount_factor_stride: Elements between curve rows (0 = n_periods)
+ *   results: Output array of n_streams * n_curves PVs, row-major
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int pv_calculator_calculate_matrix(
+    PVCalculatorHandle calc,
+    const double* cash_flows,
+    size_t n_streams,
+    size_t n_periods,
+    size_t cash_flow_stride,
+    const double* discount_factors,
+    size_t n_curves,
+    size_t discount_factor_stride,
+    double* results
+);
+
+/* Day-count conventions for the XNPV functions */
+#define DAY_COUNT_ACT_365 0  /* actual days / 365 (Excel XNPV) */
+#define DAY_COUNT_ACT_360 1  /* actual days / 360 */
+#define DAY_COUNT_30_360 2   /* 30/360 bond basis */
+
+/**
+ * Present value of cash flows on arbitrary dates (XNPV)
+ *
+ * PV = sum of cash_flows[i] / (1 + discount_rate)^yf(dates[0], dates[i]),
+ * with the year fraction yf given by day_count. Sorted dates are fastest.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   discount_rate: Annually compounded discount rate (> -1)
+ *   dates: Payment dates as days since 1970-01-01 (NumPy datetime64[D])
+ *   cash_flows: Cash flow amounts, aligned with dates
+ *   n_cash_flows: Number of cash flows (> 0)
+ *   day_count: DAY_COUNT_ACT_365, DAY_COUNT_ACT_360 or DAY_COUNT_30_360
+ *   result: Output parameter for the calculated PV
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int pv_calculator_calculate_xnpv(
+    PVCalculatorHandle calc,
+    double discount_rate,
+    const int64_t* dates,
+    const double* cash_flows,
+    size_t n_cash_flows,
+    int day_count,
+    double* result
+);
+
+/**
+ * XNPV of many dated streams in one call
+ *
+ * Streams use the CSR layout of pv_calculator_calculate_batch: stream i is
+ * dates / cash_flows[offsets[i]] .. [offsets[i + 1] - 1], discounted at
+ * discount_rates[i] from its own first date.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   discount_rates: Array of n_streams rates (each > -1)
+ *   dates: Flat array of payment dates (days since 1970-01-01)
+ *   cash_flows: Flat array of cash flows, aligned with dates
+ *   offsets: Array of n_streams + 1 non-decreasing offsets
+ *   n_streams: Number of streams
+ *   day_count: DAY_COUNT_ACT_365, DAY_COUNT_ACT_360 or DAY_COUNT_30_360
+ *   results: Output array of n_streams present values
+ *
+ * Returns: 0 on success, -1 on error (stops at the first invalid stream;
+ *          results of earlier streams are written, the error names the index)
+ */
+int pv_calculator_calculate_xnpv_batch(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const int64_t* dates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    int day_count,
+    double* results
+);
+
+/**
+ * pv_calculator_calculate_xnpv_batch that skips invalid streams
+ *
+ * Every valid stream is priced; an invalid one gets NaN and its
+ * CALC_STATUS_* code.
+ *
+ * Args:
+ *   (as pv_calculator_calculate_xnpv_batch)
+ *   statuses: Output array of n_streams CALC_STATUS_* codes
+ *
+ * Returns: the number of invalid streams (0 = all priced; the error names
+ *          the first), or -1 on null arguments or an unknown day_count
+ */
+int pv_calculator_calculate_xnpv_batch_status(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const int64_t* dates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    int day_count,
+    double* results,
+    int* statuses
+);
+
+/**
+ * Present value of a run-length encoded stream
+ *
+ * Run i pays values[i] in each of counts[i] consecutive periods, following
+ * run i - 1, so the stream is values[0] x counts[0], values[1] x counts[1],
+ * ... Each run is priced by its closed-form annuity, so the cost is O(n_runs)
+ * however many periods the runs span: a 30-year monthly mortgage is one run.
+ * Equals pv_calculator_calculate of the expanded stream (to rounding).
+ * pv_calculator_calculate does not detect runs itself (its SIMD kernel is
+ * already within 10% of detection on level streams), so pass runs here.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   discount_rate: Discount rate per period (> -1)
+ *   values: Cash flow paid in every period of each run
+ *   counts: Periods in each run (zero-length runs are ignored)
+ *   n_runs: Number of runs (they must span at least one period)
+ *   result: Output parameter for the calculated PV
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int pv_calculator_calculate_runs(
+    PVCalculatorHandle calc,
+    double discount_rate,
+    const double* values,
+    const size_t* counts,
+    size_t n_runs,
+    double* result
+);
+
+/**
+ * Present values of many run-length encoded streams in one call
+ *
+ * Streams use the CSR layout of pv_calculator_calculate_batch over runs:
+ * stream i is the runs values / counts[offsets[i]] .. [offsets[i + 1] - 1],
+ * discounted at discount_rates[i].
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   discount_rates: Array of n_streams rates (each > -1)
+ *   values: Flat array of run values, stream after stream
+ *   counts: Flat array of run lengths, aligned with values
+ *   offsets: Array of n_streams + 1 non-decreasing offsets into the runs
+ *   n_streams: Number of streams
+ *   results: Output array of n_streams present values
+ *
+ * Returns: 0 on success, -1 on error (stops at the first invalid stream;
+ *          results of earlier streams are written, the error names the index)
+ */
+int pv_calculator_calculate_runs_batch(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* values,
+    const size_t* counts,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results
+);
+
+/**
+ * pv_calculator_calculate_runs_batch that skips invalid streams
+ *
+ * Every valid stream is priced; an invalid one gets NaN and its
+ * CALC_STATUS_* code.
+ *
+ * Args:
+ *   (as pv_calculator_calculate_runs_batch)
+ *   statuses: Output array of n_streams CALC_STATUS_* codes
+ *
+ * Returns: the number of invalid streams (0 = all priced; the error names
+ *          the first), or -1 on null arguments
+ */
+int pv_calculator_calculate_runs_batch_status(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* values,
+    const size_t* counts,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    int* statuses
+);
+
+/**
+ * Enable or disable bit-reproducible mode for a PV calculator
+ *
+ * By default PV uses the fastest SIMD path of the running CPU, whose
+ * reduction order (and so the last bits of the result) depends on the ISA.
+ * Reproducible mode uses a fixed reduction order that gives bit-identical
+ * results on every machine, at scalar speed.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   enabled: Non-zero to enable, 0 to disable
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int pv_calculator_set_reproducible(PVCalculatorHandle calc, int enabled);
+
+/**
+ * Enable, resize or disable the discount-factor cache of a PV calculator
+ *
+ * With the cache on, the calculator keeps the discount factors
+ * 1 / (1 + r)^t of up to max_rates distinct rates (least recently used
+ * rate dropped first), extended lazily as longer streams arrive. A PV at a
+ * cached rate is then a dot product with the cash flows. Suited to many
+ * PVs over a handful of rates; rates must repeat exactly to hit.
+ *
+ * Used by pv_calculator_calculate and the batches (not in reproducible
+ * mode). A parallel batch builds its rates' tables before the workers
+ * start and they only read them, so its results equal the serial batch's
+ * for every n_threads; the counters then record one lookup per rate. A
+ * parallel batch with more distinct rates than max_rates runs serially.
+ * Cached results may differ from uncached ones in the last bits. Off by
+ * default.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   max_rates: Maximum rates kept (0 = disable); any call drops the
+ *              current cache and resets its counters
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int pv_calculator_set_cache(PVCalculatorHandle calc, size_t max_rates);
+
+/**
+ * Read the discount-factor cache counters (all zero when disabled)
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   stats: Output parameter for the counters
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int pv_calculator_get_cache_stats(PVCalculatorHandle calc, PVCacheStats* stats);
+
 /**
  * Get last error message for PV calculator
  * Returns: Error string (valid until next call or destroy)
@@ -56,6 +699,156 @@ const char* pv_calculator_get_error(PVCalculatorHandle calc);
  */
 void pv_calculator_destroy(PVCalculatorHandle calc);
 
+// ===========================================================================
+// Yield Curve API
+// ===========================================================================
+
+/* Pillar value types for yield_curve_set_pillars */
+#define CURVE_QUOTE_ZERO_RATE 0        /* continuously compounded zero rates */
+#define CURVE_QUOTE_DISCOUNT_FACTOR 1  /* discount factors (> 0) */
+
+/* Interpolation between pillars */
+#define CURVE_INTERP_LINEAR 0          /* zero rate linear in time */
+#define CURVE_INTERP_LOG_LINEAR 1      /* log discount factor linear in time */
+#define CURVE_INTERP_MONOTONE_CUBIC 2  /* monotone cubic spline on zero rates */
+
+/**
+ * Create an empty yield curve (set its pillars before use)
+ * Returns: Handle to curve, or NULL on failure
+ */
+YieldCurveHandle yield_curve_create(void);
+
+/**
+ * Set (or replace) the pillars of a yield curve
+ *
+ * The zero rate is flat before the first and after the last pillar.
+ *
+ * Args:
+ *   curve: Curve handle
+ *   times: Pillar times in years (> 0, strictly increasing)
+ *   values: Pillar values, zero rates or discount factors (see quote)
+ *   n_pillars: Number of pillars (>= 1)
+ *   quote: CURVE_QUOTE_ZERO_RATE or CURVE_QUOTE_DISCOUNT_FACTOR
+ *   interpolation: CURVE_INTERP_LINEAR, CURVE_INTERP_LOG_LINEAR or
+ *                  CURVE_INTERP_MONOTONE_CUBIC
+ *
+ * Returns: 0 on success, -1 on error (the previous pillars are kept)
+ */
+int yield_curve_set_pillars(
+    YieldCurveHandle curve,
+    const double* times,
+    const double* values,
+    size_t n_pillars,
+    int quote,
+    int interpolation
+);
+
+/**
+ * Discount factors of a yield curve at many times
+ *
+ * Args:
+ *   curve: Curve handle
+ *   times: Array of n times in years (>= 0)
+ *   n: Number of times
+ *   results: Output array of n discount factors
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int yield_curve_discount_factors(
+    YieldCurveHandle curve,
+    const double* times,
+    size_t n,
+    double* results
+);
+
+/**
+ * Get last error message for a yield curve
+ * Returns: Error string (valid until next call or destroy)
+ */
+const char* yield_curve_get_error(YieldCurveHandle curve);
+
+/**
+ * Destroy yield curve and free resources
+ */
+void yield_curve_destroy(YieldCurveHandle curve);
+
+/**
+ * Present value of dated cash flows discounted on a yield curve
+ *
+ * PV = sum of cash_flows[i] * DF(times[i]). Time-ordered flows are fastest
+ * (the curve segment is carried from one flow to the next).
+ *
+ * Args:
+ *   calc: Calculator handle (receives the error message)
+ *   curve: Curve handle with pillars set
+ *   times: Payment times in years (>= 0)
+ *   cash_flows: Cash flow amounts
+ *   n_cash_flows: Number of cash flows (> 0)
+ *   result: Output parameter for the calculated PV
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int pv_calculator_calculate_curve(
+    PVCalculatorHandle calc,
+    YieldCurveHandle curve,
+    const double* times,
+    const double* cash_flows,
+    size_t n_cash_flows,
+    double* result
+);
+
+/**
+ * Present values of many dated streams on one yield curve
+ *
+ * Streams use the CSR layout of pv_calculator_calculate_batch: stream i is
+ * times / cash_flows[offsets[i]] .. [offsets[i + 1] - 1].
+ *
+ * Args:
+ *   calc: Calculator handle (receives the error message)
+ *   curve: Curve handle with pillars set
+ *   times: Flat array of payment times in years, stream after stream
+ *   cash_flows: Flat array of cash flows, aligned with times
+ *   offsets: Array of n_streams + 1 non-decreasing offsets
+ *   n_streams: Number of streams
+ *   results: Output array of n_streams present values
+ *
+ * Returns: 0 on success, -1 on error (stops at the first invalid stream;
+ *          results of earlier streams are written, the error names the index)
+ */
+int pv_calculator_calculate_curve_batch(
+    PVCalculatorHandle calc,
+    YieldCurveHandle curve,
+    const double* times,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results
+);
+
+/**
+ * pv_calculator_calculate_curve_batch that skips invalid streams
+ *
+ * Every valid stream is priced; an invalid one gets NaN and its
+ * CALC_STATUS_* code (CALC_STATUS_NEGATIVE_TIME for a time < 0).
+ *
+ * Args:
+ *   (as pv_calculator_calculate_curve_batch)
+ *   statuses: Output array of n_streams CALC_STATUS_* codes
+ *
+ * Returns: the number of invalid streams (0 = all priced; the error names
+ *          the first), or -1 on null arguments or a curve without pillars
+ */
+int pv_calculator_calculate_curve_batch_status(
+    PVCalculatorHandle calc,
+    YieldCurveHandle curve,
+    const double* times,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    int* statuses
+);
+
 // ===========================================================================
 // Future Value Calculator API
 // ===========================================================================
@@ -87,15 +880,121 @@ int fv_calculator_calculate(
 );
 
 /**
- * Get last error message for FV calculator
- * Returns: Error string (valid until next call or destroy)
+ * fv_calculator_calculate in single precision
+ *
+ * Computed in double and rounded once (float inputs widen exactly), so the
+ * result is the correctly rounded float of the double result.
+ *
+ * Returns: 0 on success, -1 on error
  */
-const char* fv_calculator_get_error(FVCalculatorHandle calc);
+int fv_calculator_calculate_f32(
+    FVCalculatorHandle calc,
+    float principal,
+    float interest_rate,
+    int periods,
+    float* result
+);
 
 /**
- * Destroy FV calculator and free resources
+ * Calculate future values for arrays of (principal, rate, periods)
+ *
+ * Structure-of-arrays inputs priced by a vectorized integer-exponent kernel
+ * (AVX-512 / AVX2 when available). Results agree with
+ * fv_calculator_calculate to within ~1 ulp and do not depend on the CPU.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   principals: Array of n initial investments
+ *   interest_rates: Array of n interest rates per period
+ *   periods: Array of n numbers of compounding periods
+ *   n: Number of elements
+ *   results: Output array of n future values
+ *
+ * Returns: 0 on success, -1 on error (stops at the first invalid element;
+ *          earlier results are written, the error names the index)
  */
-void fv_calculator_destroy(FVCalculatorHandle calc);
+int fv_calculator_calculate_batch(
+    FVCalculatorHandle calc,
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t n,
+    double* results
+);
+
+/**
+ * Multi-threaded fv_calculator_calculate_batch
+ *
+ * Args:
+ *   (as fv_calculator_calculate_batch)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: 0 on success, -1 on error (the error names the lowest invalid
+ *          index; every result before it is written, later ones may not be)
+ */
+int fv_calculator_calculate_batch_parallel(
+    FVCalculatorHandle calc,
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t n,
+    double* results,
+    size_t n_threads
+);
+
+/**
+ * fv_calculator_calculate_batch that skips invalid elements
+ *
+ * Runs of valid elements go to the vectorized kernel; an invalid element
+ * gets NaN and its CALC_STATUS_* code.
+ *
+ * Args:
+ *   (as fv_calculator_calculate_batch)
+ *   statuses: Output array of n CALC_STATUS_* codes
+ *
+ * Returns: the number of invalid elements (0 = all priced; the error names
+ *          the first), or -1 on null arguments
+ */
+int fv_calculator_calculate_batch_status(
+    FVCalculatorHandle calc,
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t n,
+    double* results,
+    int* statuses
+);
+
+/**
+ * Multi-threaded fv_calculator_calculate_batch_status
+ *
+ * Args:
+ *   (as fv_calculator_calculate_batch_status)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: as fv_calculator_calculate_batch_status
+ */
+int fv_calculator_calculate_batch_status_parallel(
+    FVCalculatorHandle calc,
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t n,
+    double* results,
+    int* statuses,
+    size_t n_threads
+);
+
+/**
+ * Get last error message for FV calculator
+ * Returns: Error string (valid until next call or destroy)
+ */
+const char* fv_calculator_get_error(FVCalculatorHandle calc);
+
+/**
+ * Destroy FV calculator and free resources
+ */
+void fv_calculator_destroy(FVCalculatorHandle calc);
 
 // ===========================================================================
 // Interest Rate Calculator API
@@ -125,6 +1024,166 @@ int ir_calculator_calculate(
     double* result
 );
 
+/**
+ * ir_calculator_calculate in single precision
+ *
+ * Computed in double and rounded once, as fv_calculator_calculate_f32.
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int ir_calculator_calculate_f32(
+    IRCalculatorHandle calc,
+    float nominal_rate,
+    int compounding_periods,
+    float* result
+);
+
+/**
+ * Convert arrays of (nominal rate, compounding periods) to effective rates
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   nominal_rates: Array of n nominal annual interest rates
+ *   compounding_periods: Array of n compounding periods per year
+ *   n: Number of elements
+ *   results: Output array of n effective annual rates
+ *
+ * Returns: 0 on success, -1 on error (stops at the first invalid element;
+ *          earlier results are written, the error names the index)
+ */
+int ir_calculator_calculate_batch(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    const int* compounding_periods,
+    size_t n,
+    double* results
+);
+
+/**
+ * Multi-threaded ir_calculator_calculate_batch
+ *
+ * Args:
+ *   (as ir_calculator_calculate_batch)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: 0 on success, -1 on error (the error names the lowest invalid
+ *          index; every result before it is written, later ones may not be)
+ */
+int ir_calculator_calculate_batch_parallel(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    const int* compounding_periods,
+    size_t n,
+    double* results,
+    size_t n_threads
+);
+
+/**
+ * Enable or disable tabulated conversion for an IR calculator
+ *
+ * With tabulation on, compounding_periods of 2, 4, 12, 52, 360 and 365 are
+ * read from process-wide EAR tables on a 0.01bp grid instead of computing
+ * (1 + r/n)^n. The first call that enables tabulation in the process builds
+ * all six tables (11 MB and a few ms each); conversions never allocate. Rates on the grid give
+ * the same bits as computing; rates between grid points may differ in the
+ * last bits. Rates outside [-5%, 30%] and other frequencies always compute.
+ *
+ * Used by every ir_calculator_calculate* call except the _f32 one. Off by
+ * default.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   enabled: Non-zero to enable, 0 to disable
+ *
+ * Returns: 0 on success, -1 on error (including tables that could not be
+ *          allocated; tabulation is then off)
+ */
+int ir_calculator_set_tabulated(IRCalculatorHandle calc, int enabled);
+
+/**
+ * Convert an array of nominal rates sharing one compounding frequency
+ *
+ * The rate-normalization form of ir_calculator_calculate_batch; with
+ * tabulation on (ir_calculator_set_tabulated) the rates go through the
+ * vectorized table lookup.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   nominal_rates: Array of n nominal annual interest rates
+ *   n: Number of elements
+ *   compounding_periods: Compounding periods per year for every rate
+ *   results: Output array of n effective annual rates
+ *
+ * Returns: 0 on success, -1 on error (stops at the first invalid element;
+ *          earlier results are written, the error names the index)
+ */
+int ir_calculator_calculate_batch_uniform(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    size_t n,
+    int compounding_periods,
+    double* results
+);
+
+/**
+ * Multi-threaded ir_calculator_calculate_batch_uniform
+ *
+ * Args:
+ *   (as ir_calculator_calculate_batch_uniform)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: 0 on success, -1 on error (the error names the lowest invalid
+ *          index; every result before it is written, later ones may not be)
+ */
+int ir_calculator_calculate_batch_uniform_parallel(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    size_t n,
+    int compounding_periods,
+    double* results,
+    size_t n_threads
+);
+
+/**
+ * ir_calculator_calculate_batch that skips invalid elements
+ *
+ * An invalid element gets NaN and its CALC_STATUS_* code.
+ *
+ * Args:
+ *   (as ir_calculator_calculate_batch)
+ *   statuses: Output array of n CALC_STATUS_* codes
+ *
+ * Returns: the number of invalid elements (0 = all converted; the error
+ *          names the first), or -1 on null arguments
+ */
+int ir_calculator_calculate_batch_status(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    const int* compounding_periods,
+    size_t n,
+    double* results,
+    int* statuses
+);
+
+/**
+ * Multi-threaded ir_calculator_calculate_batch_status
+ *
+ * Args:
+ *   (as ir_calculator_calculate_batch_status)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: as ir_calculator_calculate_batch_status
+ */
+int ir_calculator_calculate_batch_status_parallel(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    const int* compounding_periods,
+    size_t n,
+    double* results,
+    int* statuses,
+    size_t n_threads
+);
+
 /**
  * Get last error message for IR calculator
  * Returns: Error string (valid until next call or destroy)
@@ -136,6 +1195,654 @@ const char* ir_calculator_get_error(IRCalculatorHandle calc);
  */
 void ir_calculator_destroy(IRCalculatorHandle calc);
 
+// ===========================================================================
+// Internal Rate of Return Calculator API
+// ===========================================================================
+
+/**
+ * Create a new IRR calculator (tolerance 1e-12, 100 iterations per phase)
+ * Returns: Handle to calculator, or NULL on failure
+ */
+IRRCalculatorHandle irr_calculator_create(void);
+
+/**
+ * Set the solver's convergence tolerance and iteration limit
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   tolerance: Converged when a step is <= tolerance * max(1, |rate|) (> 0)
+ *   max_iterations: Iteration limit of each solver phase (>= 1)
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int irr_calculator_set_tolerance(IRRCalculatorHandle calc, double tolerance, int max_iterations);
+
+/**
+ * Internal rate of return: the rate at which pv_calculator_calculate of the
+ * stream is zero (Halley steps from the guess, bracketed Newton fallback)
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   cash_flows: Cash flows for periods 1..n (must change sign)
+ *   n_cash_flows: Number of cash flows (> 0)
+ *   guess: Starting rate (> -1), e.g. 0.1 or the stream's previous IRR
+ *   result: Output parameter for the IRR
+ *
+ * Returns: 0 on success, -1 on error (including no IRR found)
+ */
+int irr_calculator_calculate(
+    IRRCalculatorHandle calc,
+    const double* cash_flows,
+    size_t n_cash_flows,
+    double guess,
+    double* result
+);
+
+/**
+ * IRRs of many streams in one call
+ *
+ * Streams use the CSR layout of pv_calculator_calculate_batch.
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   cash_flows: Flat array of cash flows, stream after stream
+ *   offsets: Array of n_streams + 1 non-decreasing offsets
+ *   n_streams: Number of streams
+ *   guesses: Array of n_streams starting rates, or NULL for 0.1 each
+ *   results: Output array of n_streams IRRs
+ *
+ * Returns: 0 on success, -1 on error (stops at the first failing stream;
+ *          results of earlier streams are written, the error names the index)
+ */
+int irr_calculator_calculate_batch(
+    IRRCalculatorHandle calc,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    const double* guesses,
+    double* results
+);
+
+/**
+ * Multi-threaded irr_calculator_calculate_batch
+ *
+ * Args:
+ *   (as irr_calculator_calculate_batch)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: 0 on success, -1 on error (the error names the lowest failing
+ *          stream; every result before it is written, later ones may not be)
+ */
+int irr_calculator_calculate_batch_parallel(
+    IRRCalculatorHandle calc,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    const double* guesses,
+    double* results,
+    size_t n_threads
+);
+
+/**
+ * irr_calculator_calculate_batch that skips failing streams
+ *
+ * Every stream is solved; one that is invalid or has no IRR reachable from
+ * its guess gets NaN and its CALC_STATUS_* code (CALC_STATUS_IRR_NOT_FOUND
+ * for the latter).
+ *
+ * Args:
+ *   (as irr_calculator_calculate_batch)
+ *   statuses: Output array of n_streams CALC_STATUS_* codes
+ *
+ * Returns: the number of failing streams (0 = all solved; the error names
+ *          the first), or -1 on null arguments
+ */
+int irr_calculator_calculate_batch_status(
+    IRRCalculatorHandle calc,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    const double* guesses,
+    double* results,
+    int* statuses
+);
+
+/**
+ * Multi-threaded irr_calculator_calculate_batch_status
+ *
+ * Args:
+ *   (as irr_calculator_calculate_batch_status)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: as irr_calculator_calculate_batch_status
+ */
+int irr_calculator_calculate_batch_status_parallel(
+    IRRCalculatorHandle calc,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    const double* guesses,
+    double* results,
+    int* statuses,
+    size_t n_threads
+);
+
+/**
+ * Get last error message for IRR calculator
+ * Returns: Error string (valid until next call or destroy)
+ */
+const char* irr_calculator_get_error(IRRCalculatorHandle calc);
+
+/**
+ * Destroy IRR calculator and free resources
+ */
+void irr_calculator_destroy(IRRCalculatorHandle calc);
+
+// ===========================================================================
+// Bond Calculator API
+// ===========================================================================
+// A bond is described by its terms, not its cash flows: face (> 0), annual
+// coupon_rate (>= 0), periods (coupons remaining, >= 1) and frequency
+// (coupons per year, >= 1). Coupons of face * coupon_rate / frequency are
+// paid every period and the face with the last one. Yields are annual,
+// compounded frequency times a year; a bond's price equals
+// pv_calculator_calculate of its schedule at yield / frequency.
+//
+// Batches take the terms as parallel arrays of n_bonds entries (one bond
+// per index) and stop at the first invalid bond; the error names its index.
+// The *_batch_status forms carry on instead: a failing bond gets NaN (in
+// every BondAnalytics field) and its CALC_STATUS_* code, and they return the
+// number of failing bonds, or -1 on null arguments.
+
+/**
+ * Create a new bond calculator
+ * Returns: Handle to calculator, or NULL on failure
+ */
+BondCalculatorHandle bond_calculator_create(void);
+
+/**
+ * Price of a bond at an annual yield (closed form, no schedule is built)
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   face, coupon_rate, periods, frequency: Bond terms
+ *   yield: Annual yield (> -frequency)
+ *   result: Output parameter for the price
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int bond_calculator_price(
+    BondCalculatorHandle calc,
+    double face,
+    double coupon_rate,
+    int periods,
+    int frequency,
+    double yield,
+    double* result
+);
+
+/**
+ * Yield to maturity: the annual yield at which the bond prices to price
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   face, coupon_rate, periods, frequency: Bond terms
+ *   price: Market price (> 0)
+ *   result: Output parameter for the yield
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int bond_calculator_yield(
+    BondCalculatorHandle calc,
+    double face,
+    double coupon_rate,
+    int periods,
+    int frequency,
+    double price,
+    double* result
+);
+
+/**
+ * Price, Macaulay / modified duration and convexity in one evaluation
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   face, coupon_rate, periods, frequency: Bond terms
+ *   yield: Annual yield (> -frequency)
+ *   result: Output parameter for the analytics
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int bond_calculator_analytics(
+    BondCalculatorHandle calc,
+    double face,
+    double coupon_rate,
+    int periods,
+    int frequency,
+    double yield,
+    BondAnalytics* result
+);
+
+/**
+ * Prices of a portfolio of bonds, one yield each
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   faces, coupon_rates, periods, frequencies: Arrays of n_bonds terms
+ *   yields: Array of n_bonds annual yields
+ *   n_bonds: Number of bonds
+ *   results: Output array of n_bonds prices
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int bond_calculator_price_batch(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    double* results
+);
+
+/**
+ * Multi-threaded bond_calculator_price_batch
+ *
+ * Args:
+ *   (as bond_calculator_price_batch)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int bond_calculator_price_batch_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    double* results,
+    size_t n_threads
+);
+
+/**
+ * bond_calculator_price_batch that skips failing bonds
+ *
+ * Args:
+ *   (as bond_calculator_price_batch)
+ *   statuses: Output array of n_bonds CALC_STATUS_* codes
+ *
+ * Returns: the number of failing bonds (0 = all priced; the error names the
+ *          first), or -1 on null arguments
+ */
+int bond_calculator_price_batch_status(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    double* results,
+    int* statuses
+);
+
+/**
+ * Multi-threaded bond_calculator_price_batch_status
+ *
+ * Args:
+ *   (as bond_calculator_price_batch_status)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: as bond_calculator_price_batch_status
+ */
+int bond_calculator_price_batch_status_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    double* results,
+    int* statuses,
+    size_t n_threads
+);
+
+/**
+ * Yields to maturity of a portfolio of bonds, one price each
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   faces, coupon_rates, periods, frequencies: Arrays of n_bonds terms
+ *   prices: Array of n_bonds market prices
+ *   n_bonds: Number of bonds
+ *   results: Output array of n_bonds annual yields
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int bond_calculator_yield_batch(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* prices,
+    size_t n_bonds,
+    double* results
+);
+
+/**
+ * Multi-threaded bond_calculator_yield_batch
+ *
+ * Args:
+ *   (as bond_calculator_yield_batch)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int bond_calculator_yield_batch_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* prices,
+    size_t n_bonds,
+    double* results,
+    size_t n_threads
+);
+
+/**
+ * bond_calculator_yield_batch that skips failing bonds
+ *
+ * Args:
+ *   (as bond_calculator_yield_batch)
+ *   statuses: Output array of n_bonds CALC_STATUS_* codes
+ *
+ * Returns: the number of failing bonds (0 = all solved; the error names the
+ *          first), or -1 on null arguments
+ */
+int bond_calculator_yield_batch_status(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* prices,
+    size_t n_bonds,
+    double* results,
+    int* statuses
+);
+
+/**
+ * Multi-threaded bond_calculator_yield_batch_status
+ *
+ * Args:
+ *   (as bond_calculator_yield_batch_status)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: as bond_calculator_yield_batch_status
+ */
+int bond_calculator_yield_batch_status_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* prices,
+    size_t n_bonds,
+    double* results,
+    int* statuses,
+    size_t n_threads
+);
+
+/**
+ * Analytics of a portfolio of bonds, one yield each
+ *
+ * Args:
+ *   calc: Calculator handle
+ *   faces, coupon_rates, periods, frequencies: Arrays of n_bonds terms
+ *   yields: Array of n_bonds annual yields
+ *   n_bonds: Number of bonds
+ *   results: Output array of n_bonds BondAnalytics
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int bond_calculator_analytics_batch(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    BondAnalytics* results
+);
+
+/**
+ * Multi-threaded bond_calculator_analytics_batch
+ *
+ * Args:
+ *   (as bond_calculator_analytics_batch)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int bond_calculator_analytics_batch_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    BondAnalytics* results,
+    size_t n_threads
+);
+
+/**
+ * bond_calculator_analytics_batch that skips failing bonds
+ *
+ * Args:
+ *   (as bond_calculator_analytics_batch)
+ *   statuses: Output array of n_bonds CALC_STATUS_* codes
+ *
+ * Returns: the number of failing bonds (0 = all priced; the error names the
+ *          first), or -1 on null arguments
+ */
+int bond_calculator_analytics_batch_status(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    BondAnalytics* results,
+    int* statuses
+);
+
+/**
+ * Multi-threaded bond_calculator_analytics_batch_status
+ *
+ * Args:
+ *   (as bond_calculator_analytics_batch_status)
+ *   n_threads: Maximum threads including the caller (0 = all cores)
+ *
+ * Returns: as bond_calculator_analytics_batch_status
+ */
+int bond_calculator_analytics_batch_status_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    BondAnalytics* results,
+    int* statuses,
+    size_t n_threads
+);
+
+/**
+ * Get last error message for bond calculator
+ * Returns: Error string (valid until next call or destroy)
+ */
+const char* bond_calculator_get_error(BondCalculatorHandle calc);
+
+/**
+ * Destroy bond calculator and free resources
+ */
+void bond_calculator_destroy(BondCalculatorHandle calc);
+
+// ===========================================================================
+// Thread-Safe Entry Points (*_ex)
+// ===========================================================================
+// The *_ex calls return a CALC_STATUS_* code instead of writing the
+// handle's error string: they only read the handle, so one handle may be
+// shared by any number of threads. They never allocate or throw, including
+// on error paths. The discount-factor cache is bypassed (it is per-handle
+// mutable state); the handle's reproducible and tabulated modes are honoured
+// (ir_calculator_set_tabulated builds the EAR tables up front). Those two
+// setters may run while *_ex calls are in flight: each call uses the mode
+// it reads, and later calls see the new one.
+//
+// Each call also records its status for the calling thread, retrieved with
+// calculator_last_status() / calculator_last_error().
+
+/**
+ * pv_calculator_calculate without handle state
+ *
+ * Args:
+ *   (as pv_calculator_calculate)
+ *
+ * Returns: CALC_STATUS_OK, or the CALC_STATUS_* code of the failure
+ */
+int pv_calculator_calculate_ex(
+    PVCalculatorHandle calc,
+    double discount_rate,
+    const double* cash_flows,
+    size_t n_cash_flows,
+    double* result
+);
+
+/**
+ * pv_calculator_calculate_batch_status without handle state
+ *
+ * Every valid stream is priced; an invalid one gets NaN and its code.
+ *
+ * Args:
+ *   (as pv_calculator_calculate_batch_status)
+ *
+ * Returns: CALC_STATUS_OK, or the code of the first invalid stream
+ */
+int pv_calculator_calculate_batch_ex(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    int* statuses
+);
+
+/**
+ * fv_calculator_calculate without handle state
+ *
+ * Args:
+ *   (as fv_calculator_calculate)
+ *
+ * Returns: CALC_STATUS_OK, or the CALC_STATUS_* code of the failure
+ */
+int fv_calculator_calculate_ex(
+    FVCalculatorHandle calc,
+    double principal,
+    double interest_rate,
+    int periods,
+    double* result
+);
+
+/**
+ * fv_calculator_calculate_batch_status without handle state
+ *
+ * Args:
+ *   (as fv_calculator_calculate_batch_status)
+ *
+ * Returns: CALC_STATUS_OK, or the code of the first invalid element
+ */
+int fv_calculator_calculate_batch_ex(
+    FVCalculatorHandle calc,
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t n,
+    double* results,
+    int* statuses
+);
+
+/**
+ * ir_calculator_calculate without handle state
+ *
+ * Args:
+ *   (as ir_calculator_calculate)
+ *
+ * Returns: CALC_STATUS_OK, or the CALC_STATUS_* code of the failure
+ */
+int ir_calculator_calculate_ex(
+    IRCalculatorHandle calc,
+    double nominal_rate,
+    int compounding_periods,
+    double* result
+);
+
+/**
+ * ir_calculator_calculate_batch_status without handle state
+ *
+ * Args:
+ *   (as ir_calculator_calculate_batch_status)
+ *
+ * Returns: CALC_STATUS_OK, or the code of the first invalid element
+ */
+int ir_calculator_calculate_batch_ex(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    const int* compounding_periods,
+    size_t n,
+    double* results,
+    int* statuses
+);
+
+/**
+ * Status of the calling thread's last *_ex call
+ * Returns: a CALC_STATUS_* code (CALC_STATUS_OK before any call)
+ */
+int calculator_last_status(void);
+
+/**
+ * Text of calculator_last_status()
+ * Returns: static string (see calculator_status_message)
+ */
+const char* calculator_last_error(void);
+
+// ===========================================================================
+// Library Information
+// ===========================================================================
+
+/**
+ * Name of the SIMD code path selected for this CPU at load time
+ * Returns: "avx512", "avx2", "sse2" or "scalar" (static string)
+ */
+const char* calculator_simd_isa(void);
+
+/**
+ * Text of a CALC_STATUS_* code
+ * Returns: "ok", the error message, or "unknown status" (static string)
+ */
+const char* calculator_status_message(int status);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,186 +1,2299 @@
 #include "calculator_c_api.h"
+#include "BondPricing.hpp"
 #include "Calculator.hpp"
 #include "CalculationPolicies.hpp"
+#include "DatedPresentValue.hpp"
+#include "DiscountFactorCache.hpp"
+#include "EarTable.hpp"
+#include "ErrorPolicies.hpp"
+#include "InternalRateOfReturn.hpp"
+#include "MatrixPresentValue.hpp"
+#include "PrecisionPolicies.hpp"
+#include "PresentValueSensitivities.hpp"
+#include "RunLengthPresentValue.hpp"
+#include "SimdKernels.hpp"
+#include "ThreadPool.hpp"
+#include "YieldCurve.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <string>
 #include <cstring>
+#include <mutex>
+#include <span>
+#include <unordered_map>
 #include <vector>
 
 // ===========================================================================
 // Internal Wrapper Structs (implementation of opaque handles)
 // ===========================================================================
 
+// Calculators report invalid input as Expected<> (StatusErrorPolicy): no
+// exception is thrown on the pricing paths, and try/catch is left only
+// around calls that can fail to allocate
+
 struct PVCalculator_t {
-    Calculator<PresentValuePolicy> calc;
+    Calculator<SimdPresentValuePolicy, StatusErrorPolicy> calc;
+    Calculator<ReproducibleSimdPresentValuePolicy, StatusErrorPolicy> reproducible_calc;
+    std::atomic<bool> reproducible{false};  // set while *_ex calls may read it
+    std::unique_ptr<DiscountFactorCache> cache;  // null = disabled
     std::string last_error;
+
+    bool is_reproducible() const noexcept {
+        return reproducible.load(std::memory_order_relaxed);
+    }
 };
 
 struct FVCalculator_t {
-    Calculator<FutureValuePolicy> calc;
+    Calculator<FutureValuePolicy, StatusErrorPolicy> calc;
     std::string last_error;
 };
 
 struct IRCalculator_t {
-    Calculator<InterestRateConversionPolicy> calc;
+    Calculator<InterestRateConversionPolicy, StatusErrorPolicy> calc;
+    Calculator<TabulatedInterestRateConversionPolicy, StatusErrorPolicy> tabulated_calc;
+    std::atomic<bool> tabulated{false};  // set while *_ex calls may read it
+    std::string last_error;
+
+    bool is_tabulated() const noexcept {
+        return tabulated.load(std::memory_order_relaxed);
+    }
+
+    Expected<double> convert(double nominal_rate, int compounding_periods) const noexcept {
+        return is_tabulated() ? tabulated_calc.calculate(nominal_rate, compounding_periods)
+                         : calc.calculate(nominal_rate, compounding_periods);
+    }
+};
+
+struct IRRCalculator_t {
+    IrrOptions options;
+    std::string last_error;
+};
+
+struct BondCalculator_t {
+    Calculator<BondPricingPolicy, StatusErrorPolicy> calc;
+    std::string last_error;
+};
+
+struct YieldCurve_t {
+    std::optional<YieldCurve> curve;  // empty until pillars are set
     std::string last_error;
 };
 
 // ===========================================================================
-// C API (exported with C linkage so symbols are unmangled for CFFI)
+// Batch Helpers (shared by the serial and thread-pool batch entry points)
 // ===========================================================================
+// Each *_batch_range prices [begin, end) and returns the index of the first
+// invalid element, or kNoError. run_batch drives a range serially or over
+// the shared ThreadPool and reports the lowest invalid index overall.
+
+namespace {
+
+static_assert(static_cast<int>(CalcError::DiscountRate) == CALC_STATUS_DISCOUNT_RATE
+              && static_cast<int>(CalcError::EmptyCashFlows) == CALC_STATUS_EMPTY_CASH_FLOWS
+              && static_cast<int>(CalcError::Principal) == CALC_STATUS_PRINCIPAL
+              && static_cast<int>(CalcError::InterestRate) == CALC_STATUS_INTEREST_RATE
+              && static_cast<int>(CalcError::Periods) == CALC_STATUS_PERIODS
+              && static_cast<int>(CalcError::NominalRate) == CALC_STATUS_NOMINAL_RATE
+              && static_cast<int>(CalcError::CompoundingPeriods) == CALC_STATUS_COMPOUNDING_PERIODS
+              && static_cast<int>(CalcError::Offsets) == CALC_STATUS_OFFSETS
+              && static_cast<int>(CalcError::SignChange) == CALC_STATUS_SIGN_CHANGE
+              && static_cast<int>(CalcError::Guess) == CALC_STATUS_GUESS
+              && static_cast<int>(CalcError::IrrNotFound) == CALC_STATUS_IRR_NOT_FOUND
+              && static_cast<int>(CalcError::Face) == CALC_STATUS_FACE
+              && static_cast<int>(CalcError::CouponRate) == CALC_STATUS_COUPON_RATE
+              && static_cast<int>(CalcError::BondPeriods) == CALC_STATUS_BOND_PERIODS
+              && static_cast<int>(CalcError::Frequency) == CALC_STATUS_FREQUENCY
+              && static_cast<int>(CalcError::Yield) == CALC_STATUS_YIELD
+              && static_cast<int>(CalcError::Price) == CALC_STATUS_PRICE
+              && static_cast<int>(CalcError::YieldNotFound) == CALC_STATUS_YIELD_NOT_FOUND
+              && static_cast<int>(CalcError::DateCount) == CALC_STATUS_DATE_COUNT
+              && static_cast<int>(CalcError::NegativeTime) == CALC_STATUS_NEGATIVE_TIME,
+              "CALC_STATUS_* codes must match CalcError");
+
+constexpr size_t kNoError = static_cast<size_t>(-1);
+
+constexpr double kInvalidResult = std::numeric_limits<double>::quiet_NaN();
+
+// Elements per pool chunk: small enough to balance uneven streams, large
+// enough that claiming a chunk is negligible next to pricing it
+constexpr size_t kBatchChunk = 256;
+
+// Rates per check-then-convert block of the uniform EAR batch (16 KiB)
+constexpr size_t kUniformBlock = 2048;
+
+template <typename Range>
+size_t run_batch(size_t n, size_t n_threads, Range&& range) {
+    if (n_threads == 1) {
+        return range(size_t{0}, n);
+    }
+
+    std::atomic<size_t> first_error{kNoError};
+    const size_t n_chunks = (n + kBatchChunk - 1) / kBatchChunk;
+    ThreadPool::instance().parallel_for(n_chunks, n_threads, [&](size_t chunk) {
+        const size_t begin = chunk * kBatchChunk;
+        const size_t bad = range(begin, std::min(n, begin + kBatchChunk));
+        size_t current = first_error.load(std::memory_order_relaxed);
+        while (bad < current && !first_error.compare_exchange_weak(current, bad)) {
+        }
+    });
+    return first_error.load();
+}
+
+template <typename Rate>
+CalcError pv_stream_status(const Rate* discount_rates, const size_t* offsets, size_t i) {
+    if (offsets[i + 1] < offsets[i]) {
+        return CalcError::Offsets;
+    }
+    if (offsets[i + 1] == offsets[i]) {
+        return CalcError::EmptyCashFlows;
+    }
+    if (discount_rates[i] <= Rate(-1)) {
+        return CalcError::DiscountRate;
+    }
+    return CalcError::None;
+}
+
+template <typename Rate>
+const char* pv_stream_error(const Rate* discount_rates, const size_t* offsets, size_t i) {
+    return error_message(pv_stream_status(discount_rates, offsets, i));
+}
+
+// Single entry points: the value, or the error's message in the handle
+template <typename Handle, typename T>
+int store_result(Handle calc, const Expected<T>& value, T* result) {
+    if (!value) {
+        calc->last_error = error_message(value.error());
+        return -1;
+    }
+    *result = *value;
+    calc->last_error.clear();
+    return 0;
+}
+
+// Status of this thread's last *_ex call: a code, never a string, so
+// recording it cannot allocate
+thread_local int tls_last_status = CALC_STATUS_OK;
+
+int record_status(int status) noexcept {
+    tls_last_status = status;
+    return status;
+}
+
+template <typename T>
+int record_status(const Expected<T>& value, T* result) noexcept {
+    if (value) {
+        *result = *value;
+    }
+    return record_status(static_cast<int>(value.error()));
+}
+
+int record_first_status(size_t bad, const int* statuses) noexcept {
+    return record_status(bad == kNoError ? CALC_STATUS_OK : statuses[bad]);
+}
+
+// Status batches: ranges price every valid element, mark each element's
+// CALC_STATUS_* code and return the first invalid index (or kNoError).
+// The call returns the number of invalid elements; the handle's error
+// names the first one ("<label> <index>: <message>").
+template <typename Handle, typename Range>
+int status_batch(Handle calc, size_t n, const int* statuses, size_t n_threads, const char* label,
+                 Range&& range) {
+    try {
+        const size_t bad = run_batch(n, n_threads, range);
+        if (bad == kNoError) {
+            calc->last_error.clear();
+            return 0;
+        }
+        const size_t invalid = static_cast<size_t>(
+            std::count_if(statuses + bad, statuses + n, [](int status) { return status != CALC_STATUS_OK; }));
+        calc->last_error = std::string(label) + " " + std::to_string(bad) + ": "
+                         + calculator_status_message(statuses[bad]);
+        return static_cast<int>(std::min<size_t>(invalid, INT_MAX));
+    } catch (const std::exception& e) {
+        calc->last_error = e.what();
+        return -1;
+    }
+}
+
+// PV as a dot product against cached discount factors (rate already checked)
+double pv_cached(DiscountFactorCache& cache, double discount_rate, const double* cash_flows, size_t n) {
+    const std::span<const double> df = cache.factors(discount_rate, n);
+    return simd::dot(cash_flows, df.data(), n);
+}
+
+// Discount factors of a batch: the handle's cache (null when off). The
+// serial path fills it as it goes; a parallel batch fills it up front and
+// its workers only read it, so no thread writes while others price.
+struct FactorSource {
+    DiscountFactorCache* cache = nullptr;
+    bool prefilled = false;
+};
+
+// Factor source of a batch over n_threads. A parallel batch builds every
+// valid stream's table here, on the calling thread, so each stream is the
+// same dot product as in the serial call and results do not depend on the
+// thread count. A batch with more distinct rates than the cache holds
+// cannot be prefilled: n_threads is set to 1 and it runs serially.
+FactorSource batch_factors(PVCalculator_t& calc, const double* discount_rates, const size_t* offsets,
+                           size_t n_streams, size_t& n_threads) {
+    if (!calc.cache || calc.is_reproducible()) {
+        return {};
+    }
+    if (n_threads == 1) {
+        return {calc.cache.get(), false};
+    }
+
+    // Longest valid stream per rate, keyed as the cache keys rates
+    std::unordered_map<std::uint64_t, std::pair<double, size_t>> lengths;
+    for (size_t i = 0; i < n_streams; ++i) {
+        if (pv_stream_status(discount_rates, offsets, i) != CalcError::None) {
+            continue;
+        }
+        auto& [rate, n] = lengths[std::bit_cast<std::uint64_t>(discount_rates[i] + 0.0)];
+        rate = discount_rates[i];
+        n = std::max(n, offsets[i + 1] - offsets[i]);
+    }
+    if (lengths.size() > calc.cache->max_rates()) {
+        n_threads = 1;
+        return {calc.cache.get(), false};
+    }
+    for (const auto& [key, table] : lengths) {
+        calc.cache->factors(table.first, table.second);
+    }
+    return {calc.cache.get(), true};
+}
+
+// PV of one valid stream on the handle's mode and factor source
+double pv_stream(const PVCalculator_t& calc, const FactorSource& factors, double discount_rate,
+                 const double* stream, size_t n) {
+    const double base = 1.0 + discount_rate;
+    if (calc.is_reproducible()) {
+        return simd::present_value_reproducible(base, stream, n);
+    }
+    if (factors.prefilled) {
+        return simd::dot(stream, factors.cache->find(discount_rate, n).data(), n);
+    }
+    if (factors.cache) {
+        return pv_cached(*factors.cache, discount_rate, stream, n);
+    }
+    return simd::present_value(base, stream, n);
+}
+
+size_t pv_batch_range(
+    const PVCalculator_t& calc,
+    const FactorSource& factors,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t begin,
+    size_t end,
+    double* results
+) {
+    for (size_t i = begin; i < end; ++i) {
+        if (pv_stream_error(discount_rates, offsets, i)) {
+            return i;
+        }
+        results[i] = pv_stream(calc, factors, discount_rates[i], cash_flows + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return kNoError;
+}
+
+size_t pv_status_range(
+    const PVCalculator_t& calc,
+    const FactorSource& factors,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t begin,
+    size_t end,
+    double* results,
+    int* statuses
+) {
+    size_t first_bad = kNoError;
+    for (size_t i = begin; i < end; ++i) {
+        const CalcError error = pv_stream_status(discount_rates, offsets, i);
+        statuses[i] = static_cast<int>(error);
+        if (error != CalcError::None) {
+            results[i] = kInvalidResult;
+            first_bad = std::min(first_bad, i);
+            continue;
+        }
+        results[i] = pv_stream(calc, factors, discount_rates[i], cash_flows + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return first_bad;
+}
+
+int pv_batch(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    size_t n_threads
+) {
+    if (!calc || !discount_rates || !cash_flows || !offsets || !results) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    try {
+        const FactorSource factors = batch_factors(*calc, discount_rates, offsets, n_streams, n_threads);
+        const size_t bad = run_batch(n_streams, n_threads, [&](size_t begin, size_t end) {
+            return pv_batch_range(*calc, factors, discount_rates, cash_flows, offsets, begin, end, results);
+        });
+        if (bad != kNoError) {
+            calc->last_error = "stream " + std::to_string(bad) + ": "
+                             + pv_stream_error(discount_rates, offsets, bad);
+            return -1;
+        }
+        calc->last_error.clear();
+        return 0;
+    } catch (const std::exception& e) {
+        calc->last_error = e.what();
+        return -1;
+    }
+}
+
+PVSensitivities to_c(const PvSensitivities& s) {
+    return {s.pv, s.dpv_dr, s.d2pv_dr2, s.dv01, s.modified_duration, s.convexity};
+}
+
+// Sensitivities on the handle's mode (rate already checked)
+PvSensitivities pv_sensitivities(const PVCalculator_t& calc, double discount_rate, const double* cash_flows,
+                                 size_t n) {
+    if (calc.is_reproducible()) {
+        return ReproducibleSensitivityPolicy::accumulate(discount_rate, cash_flows, n);
+    }
+    return PresentValueSensitivityPolicy::accumulate(discount_rate, cash_flows, n);
+}
+
+int sensitivities_batch(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    PVSensitivities* results,
+    size_t n_threads
+) {
+    if (!calc || !discount_rates || !cash_flows || !offsets || !results) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    try {
+        const size_t bad = run_batch(n_streams, n_threads, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (pv_stream_error(discount_rates, offsets, i)) {
+                    return i;
+                }
+                results[i] = to_c(pv_sensitivities(*calc, discount_rates[i], cash_flows + offsets[i],
+                                                   offsets[i + 1] - offsets[i]));
+            }
+            return kNoError;
+        });
+        if (bad != kNoError) {
+            calc->last_error = "stream " + std::to_string(bad) + ": "
+                             + pv_stream_error(discount_rates, offsets, bad);
+            return -1;
+        }
+        calc->last_error.clear();
+        return 0;
+    } catch (const std::exception& e) {
+        calc->last_error = e.what();
+        return -1;
+    }
+}
+
+// PV of float flows on the handle's mode: single precision for a float rate,
+// double accumulation (mixed) for a double rate. Reproducible mode pins the
+// scalar kernels; the discount-factor cache holds double factors and is
+// not used.
+float pv_stream_typed(const PVCalculator_t& calc, float discount_rate, const float* stream, size_t n) {
+    const double base = 1.0 + static_cast<double>(discount_rate);
+    return calc.is_reproducible() ? simd::present_value_f32(simd::Isa::Scalar, base, stream, n)
+                             : simd::present_value_f32(base, stream, n);
+}
+
+double pv_stream_typed(const PVCalculator_t& calc, double discount_rate, const float* stream, size_t n) {
+    const double base = 1.0 + discount_rate;
+    return calc.is_reproducible() ? simd::present_value_mixed(simd::Isa::Scalar, base, stream, n)
+                             : simd::present_value_mixed(base, stream, n);
+}
+
+// *_f32 (Rate = float) and *_mixed (Rate = double) single calls: results
+// have the rate's type
+template <typename Rate>
+int typed_single(PVCalculatorHandle calc, Rate discount_rate, const float* cash_flows, size_t n_cash_flows,
+                 Rate* result) {
+    if (!calc || !cash_flows || !result || n_cash_flows == 0) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer or empty cash flows";
+        }
+        return -1;
+    }
+    if (const CalcError error = present_value_error(static_cast<double>(discount_rate), n_cash_flows);
+        error != CalcError::None) {
+        calc->last_error = error_message(error);
+        return -1;
+    }
+
+    *result = pv_stream_typed(*calc, discount_rate, cash_flows, n_cash_flows);
+    calc->last_error.clear();
+    return 0;
+}
+
+template <typename Rate>
+int typed_batch(
+    PVCalculatorHandle calc,
+    const Rate* discount_rates,
+    const float* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    Rate* results,
+    size_t n_threads
+) {
+    if (!calc || !discount_rates || !cash_flows || !offsets || !results) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    try {
+        const size_t bad = run_batch(n_streams, n_threads, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (pv_stream_error(discount_rates, offsets, i)) {
+                    return i;
+                }
+                results[i] = pv_stream_typed(*calc, discount_rates[i], cash_flows + offsets[i],
+                                             offsets[i + 1] - offsets[i]);
+            }
+            return kNoError;
+        });
+        if (bad != kNoError) {
+            calc->last_error = "stream " + std::to_string(bad) + ": "
+                             + pv_stream_error(discount_rates, offsets, bad);
+            return -1;
+        }
+        calc->last_error.clear();
+        return 0;
+    } catch (const std::exception& e) {
+        calc->last_error = e.what();
+        return -1;
+    }
+}
+
+// Curve PV of stream i of a CSR batch
+Expected<double> curve_batch_stream(const YieldCurve& curve, const double* times, const double* cash_flows,
+                                    const size_t* offsets, size_t i) {
+    if (offsets[i + 1] < offsets[i]) {
+        return CalcError::Offsets;
+    }
+    const size_t n = offsets[i + 1] - offsets[i];
+    return StatusErrorPolicy::call<CurvePresentValuePolicy>(
+        curve, std::span<const double>(times + offsets[i], n), std::span<const double>(cash_flows + offsets[i], n));
+}
+
+// PV of runs held as parallel value / count arrays (no CashFlowRun copy)
+Expected<double> runs_pv(double discount_rate, const double* values, const size_t* counts, size_t n_runs) {
+    size_t periods = 0;
+    for (size_t i = 0; i < n_runs; ++i) {
+        periods += counts[i];
+    }
+    if (const CalcError error = present_value_error(discount_rate, periods); error != CalcError::None) {
+        return error;
+    }
+    return RunLengthPresentValuePolicy::accumulate(discount_rate, values, counts, n_runs);
+}
+
+// Run-length PV of stream i of a CSR batch (offsets index the runs)
+Expected<double> runs_batch_stream(const double* discount_rates, const double* values, const size_t* counts,
+                                   const size_t* offsets, size_t i) {
+    if (offsets[i + 1] < offsets[i]) {
+        return CalcError::Offsets;
+    }
+    return runs_pv(discount_rates[i], values + offsets[i], counts + offsets[i], offsets[i + 1] - offsets[i]);
+}
+
+// Curve handle usable for pricing, or nullptr with calc's error set
+const YieldCurve* priced_curve(PVCalculatorHandle calc, YieldCurveHandle curve) {
+    if (!curve) {
+        calc->last_error = "Invalid arguments: null pointer";
+        return nullptr;
+    }
+    if (!curve->curve) {
+        calc->last_error = "yield curve has no pillars";
+        return nullptr;
+    }
+    return &*curve->curve;
+}
+
+// Calls f(XnpvPolicy<DayCount>{}) for a DAY_COUNT_* constant; false if unknown
+template <typename F>
+bool with_day_count(int day_count, F&& f) {
+    switch (day_count) {
+        case DAY_COUNT_ACT_365: f(XnpvPolicy<Actual365Fixed>{}); return true;
+        case DAY_COUNT_ACT_360: f(XnpvPolicy<Actual360>{}); return true;
+        case DAY_COUNT_30_360:  f(XnpvPolicy<Thirty360>{}); return true;
+        default:                return false;
+    }
+}
+
+// FV batches: validate a range up front, then price the valid prefix with the
+// vectorized kernel in one call
+size_t fv_batch_range(
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t begin,
+    size_t end,
+    double* results
+) {
+    size_t valid_end = begin;
+    while (valid_end < end
+           && !SimdFutureValuePolicy::check(principals[valid_end], interest_rates[valid_end], periods[valid_end])) {
+        ++valid_end;
+    }
+    simd::future_value(principals + begin, interest_rates + begin, periods + begin,
+                       valid_end - begin, results + begin);
+    return valid_end == end ? kNoError : valid_end;
+}
+
+// Status form: each run of valid elements goes to the vectorized kernel in
+// one call, invalid elements are marked in between
+size_t fv_status_range(
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t begin,
+    size_t end,
+    double* results,
+    int* statuses
+) {
+    size_t first_bad = kNoError;
+    size_t run_begin = begin;
+    for (size_t i = begin; i < end; ++i) {
+        const CalcError error = FutureValuePolicy::validate(principals[i], interest_rates[i], periods[i]);
+        statuses[i] = static_cast<int>(error);
+        if (error == CalcError::None) {
+            continue;
+        }
+        simd::future_value(principals + run_begin, interest_rates + run_begin, periods + run_begin,
+                           i - run_begin, results + run_begin);
+        results[i] = kInvalidResult;
+        first_bad = std::min(first_bad, i);
+        run_begin = i + 1;
+    }
+    simd::future_value(principals + run_begin, interest_rates + run_begin, periods + run_begin,
+                       end - run_begin, results + run_begin);
+    return first_bad;
+}
+
+size_t ir_status_range(
+    IRCalculator_t& calc,
+    const double* nominal_rates,
+    const int* compounding_periods,
+    size_t begin,
+    size_t end,
+    double* results,
+    int* statuses
+) {
+    size_t first_bad = kNoError;
+    for (size_t i = begin; i < end; ++i) {
+        const Expected<double> ear = calc.convert(nominal_rates[i], compounding_periods[i]);
+        statuses[i] = static_cast<int>(ear.error());
+        results[i] = ear.value_or(kInvalidResult);
+        if (!ear) {
+            first_bad = std::min(first_bad, i);
+        }
+    }
+    return first_bad;
+}
+
+// Elementwise batches over solvers and closed forms: element(i) is the
+// policy's Expected<> for index i (validate, then evaluate), so no element
+// throws. A failing range records its first error; the batch reports the
+// lowest one ("<label> <index>: <message>") without re-running it.
+struct FirstFailure {
+    std::mutex mutex;
+    size_t index = kNoError;
+    CalcError error = CalcError::None;
+
+    void record(size_t i, CalcError e) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (i < index) {
+            index = i;
+            error = e;
+        }
+    }
+};
+
+template <typename Handle, typename Result, typename Element>
+int elementwise_batch(Handle calc, size_t n, Result* results, size_t n_threads, const char* label,
+                      Element&& element) {
+    try {
+        FirstFailure failure;
+        const size_t bad = run_batch(n, n_threads, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const auto value = element(i);
+                if (!value) {
+                    failure.record(i, value.error());
+                    return i;
+                }
+                results[i] = *value;
+            }
+            return kNoError;
+        });
+        if (bad != kNoError) {
+            calc->last_error = std::string(label) + " " + std::to_string(bad) + ": "
+                             + error_message(failure.error);
+            return -1;
+        }
+        calc->last_error.clear();
+        return 0;
+    } catch (const std::exception& e) {
+        calc->last_error = e.what();
+        return -1;
+    }
+}
+
+// Status form: every element priced or marked with its code and `invalid`
+template <typename Result, typename Element>
+size_t elementwise_status_range(size_t begin, size_t end, Result* results, int* statuses,
+                                const Result& invalid, Element&& element) {
+    size_t first_bad = kNoError;
+    for (size_t i = begin; i < end; ++i) {
+        const auto value = element(i);
+        statuses[i] = static_cast<int>(value.error());
+        results[i] = value.value_or(invalid);
+        if (!value) {
+            first_bad = std::min(first_bad, i);
+        }
+    }
+    return first_bad;
+}
+
+template <typename Handle, typename Result, typename Element>
+int elementwise_status_batch(Handle calc, size_t n, Result* results, int* statuses, size_t n_threads,
+                             const char* label, const Result& invalid, Element&& element) {
+    return status_batch(calc, n, statuses, n_threads, label, [&](size_t begin, size_t end) {
+        return elementwise_status_range(begin, end, results, statuses, invalid, element);
+    });
+}
+
+// IRR of one stream with the handle's solver options
+Expected<double> irr_stream(const IRRCalculator_t& calc, const double* cash_flows, size_t n, double guess) {
+    if (const CalcError error = InternalRateOfReturnPolicy::validate(cash_flows, n, guess);
+        error != CalcError::None) {
+        return error;
+    }
+    const Expected<IrrSolution> solution = InternalRateOfReturnPolicy::search(cash_flows, n, guess, calc.options);
+    if (!solution) {
+        return solution.error();
+    }
+    return solution->rate;
+}
+
+// IRR of stream i of a CSR batch (guesses may be null)
+Expected<double> irr_batch_stream(const IRRCalculator_t& calc, const double* cash_flows, const size_t* offsets,
+                                  const double* guesses, size_t i) {
+    if (offsets[i + 1] < offsets[i]) {
+        return CalcError::Offsets;
+    }
+    const double guess = guesses ? guesses[i] : InternalRateOfReturnPolicy::kDefaultGuess;
+    return irr_stream(calc, cash_flows + offsets[i], offsets[i + 1] - offsets[i], guess);
+}
+
+// XNPV of stream i of a CSR batch
+template <typename Policy>
+Expected<double> xnpv_batch_stream(const double* discount_rates, const int64_t* dates, const double* cash_flows,
+                                   const size_t* offsets, size_t i) {
+    if (const CalcError error = pv_stream_status(discount_rates, offsets, i); error != CalcError::None) {
+        return error;
+    }
+    return Policy::accumulate(discount_rates[i], dates + offsets[i], cash_flows + offsets[i],
+                              offsets[i + 1] - offsets[i]);
+}
+
+// Bond terms of element i of the parallel batch arrays
+BondTerms bond_terms(const double* faces, const double* coupon_rates, const int* periods,
+                     const int* frequencies, size_t i) {
+    return BondTerms{faces[i], coupon_rates[i], periods[i], frequencies[i]};
+}
+
+BondAnalytics to_c(const BondPricingPolicy::Analytics& a) {
+    return BondAnalytics{a.price, a.macaulay_duration, a.modified_duration, a.convexity};
+}
+
+constexpr BondAnalytics kInvalidAnalytics{kInvalidResult, kInvalidResult, kInvalidResult, kInvalidResult};
+
+// Per-bond calls of the entry points (the price goes through the handle's
+// StatusErrorPolicy calculator)
+Expected<double> bond_price(const BondCalculator_t& calc, const BondTerms& bond, double yield) {
+    return calc.calc.calculate(bond, yield);
+}
+
+Expected<double> bond_yield(const BondCalculator_t&, const BondTerms& bond, double price) {
+    if (const CalcError error = BondPricingPolicy::validate_price(bond, price); error != CalcError::None) {
+        return error;
+    }
+    return BondPricingPolicy::evaluate_yield(bond, price);
+}
+
+Expected<BondAnalytics> bond_analytics(const BondCalculator_t&, const BondTerms& bond, double yield) {
+    if (const CalcError error = BondPricingPolicy::validate(bond, yield); error != CalcError::None) {
+        return error;
+    }
+    return to_c(BondPricingPolicy::evaluate_analytics(bond, yield));
+}
+
+// Single-bond entry points: null checks, then the policy call
+template <typename Result, typename F>
+int bond_single(BondCalculatorHandle calc, const BondTerms& bond, double value, Result* result, F&& f) {
+    if (!calc || !result) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    return store_result(calc, f(*calc, bond, value), result);
+}
+
+// Batch entry points: null checks on the term arrays, then one policy call
+// per bond; statuses selects the status form (null: stop at the first
+// invalid bond)
+template <typename Result, typename F>
+int bond_batch(BondCalculatorHandle calc, const double* faces, const double* coupon_rates,
+               const int* periods, const int* frequencies, const double* values, size_t n_bonds,
+               Result* results, int* statuses, size_t n_threads, const Result& invalid, F&& f) {
+    if (!calc || !faces || !coupon_rates || !periods || !frequencies || !values || !results) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    const auto element = [&](size_t i) {
+        return f(*calc, bond_terms(faces, coupon_rates, periods, frequencies, i), values[i]);
+    };
+    if (statuses) {
+        return elementwise_status_batch(calc, n_bonds, results, statuses, n_threads, "bond", invalid, element);
+    }
+    return elementwise_batch(calc, n_bonds, results, n_threads, "bond", element);
+}
+
+} // namespace
+
+// ===========================================================================
+// C API (exported with C linkage so symbols are unmangled for CFFI)
+// ===========================================================================
+
+extern "C" {
+
+// ===========================================================================
+// Present Value Calculator Implementation
+// ===========================================================================
+
+PVCalculatorHandle pv_calculator_create(void) {
+    try {
+        return new PVCalculator_t();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+int pv_calculator_calculate(
+    PVCalculatorHandle calc,
+    double discount_rate,
+    const double* cash_flows,
+    size_t n_cash_flows,
+    double* result
+) {
+    if (!calc || !cash_flows || !result || n_cash_flows == 0) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer or empty cash flows";
+        }
+        return -1;
+    }
+
+    // View the caller's buffer directly (no copy, no allocation)
+    const std::span<const double> cf_view(cash_flows, n_cash_flows);
+    if (calc->is_reproducible()) {
+        return store_result(calc, calc->reproducible_calc.calculate(discount_rate, cf_view), result);
+    }
+    if (!calc->cache || discount_rate <= -1.0) {
+        return store_result(calc, calc->calc.calculate(discount_rate, cf_view), result);
+    }
+
+    // Filling the cache allocates
+    try {
+        *result = pv_cached(*calc->cache, discount_rate, cash_flows, n_cash_flows);
+        calc->last_error.clear();
+        return 0;
+    } catch (const std::exception& e) {
+        calc->last_error = e.what();
+        return -1;
+    }
+}
+
+int pv_calculator_calculate_batch(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results
+) {
+    return pv_batch(calc, discount_rates, cash_flows, offsets, n_streams, results, 1);
+}
+
+int pv_calculator_calculate_batch_parallel(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    size_t n_threads
+) {
+    return pv_batch(calc, discount_rates, cash_flows, offsets, n_streams, results, n_threads);
+}
+
+int pv_calculator_calculate_batch_status(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    int* statuses
+) {
+    return pv_calculator_calculate_batch_status_parallel(
+        calc, discount_rates, cash_flows, offsets, n_streams, results, statuses, 1);
+}
+
+int pv_calculator_calculate_batch_status_parallel(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    int* statuses,
+    size_t n_threads
+) {
+    if (!calc || !discount_rates || !cash_flows || !offsets || !results || !statuses) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    FactorSource factors;
+    try {
+        factors = batch_factors(*calc, discount_rates, offsets, n_streams, n_threads);
+    } catch (const std::exception& e) {
+        calc->last_error = e.what();
+        return -1;
+    }
+    return status_batch(calc, n_streams, statuses, n_threads, "stream", [&](size_t begin, size_t end) {
+        return pv_status_range(*calc, factors, discount_rates, cash_flows, offsets, begin, end, results, statuses);
+    });
+}
+
+int pv_calculator_calculate_sensitivities(
+    PVCalculatorHandle calc,
+    double discount_rate,
+    const double* cash_flows,
+    size_t n_cash_flows,
+    PVSensitivities* result
+) {
+    if (!calc || !cash_flows || !result || n_cash_flows == 0) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer or empty cash flows";
+        }
+        return -1;
+    }
+    if (discount_rate <= -1.0) {
+        calc->last_error = "discount_rate must be > -1";
+        return -1;
+    }
+
+    *result = to_c(pv_sensitivities(*calc, discount_rate, cash_flows, n_cash_flows));
+    calc->last_error.clear();
+    return 0;
+}
+
+int pv_calculator_calculate_sensitivities_batch(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    PVSensitivities* results
+) {
+    return sensitivities_batch(calc, discount_rates, cash_flows, offsets, n_streams, results, 1);
+}
+
+int pv_calculator_calculate_sensitivities_batch_parallel(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    PVSensitivities* results,
+    size_t n_threads
+) {
+    return sensitivities_batch(calc, discount_rates, cash_flows, offsets, n_streams, results, n_threads);
+}
+
+int pv_calculator_calculate_f32(
+    PVCalculatorHandle calc,
+    float discount_rate,
+    const float* cash_flows,
+    size_t n_cash_flows,
+    float* result
+) {
+    return typed_single(calc, discount_rate, cash_flows, n_cash_flows, result);
+}
+
+int pv_calculator_calculate_mixed(
+    PVCalculatorHandle calc,
+    double discount_rate,
+    const float* cash_flows,
+    size_t n_cash_flows,
+    double* result
+) {
+    return typed_single(calc, discount_rate, cash_flows, n_cash_flows, result);
+}
+
+int pv_calculator_calculate_batch_f32(
+    PVCalculatorHandle calc,
+    const float* discount_rates,
+    const float* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    float* results
+) {
+    return typed_batch(calc, discount_rates, cash_flows, offsets, n_streams, results, 1);
+}
+
+int pv_calculator_calculate_batch_f32_parallel(
+    PVCalculatorHandle calc,
+    const float* discount_rates,
+    const float* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    float* results,
+    size_t n_threads
+) {
+    return typed_batch(calc, discount_rates, cash_flows, offsets, n_streams, results, n_threads);
+}
+
+int pv_calculator_calculate_batch_mixed(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const float* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results
+) {
+    return typed_batch(calc, discount_rates, cash_flows, offsets, n_streams, results, 1);
+}
+
+int pv_calculator_calculate_batch_mixed_parallel(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const float* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    size_t n_threads
+) {
+    return typed_batch(calc, discount_rates, cash_flows, offsets, n_streams, results, n_threads);
+}
+
+int pv_calculator_calculate_matrix(
+    PVCalculatorHandle calc,
+    const double* cash_flows,
+    size_t n_streams,
+    size_t n_periods,
+    size_t cash_flow_stride,
+    const double* discount_factors,
+    size_t n_curves,
+    size_t discount_factor_stride,
+    double* results
+) {
+    if (!calc || !cash_flows || !discount_factors || !results) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    const ConstMatrixView cf{cash_flows, n_streams, n_periods,
+                             cash_flow_stride == 0 ? n_periods : cash_flow_stride};
+    const ConstMatrixView df{discount_factors, n_curves, n_periods,
+                             discount_factor_stride == 0 ? n_periods : discount_factor_stride};
+    const std::span<double> pv(results, n_streams * n_curves);
+    if (const char* error = MatrixPresentValuePolicy::check(cf, df, pv.size())) {
+        calc->last_error = error;
+        return -1;
+    }
+    MatrixPresentValuePolicy::evaluate(cf, df, pv);
+    calc->last_error.clear();
+    return 0;
+}
+
+int pv_calculator_calculate_xnpv(
+    PVCalculatorHandle calc,
+    double discount_rate,
+    const int64_t* dates,
+    const double* cash_flows,
+    size_t n_cash_flows,
+    int day_count,
+    double* result
+) {
+    if (!calc || !dates || !cash_flows || !result || n_cash_flows == 0) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer or empty cash flows";
+        }
+        return -1;
+    }
+
+    int status = -1;
+    const bool known = with_day_count(day_count, [&](auto policy) {
+        const Expected<double> pv = StatusErrorPolicy::call<decltype(policy)>(
+            discount_rate, std::span<const std::int64_t>(dates, n_cash_flows),
+            std::span<const double>(cash_flows, n_cash_flows));
+        status = store_result(calc, pv, result);
+    });
+    if (!known) {
+        calc->last_error = "unknown day count convention";
+        return -1;
+    }
+    return status;
+}
+
+int pv_calculator_calculate_xnpv_batch(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const int64_t* dates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    int day_count,
+    double* results
+) {
+    if (!calc || !discount_rates || !dates || !cash_flows || !offsets || !results) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    int status = -1;
+    const bool known = with_day_count(day_count, [&](auto policy) {
+        status = elementwise_batch(calc, n_streams, results, 1, "stream", [&](size_t i) {
+            return xnpv_batch_stream<decltype(policy)>(discount_rates, dates, cash_flows, offsets, i);
+        });
+    });
+    if (!known) {
+        calc->last_error = "unknown day count convention";
+        return -1;
+    }
+    return status;
+}
+
+int pv_calculator_calculate_xnpv_batch_status(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const int64_t* dates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    int day_count,
+    double* results,
+    int* statuses
+) {
+    if (!calc || !discount_rates || !dates || !cash_flows || !offsets || !results || !statuses) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    int status = -1;
+    const bool known = with_day_count(day_count, [&](auto policy) {
+        status = elementwise_status_batch(calc, n_streams, results, statuses, 1, "stream", kInvalidResult,
+                                          [&](size_t i) {
+            return xnpv_batch_stream<decltype(policy)>(discount_rates, dates, cash_flows, offsets, i);
+        });
+    });
+    if (!known) {
+        calc->last_error = "unknown day count convention";
+        return -1;
+    }
+    return status;
+}
+
+int pv_calculator_calculate_runs(
+    PVCalculatorHandle calc,
+    double discount_rate,
+    const double* values,
+    const size_t* counts,
+    size_t n_runs,
+    double* result
+) {
+    if (!calc || !values || !counts || !result || n_runs == 0) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer or empty runs";
+        }
+        return -1;
+    }
+
+    return store_result(calc, runs_pv(discount_rate, values, counts, n_runs), result);
+}
+
+int pv_calculator_calculate_runs_batch(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* values,
+    const size_t* counts,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results
+) {
+    if (!calc || !discount_rates || !values || !counts || !offsets || !results) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+    return elementwise_batch(calc, n_streams, results, 1, "stream", [&](size_t i) {
+        return runs_batch_stream(discount_rates, values, counts, offsets, i);
+    });
+}
+
+int pv_calculator_calculate_runs_batch_status(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* values,
+    const size_t* counts,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    int* statuses
+) {
+    if (!calc || !discount_rates || !values || !counts || !offsets || !results || !statuses) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+    return elementwise_status_batch(calc, n_streams, results, statuses, 1, "stream", kInvalidResult,
+                                    [&](size_t i) {
+        return runs_batch_stream(discount_rates, values, counts, offsets, i);
+    });
+}
+
+int pv_calculator_set_reproducible(PVCalculatorHandle calc, int enabled) {
+    if (!calc) {
+        return -1;
+    }
+    calc->reproducible.store(enabled != 0, std::memory_order_relaxed);
+    calc->last_error.clear();
+    return 0;
+}
+
+int pv_calculator_set_cache(PVCalculatorHandle calc, size_t max_rates) {
+    if (!calc) {
+        return -1;
+    }
+
+    try {
+        calc->cache = max_rates == 0 ? nullptr : std::make_unique<DiscountFactorCache>(max_rates);
+        calc->last_error.clear();
+        return 0;
+    } catch (const std::exception& e) {
+        calc->last_error = e.what();
+        return -1;
+    }
+}
+
+int pv_calculator_get_cache_stats(PVCalculatorHandle calc, PVCacheStats* stats) {
+    if (!calc || !stats) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    const DiscountFactorCache::Stats s = calc->cache ? calc->cache->stats() : DiscountFactorCache::Stats{};
+    stats->hits = s.hits;
+    stats->misses = s.misses;
+    stats->evictions = s.evictions;
+    stats->rates = s.rates;
+    stats->factors = s.factors;
+    calc->last_error.clear();
+    return 0;
+}
+
+const char* pv_calculator_get_error(PVCalculatorHandle calc) {
+    if (!calc) {
+        return "Invalid calculator handle";
+    }
+    return calc->last_error.c_str();
+}
+
+void pv_calculator_destroy(PVCalculatorHandle calc) {
+    delete calc;
+}
+
+// ===========================================================================
+// Yield Curve Implementation
+// ===========================================================================
+
+YieldCurveHandle yield_curve_create(void) {
+    try {
+        return new YieldCurve_t();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+int yield_curve_set_pillars(
+    YieldCurveHandle curve,
+    const double* times,
+    const double* values,
+    size_t n_pillars,
+    int quote,
+    int interpolation
+) {
+    if (!curve || !times || !values) {
+        if (curve) {
+            curve->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+    if (quote != CURVE_QUOTE_ZERO_RATE && quote != CURVE_QUOTE_DISCOUNT_FACTOR) {
+        curve->last_error = "unknown curve quote type";
+        return -1;
+    }
+    if (interpolation < CURVE_INTERP_LINEAR || interpolation > CURVE_INTERP_MONOTONE_CUBIC) {
+        curve->last_error = "unknown curve interpolation";
+        return -1;
+    }
+
+    try {
+        curve->curve.emplace(
+            std::span<const double>(times, n_pillars), std::span<const double>(values, n_pillars),
+            quote == CURVE_QUOTE_ZERO_RATE ? CurveQuote::ZeroRate : CurveQuote::DiscountFactor,
+            static_cast<CurveInterpolation>(interpolation));
+        curve->last_error.clear();
+        return 0;
+    } catch (const std::exception& e) {
+        curve->last_error = e.what();
+        return -1;
+    }
+}
+
+int yield_curve_discount_factors(
+    YieldCurveHandle curve,
+    const double* times,
+    size_t n,
+    double* results
+) {
+    if (!curve || !times || !results) {
+        if (curve) {
+            curve->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+    if (!curve->curve) {
+        curve->last_error = "yield curve has no pillars";
+        return -1;
+    }
+
+    size_t hint = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (!(times[i] >= 0.0)) {
+            curve->last_error = "element " + std::to_string(i) + ": times must be >= 0";
+            return -1;
+        }
+        results[i] = curve->curve->discount_factor(times[i], hint);
+    }
+    curve->last_error.clear();
+    return 0;
+}
+
+const char* yield_curve_get_error(YieldCurveHandle curve) {
+    if (!curve) {
+        return "Invalid curve handle";
+    }
+    return curve->last_error.c_str();
+}
+
+void yield_curve_destroy(YieldCurveHandle curve) {
+    delete curve;
+}
+
+int pv_calculator_calculate_curve(
+    PVCalculatorHandle calc,
+    YieldCurveHandle curve,
+    const double* times,
+    const double* cash_flows,
+    size_t n_cash_flows,
+    double* result
+) {
+    if (!calc || !times || !cash_flows || !result || n_cash_flows == 0) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer or empty cash flows";
+        }
+        return -1;
+    }
+    const YieldCurve* yc = priced_curve(calc, curve);
+    if (!yc) {
+        return -1;
+    }
+
+    const Expected<double> pv = StatusErrorPolicy::call<CurvePresentValuePolicy>(
+        *yc, std::span<const double>(times, n_cash_flows), std::span<const double>(cash_flows, n_cash_flows));
+    return store_result(calc, pv, result);
+}
+
+int pv_calculator_calculate_curve_batch(
+    PVCalculatorHandle calc,
+    YieldCurveHandle curve,
+    const double* times,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results
+) {
+    if (!calc || !times || !cash_flows || !offsets || !results) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+    const YieldCurve* yc = priced_curve(calc, curve);
+    if (!yc) {
+        return -1;
+    }
+
+    return elementwise_batch(calc, n_streams, results, 1, "stream", [&](size_t i) {
+        return curve_batch_stream(*yc, times, cash_flows, offsets, i);
+    });
+}
+
+int pv_calculator_calculate_curve_batch_status(
+    PVCalculatorHandle calc,
+    YieldCurveHandle curve,
+    const double* times,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    int* statuses
+) {
+    if (!calc || !times || !cash_flows || !offsets || !results || !statuses) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+    const YieldCurve* yc = priced_curve(calc, curve);
+    if (!yc) {
+        return -1;
+    }
+    return elementwise_status_batch(calc, n_streams, results, statuses, 1, "stream", kInvalidResult,
+                                    [&](size_t i) {
+        return curve_batch_stream(*yc, times, cash_flows, offsets, i);
+    });
+}
+
+// ===========================================================================
+// Future Value Calculator Implementation
+// ===========================================================================
+
+FVCalculatorHandle fv_calculator_create(void) {
+    try {
+        return new FVCalculator_t();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+int fv_calculator_calculate(
+    FVCalculatorHandle calc,
+    double principal,
+    double interest_rate,
+    int periods,
+    double* result
+) {
+    if (!calc || !result) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    return store_result(calc, calc->calc.calculate(principal, interest_rate, periods), result);
+}
+
+int fv_calculator_calculate_f32(
+    FVCalculatorHandle calc,
+    float principal,
+    float interest_rate,
+    int periods,
+    float* result
+) {
+    if (!calc || !result) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    return store_result(calc, StatusErrorPolicy::call<PrecisionFutureValuePolicy<float>>(
+                                  principal, interest_rate, periods), result);
+}
+
+int fv_calculator_calculate_batch(
+    FVCalculatorHandle calc,
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t n,
+    double* results
+) {
+    return fv_calculator_calculate_batch_parallel(
+        calc, principals, interest_rates, periods, n, results, 1);
+}
+
+int fv_calculator_calculate_batch_parallel(
+    FVCalculatorHandle calc,
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t n,
+    double* results,
+    size_t n_threads
+) {
+    if (!calc || !principals || !interest_rates || !periods || !results) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    try {
+        const size_t bad = run_batch(n, n_threads, [&](size_t begin, size_t end) {
+            return fv_batch_range(principals, interest_rates, periods, begin, end, results);
+        });
+        if (bad != kNoError) {
+            calc->last_error = "element " + std::to_string(bad) + ": "
+                             + SimdFutureValuePolicy::check(principals[bad], interest_rates[bad], periods[bad]);
+            return -1;
+        }
+        calc->last_error.clear();
+        return 0;
+    } catch (const std::exception& e) {
+        calc->last_error = e.what();
+        return -1;
+    }
+}
+
+int fv_calculator_calculate_batch_status(
+    FVCalculatorHandle calc,
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t n,
+    double* results,
+    int* statuses
+) {
+    return fv_calculator_calculate_batch_status_parallel(
+        calc, principals, interest_rates, periods, n, results, statuses, 1);
+}
+
+int fv_calculator_calculate_batch_status_parallel(
+    FVCalculatorHandle calc,
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t n,
+    double* results,
+    int* statuses,
+    size_t n_threads
+) {
+    if (!calc || !principals || !interest_rates || !periods || !results || !statuses) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    return status_batch(calc, n, statuses, n_threads, "element", [&](size_t begin, size_t end) {
+        return fv_status_range(principals, interest_rates, periods, begin, end, results, statuses);
+    });
+}
+
+const char* fv_calculator_get_error(FVCalculatorHandle calc) {
+    if (!calc) {
+        return "Invalid calculator handle";
+    }
+    return calc->last_error.c_str();
+}
+
+void fv_calculator_destroy(FVCalculatorHandle calc) {
+    delete calc;
+}
+
+// ===========================================================================
+// Interest Rate Calculator Implementation
+// ===========================================================================
+
+IRCalculatorHandle ir_calculator_create(void) {
+    try {
+        return new IRCalculator_t();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+int ir_calculator_calculate(
+    IRCalculatorHandle calc,
+    double nominal_rate,
+    int compounding_periods,
+    double* result
+) {
+    if (!calc || !result) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    return store_result(calc, calc->convert(nominal_rate, compounding_periods), result);
+}
+
+int ir_calculator_calculate_f32(
+    IRCalculatorHandle calc,
+    float nominal_rate,
+    int compounding_periods,
+    float* result
+) {
+    if (!calc || !result) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
+
+    return store_result(calc, StatusErrorPolicy::call<PrecisionInterestRateConversionPolicy<float>>(
+                                  nominal_rate, compounding_periods), result);
+}
 
-extern "C" {
+int ir_calculator_calculate_batch(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    const int* compounding_periods,
+    size_t n,
+    double* results
+) {
+    return ir_calculator_calculate_batch_parallel(
+        calc, nominal_rates, compounding_periods, n, results, 1);
+}
 
-// ===========================================================================
-// Present Value Calculator Implementation
-// ===========================================================================
+int ir_calculator_calculate_batch_parallel(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    const int* compounding_periods,
+    size_t n,
+    double* results,
+    size_t n_threads
+) {
+    if (!calc || !nominal_rates || !compounding_periods || !results) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
+        return -1;
+    }
 
-PVCalculatorHandle pv_calculator_create(void) {
     try {
-        return new PVCalculator_t();
-    } catch (...) {
-        return nullptr;
+        const size_t bad = run_batch(n, n_threads, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const Expected<double> ear = calc->convert(nominal_rates[i], compounding_periods[i]);
+                if (!ear) {
+                    return i;
+                }
+                results[i] = *ear;
+            }
+            return kNoError;
+        });
+        if (bad != kNoError) {
+            calc->last_error = "element " + std::to_string(bad) + ": "
+                             + error_message(InterestRateConversionPolicy::validate(nominal_rates[bad],
+                                                                                   compounding_periods[bad]));
+            return -1;
+        }
+        calc->last_error.clear();
+        return 0;
+    } catch (const std::exception& e) {
+        calc->last_error = e.what();
+        return -1;
     }
 }
 
-int pv_calculator_calculate(
-    PVCalculatorHandle calc,
-    double discount_rate,
-    const double* cash_flows,
-    size_t n_cash_flows,
-    double* result
+int ir_calculator_set_tabulated(IRCalculatorHandle calc, int enabled) {
+    if (!calc) {
+        return -1;
+    }
+    // Build the shared tables here, so no conversion (*_ex included) allocates
+    if (enabled != 0 && !EarTable::build_standard()) {
+        calc->tabulated.store(false, std::memory_order_relaxed);
+        calc->last_error = "Failed to allocate the EAR tables";
+        return -1;
+    }
+    calc->tabulated.store(enabled != 0, std::memory_order_relaxed);
+    calc->last_error.clear();
+    return 0;
+}
+
+int ir_calculator_calculate_batch_uniform(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    size_t n,
+    int compounding_periods,
+    double* results
 ) {
-    if (!calc || !cash_flows || !result || n_cash_flows == 0) {
+    return ir_calculator_calculate_batch_uniform_parallel(
+        calc, nominal_rates, n, compounding_periods, results, 1);
+}
+
+int ir_calculator_calculate_batch_uniform_parallel(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    size_t n,
+    int compounding_periods,
+    double* results,
+    size_t n_threads
+) {
+    if (!calc || !nominal_rates || !results) {
         if (calc) {
-            calc->last_error = "Invalid arguments: null pointer or empty cash flows";
+            calc->last_error = "Invalid arguments: null pointer";
         }
         return -1;
     }
+    if (compounding_periods <= 0) {
+        calc->last_error = error_message(CalcError::CompoundingPeriods);
+        return -1;
+    }
 
     try {
-        // Convert C array to std::vector
-        std::vector<double> cf_vec(cash_flows, cash_flows + n_cash_flows);
-        *result = calc->calc.calculate(discount_rate, cf_vec);
+        // Blocks are checked, then converted in one call while still in cache
+        const bool tabulated = calc->is_tabulated();
+        const size_t bad = run_batch(n, n_threads, [&](size_t begin, size_t end) {
+            for (size_t block = begin; block < end; block += kUniformBlock) {
+                const double* const first = nominal_rates + block;
+                const double* const block_end = nominal_rates + std::min(end, block + kUniformBlock);
+                const double* const last = std::find_if(first, block_end, [](double rate) {
+                    return rate <= -1.0;
+                });
+                const size_t count = static_cast<size_t>(last - first);
+                if (tabulated) {
+                    TabulatedInterestRateConversionPolicy::evaluate_batch(first, count, compounding_periods,
+                                                                          results + block);
+                } else {
+                    for (size_t i = 0; i < count; ++i) {
+                        results[block + i] = InterestRateConversionPolicy::evaluate(first[i], compounding_periods);
+                    }
+                }
+                if (last != block_end) {
+                    return block + count;
+                }
+            }
+            return kNoError;
+        });
+        if (bad != kNoError) {
+            calc->last_error = "element " + std::to_string(bad) + ": " + error_message(CalcError::NominalRate);
+            return -1;
+        }
         calc->last_error.clear();
         return 0;
     } catch (const std::exception& e) {
         calc->last_error = e.what();
         return -1;
-    } catch (...) {
-        calc->last_error = "Unknown error occurred";
+    }
+}
+
+int ir_calculator_calculate_batch_status(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    const int* compounding_periods,
+    size_t n,
+    double* results,
+    int* statuses
+) {
+    return ir_calculator_calculate_batch_status_parallel(
+        calc, nominal_rates, compounding_periods, n, results, statuses, 1);
+}
+
+int ir_calculator_calculate_batch_status_parallel(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    const int* compounding_periods,
+    size_t n,
+    double* results,
+    int* statuses,
+    size_t n_threads
+) {
+    if (!calc || !nominal_rates || !compounding_periods || !results || !statuses) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
         return -1;
     }
+
+    return status_batch(calc, n, statuses, n_threads, "element", [&](size_t begin, size_t end) {
+        return ir_status_range(*calc, nominal_rates, compounding_periods, begin, end, results, statuses);
+    });
 }
 
-const char* pv_calculator_get_error(PVCalculatorHandle calc) {
+const char* ir_calculator_get_error(IRCalculatorHandle calc) {
     if (!calc) {
         return "Invalid calculator handle";
     }
     return calc->last_error.c_str();
 }
 
-void pv_calculator_destroy(PVCalculatorHandle calc) {
+void ir_calculator_destroy(IRCalculatorHandle calc) {
     delete calc;
 }
 
 // ===========================================================================
-// Future Value Calculator Implementation
+// Internal Rate of Return Calculator Implementation
 // ===========================================================================
 
-FVCalculatorHandle fv_calculator_create(void) {
+IRRCalculatorHandle irr_calculator_create(void) {
     try {
-        return new FVCalculator_t();
+        return new IRRCalculator_t();
     } catch (...) {
         return nullptr;
     }
 }
 
-int fv_calculator_calculate(
-    FVCalculatorHandle calc,
-    double principal,
-    double interest_rate,
-    int periods,
+int irr_calculator_set_tolerance(IRRCalculatorHandle calc, double tolerance, int max_iterations) {
+    if (!calc) {
+        return -1;
+    }
+    if (!(tolerance > 0.0) || max_iterations < 1) {
+        calc->last_error = "tolerance must be > 0 and max_iterations >= 1";
+        return -1;
+    }
+    calc->options = IrrOptions{tolerance, max_iterations};
+    calc->last_error.clear();
+    return 0;
+}
+
+int irr_calculator_calculate(
+    IRRCalculatorHandle calc,
+    const double* cash_flows,
+    size_t n_cash_flows,
+    double guess,
     double* result
 ) {
-    if (!calc || !result) {
+    if (!calc || !cash_flows || !result) {
         if (calc) {
             calc->last_error = "Invalid arguments: null pointer";
         }
         return -1;
     }
 
-    try {
-        *result = calc->calc.calculate(principal, interest_rate, periods);
-        calc->last_error.clear();
-        return 0;
-    } catch (const std::exception& e) {
-        calc->last_error = e.what();
+    return store_result(calc, irr_stream(*calc, cash_flows, n_cash_flows, guess), result);
+}
+
+int irr_calculator_calculate_batch(
+    IRRCalculatorHandle calc,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    const double* guesses,
+    double* results
+) {
+    return irr_calculator_calculate_batch_parallel(calc, cash_flows, offsets, n_streams, guesses, results, 1);
+}
+
+int irr_calculator_calculate_batch_parallel(
+    IRRCalculatorHandle calc,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    const double* guesses,
+    double* results,
+    size_t n_threads
+) {
+    if (!calc || !cash_flows || !offsets || !results) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
         return -1;
-    } catch (...) {
-        calc->last_error = "Unknown error occurred";
+    }
+
+    return elementwise_batch(calc, n_streams, results, n_threads, "stream", [&](size_t i) {
+        return irr_batch_stream(*calc, cash_flows, offsets, guesses, i);
+    });
+}
+
+int irr_calculator_calculate_batch_status(
+    IRRCalculatorHandle calc,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    const double* guesses,
+    double* results,
+    int* statuses
+) {
+    return irr_calculator_calculate_batch_status_parallel(
+        calc, cash_flows, offsets, n_streams, guesses, results, statuses, 1);
+}
+
+int irr_calculator_calculate_batch_status_parallel(
+    IRRCalculatorHandle calc,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    const double* guesses,
+    double* results,
+    int* statuses,
+    size_t n_threads
+) {
+    if (!calc || !cash_flows || !offsets || !results || !statuses) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
         return -1;
     }
+
+    return elementwise_status_batch(calc, n_streams, results, statuses, n_threads, "stream", kInvalidResult,
+                                    [&](size_t i) {
+        return irr_batch_stream(*calc, cash_flows, offsets, guesses, i);
+    });
 }
 
-const char* fv_calculator_get_error(FVCalculatorHandle calc) {
+const char* irr_calculator_get_error(IRRCalculatorHandle calc) {
     if (!calc) {
         return "Invalid calculator handle";
     }
     return calc->last_error.c_str();
 }
 
-void fv_calculator_destroy(FVCalculatorHandle calc) {
+void irr_calculator_destroy(IRRCalculatorHandle calc) {
     delete calc;
 }
 
 // ===========================================================================
-// Interest Rate Calculator Implementation
+// Bond Calculator Implementation
 // ===========================================================================
 
-IRCalculatorHandle ir_calculator_create(void) {
+BondCalculatorHandle bond_calculator_create(void) {
     try {
-        return new IRCalculator_t();
+        return new BondCalculator_t();
     } catch (...) {
         return nullptr;
     }
 }
 
-int ir_calculator_calculate(
-    IRCalculatorHandle calc,
-    double nominal_rate,
-    int compounding_periods,
+int bond_calculator_price(
+    BondCalculatorHandle calc,
+    double face,
+    double coupon_rate,
+    int periods,
+    int frequency,
+    double yield,
     double* result
 ) {
-    if (!calc || !result) {
+    return bond_single(calc, BondTerms{face, coupon_rate, periods, frequency}, yield, result, bond_price);
+}
+
+int bond_calculator_yield(
+    BondCalculatorHandle calc,
+    double face,
+    double coupon_rate,
+    int periods,
+    int frequency,
+    double price,
+    double* result
+) {
+    return bond_single(calc, BondTerms{face, coupon_rate, periods, frequency}, price, result, bond_yield);
+}
+
+int bond_calculator_analytics(
+    BondCalculatorHandle calc,
+    double face,
+    double coupon_rate,
+    int periods,
+    int frequency,
+    double yield,
+    BondAnalytics* result
+) {
+    return bond_single(calc, BondTerms{face, coupon_rate, periods, frequency}, yield, result, bond_analytics);
+}
+
+int bond_calculator_price_batch(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    double* results
+) {
+    return bond_calculator_price_batch_parallel(
+        calc, faces, coupon_rates, periods, frequencies, yields, n_bonds, results, 1);
+}
+
+int bond_calculator_price_batch_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    double* results,
+    size_t n_threads
+) {
+    return bond_batch(calc, faces, coupon_rates, periods, frequencies, yields, n_bonds, results, nullptr,
+                      n_threads, kInvalidResult, bond_price);
+}
+
+int bond_calculator_price_batch_status(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    double* results,
+    int* statuses
+) {
+    return bond_calculator_price_batch_status_parallel(
+        calc, faces, coupon_rates, periods, frequencies, yields, n_bonds, results, statuses, 1);
+}
+
+int bond_calculator_price_batch_status_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    double* results,
+    int* statuses,
+    size_t n_threads
+) {
+    if (!statuses) {
         if (calc) {
             calc->last_error = "Invalid arguments: null pointer";
         }
         return -1;
     }
+    return bond_batch(calc, faces, coupon_rates, periods, frequencies, yields, n_bonds, results, statuses,
+                      n_threads, kInvalidResult, bond_price);
+}
 
-    try {
-        *result = calc->calc.calculate(nominal_rate, compounding_periods);
-        calc->last_error.clear();
-        return 0;
-    } catch (const std::exception& e) {
-        calc->last_error = e.what();
+int bond_calculator_yield_batch(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* prices,
+    size_t n_bonds,
+    double* results
+) {
+    return bond_calculator_yield_batch_parallel(
+        calc, faces, coupon_rates, periods, frequencies, prices, n_bonds, results, 1);
+}
+
+int bond_calculator_yield_batch_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* prices,
+    size_t n_bonds,
+    double* results,
+    size_t n_threads
+) {
+    return bond_batch(calc, faces, coupon_rates, periods, frequencies, prices, n_bonds, results, nullptr,
+                      n_threads, kInvalidResult, bond_yield);
+}
+
+int bond_calculator_yield_batch_status(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* prices,
+    size_t n_bonds,
+    double* results,
+    int* statuses
+) {
+    return bond_calculator_yield_batch_status_parallel(
+        calc, faces, coupon_rates, periods, frequencies, prices, n_bonds, results, statuses, 1);
+}
+
+int bond_calculator_yield_batch_status_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* prices,
+    size_t n_bonds,
+    double* results,
+    int* statuses,
+    size_t n_threads
+) {
+    if (!statuses) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
         return -1;
-    } catch (...) {
-        calc->last_error = "Unknown error occurred";
+    }
+    return bond_batch(calc, faces, coupon_rates, periods, frequencies, prices, n_bonds, results, statuses,
+                      n_threads, kInvalidResult, bond_yield);
+}
+
+int bond_calculator_analytics_batch(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    BondAnalytics* results
+) {
+    return bond_calculator_analytics_batch_parallel(
+        calc, faces, coupon_rates, periods, frequencies, yields, n_bonds, results, 1);
+}
+
+int bond_calculator_analytics_batch_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    BondAnalytics* results,
+    size_t n_threads
+) {
+    return bond_batch(calc, faces, coupon_rates, periods, frequencies, yields, n_bonds, results, nullptr,
+                      n_threads, kInvalidAnalytics, bond_analytics);
+}
+
+int bond_calculator_analytics_batch_status(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    BondAnalytics* results,
+    int* statuses
+) {
+    return bond_calculator_analytics_batch_status_parallel(
+        calc, faces, coupon_rates, periods, frequencies, yields, n_bonds, results, statuses, 1);
+}
+
+int bond_calculator_analytics_batch_status_parallel(
+    BondCalculatorHandle calc,
+    const double* faces,
+    const double* coupon_rates,
+    const int* periods,
+    const int* frequencies,
+    const double* yields,
+    size_t n_bonds,
+    BondAnalytics* results,
+    int* statuses,
+    size_t n_threads
+) {
+    if (!statuses) {
+        if (calc) {
+            calc->last_error = "Invalid arguments: null pointer";
+        }
         return -1;
     }
+    return bond_batch(calc, faces, coupon_rates, periods, frequencies, yields, n_bonds, results, statuses,
+                      n_threads, kInvalidAnalytics, bond_analytics);
 }
 
-const char* ir_calculator_get_error(IRCalculatorHandle calc) {
+const char* bond_calculator_get_error(BondCalculatorHandle calc) {
     if (!calc) {
         return "Invalid calculator handle";
     }
     return calc->last_error.c_str();
 }
 
-void ir_calculator_destroy(IRCalculatorHandle calc) {
+void bond_calculator_destroy(BondCalculatorHandle calc) {
     delete calc;
 }
 
+// ===========================================================================
+// Thread-Safe Entry Points (*_ex)
+// ===========================================================================
+// Read-only on the handle: no last_error, no cache, no allocation
+
+int pv_calculator_calculate_ex(
+    PVCalculatorHandle calc,
+    double discount_rate,
+    const double* cash_flows,
+    size_t n_cash_flows,
+    double* result
+) {
+    if (!calc || !result || (!cash_flows && n_cash_flows != 0)) {
+        return record_status(CALC_STATUS_NULL_POINTER);
+    }
+
+    const std::span<const double> cf_view(cash_flows, n_cash_flows);
+    if (calc->is_reproducible()) {
+        return record_status(calc->reproducible_calc.calculate(discount_rate, cf_view), result);
+    }
+    return record_status(calc->calc.calculate(discount_rate, cf_view), result);
+}
+
+int pv_calculator_calculate_batch_ex(
+    PVCalculatorHandle calc,
+    const double* discount_rates,
+    const double* cash_flows,
+    const size_t* offsets,
+    size_t n_streams,
+    double* results,
+    int* statuses
+) {
+    if (!calc || !discount_rates || !cash_flows || !offsets || !results || !statuses) {
+        return record_status(CALC_STATUS_NULL_POINTER);
+    }
+
+    const size_t bad = pv_status_range(*calc, FactorSource{}, discount_rates, cash_flows, offsets, 0, n_streams,
+                                       results, statuses);
+    return record_first_status(bad, statuses);
+}
+
+int fv_calculator_calculate_ex(
+    FVCalculatorHandle calc,
+    double principal,
+    double interest_rate,
+    int periods,
+    double* result
+) {
+    if (!calc || !result) {
+        return record_status(CALC_STATUS_NULL_POINTER);
+    }
+
+    return record_status(calc->calc.calculate(principal, interest_rate, periods), result);
+}
+
+int fv_calculator_calculate_batch_ex(
+    FVCalculatorHandle calc,
+    const double* principals,
+    const double* interest_rates,
+    const int* periods,
+    size_t n,
+    double* results,
+    int* statuses
+) {
+    if (!calc || !principals || !interest_rates || !periods || !results || !statuses) {
+        return record_status(CALC_STATUS_NULL_POINTER);
+    }
+
+    return record_first_status(fv_status_range(principals, interest_rates, periods, 0, n, results, statuses),
+                               statuses);
+}
+
+int ir_calculator_calculate_ex(
+    IRCalculatorHandle calc,
+    double nominal_rate,
+    int compounding_periods,
+    double* result
+) {
+    if (!calc || !result) {
+        return record_status(CALC_STATUS_NULL_POINTER);
+    }
+
+    return record_status(calc->convert(nominal_rate, compounding_periods), result);
+}
+
+int ir_calculator_calculate_batch_ex(
+    IRCalculatorHandle calc,
+    const double* nominal_rates,
+    const int* compounding_periods,
+    size_t n,
+    double* results,
+    int* statuses
+) {
+    if (!calc || !nominal_rates || !compounding_periods || !results || !statuses) {
+        return record_status(CALC_STATUS_NULL_POINTER);
+    }
+
+    return record_first_status(
+        ir_status_range(*calc, nominal_rates, compounding_periods, 0, n, results, statuses), statuses);
+}
+
+int calculator_last_status(void) {
+    return tls_last_status;
+}
+
+const char* calculator_last_error(void) {
+    return calculator_status_message(tls_last_status);
+}
+
+// ===========================================================================
+// Library Information
+// ===========================================================================
+
+const char* calculator_simd_isa(void) {
+    return simd::isa_name(simd::detected_isa());
+}
+
+const char* calculator_status_message(int status) {
+    if (status == CALC_STATUS_OK) {
+        return "ok";
+    }
+    if (status == CALC_STATUS_NULL_POINTER) {
+        return "Invalid arguments: null pointer";
+    }
+    if (status < CALC_STATUS_OK || status > CALC_STATUS_NEGATIVE_TIME) {
+        return "unknown status";
+    }
+    return error_message(static_cast<CalcError>(status));
+}
+
 } // extern "C"
 
@@ -0,0 +1,211 @@
+#include "EarTable.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CALCULATOR_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// ===========================================================================
+// Table Construction
+// ===========================================================================
+
+EarTable::EarTable(int compounding_periods, double min_rate, double max_rate)
+    : compounding_periods_(compounding_periods) {
+    if (compounding_periods <= 0) {
+        throw_on_error(CalcError::CompoundingPeriods);
+    }
+    if (!(min_rate > -1.0 && min_rate < max_rate && std::isfinite(max_rate))) {
+        throw std::invalid_argument("EAR table range must satisfy -1 < min_rate < max_rate");
+    }
+    // Grid points nearest the bounds; the first must still be > -1
+    const double first = std::nearbyint(min_rate * kGridStepsPerUnit);
+    const double last = std::nearbyint(max_rate * kGridStepsPerUnit);
+    if (first <= -kGridStepsPerUnit || last - first >= static_cast<double>(kMaxNodes)) {
+        throw std::invalid_argument("EAR table range must hold at most kMaxNodes grid points above -1");
+    }
+    first_index_ = first;
+    node_count_ = last - first + 1.0;
+
+    const double n = static_cast<double>(compounding_periods);
+    const double half_curvature_scale = 0.5 * (n - 1.0) / n;
+    nodes_.resize(static_cast<std::size_t>(node_count_));
+    for (std::size_t k = 0; k < nodes_.size(); ++k) {
+        Node& node = nodes_[k];
+        node.rate = (first + static_cast<double>(k)) / kGridStepsPerUnit;
+        node.ear = InterestRateConversionPolicy::evaluate(node.rate, compounding_periods);
+        // EAR' = g^(n-1) and EAR'' = (n-1)/n · g^(n-2), g = 1 + r/n
+        const double growth = 1.0 + node.rate / n;
+        node.slope = (1.0 + node.ear) / growth;
+        node.half_curvature = half_curvature_scale * node.slope / growth;
+    }
+}
+
+// ===========================================================================
+// Kernel Implementations
+// ===========================================================================
+// Each kernel converts the rates whose grid index lies in the table with
+// gathered nodes and hands the others to InterestRateConversionPolicy.
+// Nodes are 4 doubles, so node k's fields sit at 4k + 0..3 doubles from
+// the first node.
+// ===========================================================================
+
+namespace {
+
+struct TableView {
+    const EarTable::Node* nodes;
+    double first_index;
+    double node_count;
+    int compounding_periods;
+};
+
+void convert_scalar(const EarTable& table, const double* rates, std::size_t n, double* out) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = table.convert(rates[i]);
+    }
+}
+
+#ifdef CALCULATOR_SIMD_X86
+
+__attribute__((target("avx2,fma")))
+void convert_avx2(const EarTable& table, const TableView& view, const double* rates, std::size_t n,
+                  double* out) {
+    constexpr std::size_t W = 4;
+    const __m256d scale = _mm256_set1_pd(EarTable::kGridStepsPerUnit);
+    const __m256d first = _mm256_set1_pd(view.first_index);
+    const __m256d count = _mm256_set1_pd(view.node_count);
+    const __m256d zero = _mm256_setzero_pd();
+    const double* base = &view.nodes->rate;
+
+    std::size_t i = 0;
+    for (; i + W <= n; i += W) {
+        const __m256d r = _mm256_loadu_pd(rates + i);
+        const __m256d offset = _mm256_sub_pd(
+            _mm256_round_pd(_mm256_mul_pd(r, scale), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC), first);
+        const __m256d hit = _mm256_and_pd(_mm256_cmp_pd(offset, zero, _CMP_GE_OQ),
+                                          _mm256_cmp_pd(offset, count, _CMP_LT_OQ));
+        // Lanes outside the table are masked off (their index is garbage)
+        const __m128i index = _mm_slli_epi32(_mm256_cvttpd_epi32(offset), 2);
+        const __m256d rate = _mm256_mask_i32gather_pd(zero, base, index, hit, 8);
+        const __m256d ear = _mm256_mask_i32gather_pd(zero, base + 1, index, hit, 8);
+        const __m256d slope = _mm256_mask_i32gather_pd(zero, base + 2, index, hit, 8);
+        const __m256d half = _mm256_mask_i32gather_pd(zero, base + 3, index, hit, 8);
+        const __m256d d = _mm256_sub_pd(r, rate);
+        _mm256_storeu_pd(out + i, _mm256_fmadd_pd(d, _mm256_fmadd_pd(d, half, slope), ear));
+
+        const int hits = _mm256_movemask_pd(hit);
+        if (hits != 0xF) {
+            for (std::size_t l = 0; l < W; ++l) {
+                if (!(hits & (1 << l))) {
+                    out[i + l] = InterestRateConversionPolicy::evaluate(rates[i + l], view.compounding_periods);
+                }
+            }
+        }
+    }
+    convert_scalar(table, rates + i, n - i, out + i);
+}
+
+// maskz forms on AVX-512: the unmasked intrinsics trip GCC's -Wmaybe-uninitialized
+constexpr __mmask8 kAllLanes512 = 0xFF;
+
+__attribute__((target("avx512f")))
+void convert_avx512(const EarTable& table, const TableView& view, const double* rates, std::size_t n,
+                    double* out) {
+    constexpr std::size_t W = 8;
+    const __m512d scale = _mm512_set1_pd(EarTable::kGridStepsPerUnit);
+    const __m512d first = _mm512_set1_pd(view.first_index);
+    const __m512d count = _mm512_set1_pd(view.node_count);
+    const __m512d zero = _mm512_setzero_pd();
+    const double* base = &view.nodes->rate;
+
+    std::size_t i = 0;
+    for (; i + W <= n; i += W) {
+        const __m512d r = _mm512_loadu_pd(rates + i);
+        const __m512d offset = _mm512_sub_pd(
+            _mm512_maskz_roundscale_pd(kAllLanes512, _mm512_mul_pd(r, scale),
+                                       _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC),
+            first);
+        const __mmask8 hit = static_cast<__mmask8>(_mm512_cmp_pd_mask(offset, zero, _CMP_GE_OQ)
+                                                   & _mm512_cmp_pd_mask(offset, count, _CMP_LT_OQ));
+        // Lanes outside the table are masked off (their index is garbage)
+        const __m256i index = _mm256_slli_epi32(_mm512_maskz_cvttpd_epi32(kAllLanes512, offset), 2);
+        const __m512d rate = _mm512_mask_i32gather_pd(zero, hit, index, base, 8);
+        const __m512d ear = _mm512_mask_i32gather_pd(zero, hit, index, base + 1, 8);
+        const __m512d slope = _mm512_mask_i32gather_pd(zero, hit, index, base + 2, 8);
+        const __m512d half = _mm512_mask_i32gather_pd(zero, hit, index, base + 3, 8);
+        const __m512d d = _mm512_sub_pd(r, rate);
+        _mm512_storeu_pd(out + i, _mm512_fmadd_pd(d, _mm512_fmadd_pd(d, half, slope), ear));
+
+        if (hit != 0xFF) {
+            for (std::size_t l = 0; l < W; ++l) {
+                if (!(hit & (1u << l))) {
+                    out[i + l] = InterestRateConversionPolicy::evaluate(rates[i + l], view.compounding_periods);
+                }
+            }
+        }
+    }
+    convert_scalar(table, rates + i, n - i, out + i);
+}
+
+#endif // CALCULATOR_SIMD_X86
+
+// Shared tables, one per standard frequency, built on first use
+template <int N>
+const EarTable* shared_table() noexcept {
+    static const std::unique_ptr<const EarTable> table = []() -> std::unique_ptr<const EarTable> {
+        try {
+            return std::make_unique<const EarTable>(N);
+        } catch (const std::bad_alloc&) {
+            return nullptr;
+        }
+    }();
+    return table.get();
+}
+
+} // namespace
+
+// ===========================================================================
+// Public Entry Points
+// ===========================================================================
+
+void EarTable::convert(const double* nominal_rates, std::size_t n, double* results) const noexcept {
+    convert(simd::detected_isa(), nominal_rates, n, results);
+}
+
+void EarTable::convert(simd::Isa isa, const double* nominal_rates, std::size_t n,
+                       double* results) const noexcept {
+#ifdef CALCULATOR_SIMD_X86
+    const TableView view{nodes_.data(), first_index_, node_count_, compounding_periods_};
+#endif
+    switch (isa) {
+#ifdef CALCULATOR_SIMD_X86
+        case simd::Isa::AVX512: convert_avx512(*this, view, nominal_rates, n, results); return;
+        case simd::Isa::AVX2:   convert_avx2(*this, view, nominal_rates, n, results); return;
+#endif
+        default:                convert_scalar(*this, nominal_rates, n, results); return;
+    }
+}
+
+const EarTable* EarTable::standard(int compounding_periods) noexcept {
+    switch (compounding_periods) {
+        case 2:   return shared_table<2>();
+        case 4:   return shared_table<4>();
+        case 12:  return shared_table<12>();
+        case 52:  return shared_table<52>();
+        case 360: return shared_table<360>();
+        case 365: return shared_table<365>();
+        default:  return nullptr;
+    }
+}
+
+bool EarTable::build_standard() noexcept {
+    bool built = true;
+    for (int n : kStandardFrequencies) {
+        built = (standard(n) != nullptr) && built;
+    }
+    return built;
+}
@@ -0,0 +1,302 @@
+#include "MatrixPresentValue.hpp"
+
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CALCULATOR_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// ===========================================================================
+// Kernel Implementations
+// ===========================================================================
+// One driver, instantiated per ISA with a Tiles type providing
+//   MR, NR                 register tile: MR streams × NR curves
+//   tile<R, C>(...)        PV tile over periods [k0, k1), R ≤ MR, C ≤ NR
+// tile<> stores its sums into the results on the first period block and
+// adds them on later blocks, so every PV is the in-order sum of its
+// per-block partials.
+// ===========================================================================
+
+namespace {
+
+struct Operands {
+    const double* cf;
+    std::size_t cf_stride;
+    const double* df;
+    std::size_t df_stride;
+    double* out;
+    std::size_t out_stride;
+};
+
+template <std::size_t R, std::size_t C>
+inline void store_tile(const Operands& op, std::size_t i, std::size_t j, const double (&sums)[R][C],
+                       bool accumulate) {
+    for (std::size_t r = 0; r < R; ++r) {
+        double* row = op.out + (i + r) * op.out_stride + j;
+        for (std::size_t c = 0; c < C; ++c) {
+            row[c] = accumulate ? row[c] + sums[r][c] : sums[r][c];
+        }
+    }
+}
+
+template <typename Tiles>
+void matrix_driver(const Operands& op, std::size_t m, std::size_t n, std::size_t k) {
+    constexpr std::size_t MR = Tiles::MR;
+    constexpr std::size_t NR = Tiles::NR;
+
+    // No period blocking when a whole block of curves fits in cache anyway
+    const std::size_t block_curves = n < kMatrixBlockCurves ? n : kMatrixBlockCurves;
+    const std::size_t block_periods = block_curves * k <= kMatrixCacheDoubles ? k : kMatrixBlockPeriods;
+
+    for (std::size_t k0 = 0; k0 < k; k0 += block_periods) {
+        const std::size_t k1 = (k - k0 < block_periods) ? k : k0 + block_periods;
+        const bool accumulate = k0 != 0;
+
+        for (std::size_t j0 = 0; j0 < n; j0 += kMatrixBlockCurves) {
+            const std::size_t j1 = (n - j0 < kMatrixBlockCurves) ? n : j0 + kMatrixBlockCurves;
+
+            std::size_t i = 0;
+            for (; i + MR <= m; i += MR) {
+                std::size_t j = j0;
+                for (; j + NR <= j1; j += NR) {
+                    Tiles::template tile<MR, NR>(op, i, j, k0, k1, accumulate);
+                }
+                for (; j < j1; ++j) {
+                    Tiles::template tile<MR, 1>(op, i, j, k0, k1, accumulate);
+                }
+            }
+            for (; i < m; ++i) {
+                std::size_t j = j0;
+                for (; j + NR <= j1; j += NR) {
+                    Tiles::template tile<1, NR>(op, i, j, k0, k1, accumulate);
+                }
+                for (; j < j1; ++j) {
+                    Tiles::template tile<1, 1>(op, i, j, k0, k1, accumulate);
+                }
+            }
+        }
+    }
+}
+
+struct ScalarTiles {
+    static constexpr std::size_t MR = 2;
+    static constexpr std::size_t NR = 2;
+
+    template <std::size_t R, std::size_t C>
+    static void tile(const Operands& op, std::size_t i, std::size_t j, std::size_t k0, std::size_t k1,
+                     bool accumulate) {
+        double sums[R][C] = {};
+        for (std::size_t t = k0; t < k1; ++t) {
+            for (std::size_t r = 0; r < R; ++r) {
+                const double cf = op.cf[(i + r) * op.cf_stride + t];
+                for (std::size_t c = 0; c < C; ++c) {
+                    sums[r][c] += cf * op.df[(j + c) * op.df_stride + t];
+                }
+            }
+        }
+        store_tile(op, i, j, sums, accumulate);
+    }
+};
+
+#ifdef CALCULATOR_SIMD_X86
+
+// 4 × 2 tile: 8 accumulators + 4 cash-flow vectors + 1 discount-factor
+// vector of the 16 ymm registers
+struct Avx2Tiles {
+    static constexpr std::size_t MR = 4;
+    static constexpr std::size_t NR = 2;
+
+    template <std::size_t R, std::size_t C>
+    __attribute__((target("avx2,fma")))
+    static void tile(const Operands& op, std::size_t i, std::size_t j, std::size_t k0, std::size_t k1,
+                     bool accumulate) {
+        constexpr std::size_t W = 4;
+        const double* a[R];
+        const double* b[C];
+        #pragma GCC unroll 4
+        for (std::size_t r = 0; r < R; ++r) {
+            a[r] = op.cf + (i + r) * op.cf_stride;
+        }
+        #pragma GCC unroll 4
+        for (std::size_t c = 0; c < C; ++c) {
+            b[c] = op.df + (j + c) * op.df_stride;
+        }
+
+        __m256d acc[R][C];
+        #pragma GCC unroll 4
+        for (std::size_t r = 0; r < R; ++r) {
+            #pragma GCC unroll 4
+            for (std::size_t c = 0; c < C; ++c) {
+                acc[r][c] = _mm256_setzero_pd();
+            }
+        }
+
+        std::size_t t = k0;
+        for (; t + W <= k1; t += W) {
+            __m256d av[R];
+            #pragma GCC unroll 4
+            for (std::size_t r = 0; r < R; ++r) {
+                av[r] = _mm256_loadu_pd(a[r] + t);
+            }
+            #pragma GCC unroll 4
+            for (std::size_t c = 0; c < C; ++c) {
+                const __m256d bv = _mm256_loadu_pd(b[c] + t);
+                #pragma GCC unroll 4
+                for (std::size_t r = 0; r < R; ++r) {
+                    acc[r][c] = _mm256_fmadd_pd(av[r], bv, acc[r][c]);
+                }
+            }
+        }
+        if (t < k1) {
+            // Lanes at or past k1 load zero (and never touch the padding)
+            const __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<long long>(k1 - t)),
+                                                    _mm256_set_epi64x(3, 2, 1, 0));
+            __m256d av[R];
+            #pragma GCC unroll 4
+            for (std::size_t r = 0; r < R; ++r) {
+                av[r] = _mm256_maskload_pd(a[r] + t, mask);
+            }
+            #pragma GCC unroll 4
+            for (std::size_t c = 0; c < C; ++c) {
+                const __m256d bv = _mm256_maskload_pd(b[c] + t, mask);
+                #pragma GCC unroll 4
+                for (std::size_t r = 0; r < R; ++r) {
+                    acc[r][c] = _mm256_fmadd_pd(av[r], bv, acc[r][c]);
+                }
+            }
+        }
+
+        double sums[R][C];
+        #pragma GCC unroll 4
+        for (std::size_t r = 0; r < R; ++r) {
+            #pragma GCC unroll 4
+            for (std::size_t c = 0; c < C; ++c) {
+                const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(acc[r][c]),
+                                                _mm256_extractf128_pd(acc[r][c], 1));
+                sums[r][c] = _mm_cvtsd_f64(half) + _mm_cvtsd_f64(_mm_unpackhi_pd(half, half));
+            }
+        }
+        store_tile(op, i, j, sums, accumulate);
+    }
+};
+
+// 4 × 4 tile: 16 accumulators + 4 cash-flow vectors + 1 discount-factor
+// vector of the 32 zmm registers
+struct Avx512Tiles {
+    static constexpr std::size_t MR = 4;
+    static constexpr std::size_t NR = 4;
+
+    template <std::size_t R, std::size_t C>
+    __attribute__((target("avx512f")))
+    static void tile(const Operands& op, std::size_t i, std::size_t j, std::size_t k0, std::size_t k1,
+                     bool accumulate) {
+        constexpr std::size_t W = 8;
+        const double* a[R];
+        const double* b[C];
+        #pragma GCC unroll 4
+        for (std::size_t r = 0; r < R; ++r) {
+            a[r] = op.cf + (i + r) * op.cf_stride;
+        }
+        #pragma GCC unroll 4
+        for (std::size_t c = 0; c < C; ++c) {
+            b[c] = op.df + (j + c) * op.df_stride;
+        }
+
+        __m512d acc[R][C];
+        #pragma GCC unroll 4
+        for (std::size_t r = 0; r < R; ++r) {
+            #pragma GCC unroll 4
+            for (std::size_t c = 0; c < C; ++c) {
+                acc[r][c] = _mm512_setzero_pd();
+            }
+        }
+
+        std::size_t t = k0;
+        for (; t + W <= k1; t += W) {
+            __m512d av[R];
+            #pragma GCC unroll 4
+            for (std::size_t r = 0; r < R; ++r) {
+                av[r] = _mm512_loadu_pd(a[r] + t);
+            }
+            #pragma GCC unroll 4
+            for (std::size_t c = 0; c < C; ++c) {
+                const __m512d bv = _mm512_loadu_pd(b[c] + t);
+                #pragma GCC unroll 4
+                for (std::size_t r = 0; r < R; ++r) {
+                    acc[r][c] = _mm512_fmadd_pd(av[r], bv, acc[r][c]);
+                }
+            }
+        }
+        if (t < k1) {
+            const __mmask8 mask = static_cast<__mmask8>((1u << (k1 - t)) - 1u);
+            __m512d av[R];
+            #pragma GCC unroll 4
+            for (std::size_t r = 0; r < R; ++r) {
+                av[r] = _mm512_maskz_loadu_pd(mask, a[r] + t);
+            }
+            #pragma GCC unroll 4
+            for (std::size_t c = 0; c < C; ++c) {
+                const __m512d bv = _mm512_maskz_loadu_pd(mask, b[c] + t);
+                #pragma GCC unroll 4
+                for (std::size_t r = 0; r < R; ++r) {
+                    acc[r][c] = _mm512_fmadd_pd(av[r], bv, acc[r][c]);
+                }
+            }
+        }
+
+        // Spill instead of _mm512_reduce_add_pd (trips GCC's -Wuninitialized)
+        double sums[R][C];
+        alignas(64) double lanes[W];
+        #pragma GCC unroll 4
+        for (std::size_t r = 0; r < R; ++r) {
+            #pragma GCC unroll 4
+            for (std::size_t c = 0; c < C; ++c) {
+                _mm512_store_pd(lanes, acc[r][c]);
+                sums[r][c] = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3]))
+                           + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+            }
+        }
+        store_tile(op, i, j, sums, accumulate);
+    }
+};
+
+#endif // CALCULATOR_SIMD_X86
+
+void run_matrix(simd::Isa isa, const ConstMatrixView& cash_flows, const ConstMatrixView& discount_factors,
+                double* results, std::size_t results_stride) {
+    const Operands op{cash_flows.data, cash_flows.stride, discount_factors.data, discount_factors.stride,
+                      results, results_stride};
+    const std::size_t m = cash_flows.rows;
+    const std::size_t n = discount_factors.rows;
+    const std::size_t k = cash_flows.cols;
+
+    switch (isa) {
+#ifdef CALCULATOR_SIMD_X86
+        case simd::Isa::AVX512: matrix_driver<Avx512Tiles>(op, m, n, k); return;
+        case simd::Isa::AVX2:   matrix_driver<Avx2Tiles>(op, m, n, k); return;
+#endif
+        default:                matrix_driver<ScalarTiles>(op, m, n, k); return;
+    }
+}
+
+} // namespace
+
+// ===========================================================================
+// Public Entry Points
+// ===========================================================================
+
+namespace simd {
+
+void present_value_matrix(const ConstMatrixView& cash_flows, const ConstMatrixView& discount_factors,
+                          double* results, std::size_t results_stride) noexcept {
+    run_matrix(detected_isa(), cash_flows, discount_factors, results, results_stride);
+}
+
+void present_value_matrix(Isa isa, const ConstMatrixView& cash_flows,
+                          const ConstMatrixView& discount_factors,
+                          double* results, std::size_t results_stride) noexcept {
+    run_matrix(isa, cash_flows, discount_factors, results, results_stride);
+}
+
+} // namespace simd
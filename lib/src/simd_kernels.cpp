@@ -0,0 +1,1067 @@
+#include "SimdKernels.hpp"
+#include "CalculationPolicies.hpp"
+#include "IntegerPower.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CALCULATOR_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// ===========================================================================
+// Kernel Implementations
+// ===========================================================================
+// All vector kernels share one layout:
+//   • the stream is cut into kAnchorInterval-period blocks
+//   • per block: anchor = 1 / base^(start+1), lanes = anchor * [v^0 .. v^(W-1)]
+//   • two registers (2W periods) per iteration hide the multiply latency of
+//     the discount-factor recurrence; both step by v^(2W)
+//   • a block tail shorter than 2W periods is finished in scalar code
+// ===========================================================================
+
+namespace {
+
+// Flow = double: the PV kernels. Flow = float: the mixed-precision kernels,
+// identical except that cash flows are loaded as float and widened to
+// double on the way into the registers (half the bytes per period).
+template <typename Flow>
+using Kernel = double (*)(double, const Flow*, std::size_t);
+
+template <typename Flow>
+double pv_scalar(double base, const Flow* cash_flows, std::size_t n) {
+    return RecurrencePresentValuePolicy::accumulate(base, cash_flows, n);
+}
+
+// Scalar finish for the last < 2W periods of a block
+template <typename Flow>
+double pv_tail(double base, const Flow* cash_flows, std::size_t begin, std::size_t end) {
+    const double v = 1.0 / base;
+    double df = 1.0 / std::pow(base, static_cast<double>(begin) + 1.0);
+    double pv = 0.0;
+    for (std::size_t i = begin; i < end; ++i) {
+        pv += cash_flows[i] * df;
+        df *= v;
+    }
+    return pv;
+}
+
+#ifdef CALCULATOR_SIMD_X86
+
+__attribute__((target("sse2"), always_inline))
+inline __m128d load_sse2(const double* p) {
+    return _mm_loadu_pd(p);
+}
+
+__attribute__((target("sse2"), always_inline))
+inline __m128d load_sse2(const float* p) {
+    return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+}
+
+__attribute__((target("avx2,fma"), always_inline))
+inline __m256d load_avx2(const double* p) {
+    return _mm256_loadu_pd(p);
+}
+
+__attribute__((target("avx2,fma"), always_inline))
+inline __m256d load_avx2(const float* p) {
+    return _mm256_cvtps_pd(_mm_loadu_ps(p));
+}
+
+// maskz forms on AVX-512: the unmasked intrinsics trip GCC's -Wmaybe-uninitialized
+constexpr __mmask8 kAllLanes512 = 0xFF;
+
+__attribute__((target("avx512f"), always_inline))
+inline __m512d load_avx512(const double* p) {
+    return _mm512_loadu_pd(p);
+}
+
+__attribute__((target("avx512f"), always_inline))
+inline __m512d load_avx512(const float* p) {
+    return _mm512_maskz_cvtps_pd(kAllLanes512, _mm256_loadu_ps(p));
+}
+
+template <typename Flow>
+__attribute__((target("sse2")))
+double pv_sse2(double base, const Flow* cash_flows, std::size_t n) {
+    constexpr std::size_t W = 2;
+    const __m128d pattern = _mm_set_pd(1.0 / base, 1.0);
+    const __m128d step_w = _mm_set1_pd(1.0 / std::pow(base, static_cast<double>(W)));
+    const __m128d step_2w = _mm_set1_pd(1.0 / std::pow(base, static_cast<double>(2 * W)));
+
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    double tail = 0.0;
+
+    for (std::size_t start = 0; start < n; start += simd::kAnchorInterval) {
+        const std::size_t end = (n - start < simd::kAnchorInterval) ? n : start + simd::kAnchorInterval;
+        const double anchor = 1.0 / std::pow(base, static_cast<double>(start) + 1.0);
+        __m128d df0 = _mm_mul_pd(_mm_set1_pd(anchor), pattern);
+        __m128d df1 = _mm_mul_pd(df0, step_w);
+
+        std::size_t i = start;
+        for (; i + 2 * W <= end; i += 2 * W) {
+            acc0 = _mm_add_pd(acc0, _mm_mul_pd(load_sse2(cash_flows + i), df0));
+            acc1 = _mm_add_pd(acc1, _mm_mul_pd(load_sse2(cash_flows + i + W), df1));
+            df0 = _mm_mul_pd(df0, step_2w);
+            df1 = _mm_mul_pd(df1, step_2w);
+        }
+        if (i < end) {
+            tail += pv_tail(base, cash_flows, i, end);
+        }
+    }
+
+    const __m128d acc = _mm_add_pd(acc0, acc1);
+    return _mm_cvtsd_f64(acc) + _mm_cvtsd_f64(_mm_unpackhi_pd(acc, acc)) + tail;
+}
+
+template <typename Flow>
+__attribute__((target("avx2,fma")))
+double pv_avx2(double base, const Flow* cash_flows, std::size_t n) {
+    constexpr std::size_t W = 4;
+    alignas(32) double lanes[W];
+    lanes[0] = 1.0;
+    for (std::size_t j = 1; j < W; ++j) {
+        lanes[j] = 1.0 / std::pow(base, static_cast<double>(j));
+    }
+    const __m256d pattern = _mm256_load_pd(lanes);
+    const __m256d step_w = _mm256_set1_pd(1.0 / std::pow(base, static_cast<double>(W)));
+    const __m256d step_2w = _mm256_set1_pd(1.0 / std::pow(base, static_cast<double>(2 * W)));
+
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    double tail = 0.0;
+
+    for (std::size_t start = 0; start < n; start += simd::kAnchorInterval) {
+        const std::size_t end = (n - start < simd::kAnchorInterval) ? n : start + simd::kAnchorInterval;
+        const double anchor = 1.0 / std::pow(base, static_cast<double>(start) + 1.0);
+        __m256d df0 = _mm256_mul_pd(_mm256_set1_pd(anchor), pattern);
+        __m256d df1 = _mm256_mul_pd(df0, step_w);
+
+        std::size_t i = start;
+        for (; i + 2 * W <= end; i += 2 * W) {
+            acc0 = _mm256_fmadd_pd(load_avx2(cash_flows + i), df0, acc0);
+            acc1 = _mm256_fmadd_pd(load_avx2(cash_flows + i + W), df1, acc1);
+            df0 = _mm256_mul_pd(df0, step_2w);
+            df1 = _mm256_mul_pd(df1, step_2w);
+        }
+        if (i < end) {
+            tail += pv_tail(base, cash_flows, i, end);
+        }
+    }
+
+    const __m256d acc = _mm256_add_pd(acc0, acc1);
+    const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+    return _mm_cvtsd_f64(half) + _mm_cvtsd_f64(_mm_unpackhi_pd(half, half)) + tail;
+}
+
+template <typename Flow>
+__attribute__((target("avx512f")))
+double pv_avx512(double base, const Flow* cash_flows, std::size_t n) {
+    constexpr std::size_t W = 8;
+    alignas(64) double lanes[W];
+    lanes[0] = 1.0;
+    for (std::size_t j = 1; j < W; ++j) {
+        lanes[j] = 1.0 / std::pow(base, static_cast<double>(j));
+    }
+    const __m512d pattern = _mm512_load_pd(lanes);
+    const __m512d step_w = _mm512_set1_pd(1.0 / std::pow(base, static_cast<double>(W)));
+    const __m512d step_2w = _mm512_set1_pd(1.0 / std::pow(base, static_cast<double>(2 * W)));
+
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = _mm512_setzero_pd();
+    double tail = 0.0;
+
+    for (std::size_t start = 0; start < n; start += simd::kAnchorInterval) {
+        const std::size_t end = (n - start < simd::kAnchorInterval) ? n : start + simd::kAnchorInterval;
+        const double anchor = 1.0 / std::pow(base, static_cast<double>(start) + 1.0);
+        __m512d df0 = _mm512_mul_pd(_mm512_set1_pd(anchor), pattern);
+        __m512d df1 = _mm512_mul_pd(df0, step_w);
+
+        std::size_t i = start;
+        for (; i + 2 * W <= end; i += 2 * W) {
+            acc0 = _mm512_fmadd_pd(load_avx512(cash_flows + i), df0, acc0);
+            acc1 = _mm512_fmadd_pd(load_avx512(cash_flows + i + W), df1, acc1);
+            df0 = _mm512_mul_pd(df0, step_2w);
+            df1 = _mm512_mul_pd(df1, step_2w);
+        }
+        if (i < end) {
+            tail += pv_tail(base, cash_flows, i, end);
+        }
+    }
+
+    // Spill instead of _mm512_reduce_add_pd (trips GCC's -Wuninitialized)
+    _mm512_store_pd(lanes, _mm512_add_pd(acc0, acc1));
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3]))
+         + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7])) + tail;
+}
+
+#endif // CALCULATOR_SIMD_X86
+
+// ===========================================================================
+// Single-Precision PV Kernels
+// ===========================================================================
+// Float flows in float lanes: twice the lanes of the double kernels per
+// register (SSE2 4, AVX2 8, AVX-512 16) and half the bytes per period.
+// Same block layout as above, with anchors and lane patterns computed in
+// double and rounded once. Anchors step by v^kAnchorInterval in double and
+// are recomputed with std::pow once per flush chunk: a block is only two
+// vector iterations at W = 16, so a pow per block would dominate, and the
+// double recurrence drifts ~16 double ulps per chunk, far below a float
+// ulp. Float accumulators are widened into double every
+// kFloatFlushInterval periods, so summation error stays that of a
+// kFloatFlushInterval / (2W)-term float sum however long the stream is;
+// block tails run in double (pv_tail<float>).
+// ===========================================================================
+
+constexpr std::size_t kFloatFlushInterval = 16 * simd::kAnchorInterval;
+
+double pv_f32_scalar(double base, const float* cash_flows, std::size_t n) {
+    return pv_scalar(base, cash_flows, n);
+}
+
+#ifdef CALCULATOR_SIMD_X86
+
+__attribute__((target("sse2")))
+double pv_f32_sse2(double base, const float* cash_flows, std::size_t n) {
+    constexpr std::size_t W = 4;
+    alignas(16) float lanes[W];
+    for (std::size_t j = 0; j < W; ++j) {
+        lanes[j] = static_cast<float>(1.0 / std::pow(base, static_cast<double>(j)));
+    }
+    const __m128 pattern = _mm_load_ps(lanes);
+    const __m128 step_w = _mm_set1_ps(static_cast<float>(1.0 / std::pow(base, static_cast<double>(W))));
+    const __m128 step_2w = _mm_set1_ps(static_cast<float>(1.0 / std::pow(base, static_cast<double>(2 * W))));
+
+    const double step_block = 1.0 / std::pow(base, static_cast<double>(simd::kAnchorInterval));
+    __m128d wide = _mm_setzero_pd();
+    double tail = 0.0;
+
+    for (std::size_t chunk = 0; chunk < n; chunk += kFloatFlushInterval) {
+        const std::size_t chunk_end = (n - chunk < kFloatFlushInterval) ? n : chunk + kFloatFlushInterval;
+        double chunk_anchor = 1.0 / std::pow(base, static_cast<double>(chunk) + 1.0);
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+
+        for (std::size_t start = chunk; start < chunk_end; start += simd::kAnchorInterval) {
+            const std::size_t end =
+                (chunk_end - start < simd::kAnchorInterval) ? chunk_end : start + simd::kAnchorInterval;
+            const float anchor = static_cast<float>(chunk_anchor);
+            chunk_anchor *= step_block;
+            __m128 df0 = _mm_mul_ps(_mm_set1_ps(anchor), pattern);
+            __m128 df1 = _mm_mul_ps(df0, step_w);
+
+            std::size_t i = start;
+            for (; i + 2 * W <= end; i += 2 * W) {
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(cash_flows + i), df0));
+                acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(cash_flows + i + W), df1));
+                df0 = _mm_mul_ps(df0, step_2w);
+                df1 = _mm_mul_ps(df1, step_2w);
+            }
+            if (i < end) {
+                tail += pv_tail(base, cash_flows, i, end);
+            }
+        }
+
+        const __m128 acc = _mm_add_ps(acc0, acc1);
+        wide = _mm_add_pd(wide, _mm_cvtps_pd(acc));
+        wide = _mm_add_pd(wide, _mm_cvtps_pd(_mm_movehl_ps(acc, acc)));
+    }
+
+    return _mm_cvtsd_f64(wide) + _mm_cvtsd_f64(_mm_unpackhi_pd(wide, wide)) + tail;
+}
+
+__attribute__((target("avx2,fma")))
+double pv_f32_avx2(double base, const float* cash_flows, std::size_t n) {
+    constexpr std::size_t W = 8;
+    alignas(32) float lanes[W];
+    for (std::size_t j = 0; j < W; ++j) {
+        lanes[j] = static_cast<float>(1.0 / std::pow(base, static_cast<double>(j)));
+    }
+    const __m256 pattern = _mm256_load_ps(lanes);
+    const __m256 step_w = _mm256_set1_ps(static_cast<float>(1.0 / std::pow(base, static_cast<double>(W))));
+    const __m256 step_2w = _mm256_set1_ps(static_cast<float>(1.0 / std::pow(base, static_cast<double>(2 * W))));
+
+    const double step_block = 1.0 / std::pow(base, static_cast<double>(simd::kAnchorInterval));
+    __m256d wide = _mm256_setzero_pd();
+    double tail = 0.0;
+
+    for (std::size_t chunk = 0; chunk < n; chunk += kFloatFlushInterval) {
+        const std::size_t chunk_end = (n - chunk < kFloatFlushInterval) ? n : chunk + kFloatFlushInterval;
+        double chunk_anchor = 1.0 / std::pow(base, static_cast<double>(chunk) + 1.0);
+        __m256 acc0 = _mm256_setzero_ps();
+        __m256 acc1 = _mm256_setzero_ps();
+
+        for (std::size_t start = chunk; start < chunk_end; start += simd::kAnchorInterval) {
+            const std::size_t end =
+                (chunk_end - start < simd::kAnchorInterval) ? chunk_end : start + simd::kAnchorInterval;
+            const float anchor = static_cast<float>(chunk_anchor);
+            chunk_anchor *= step_block;
+            __m256 df0 = _mm256_mul_ps(_mm256_set1_ps(anchor), pattern);
+            __m256 df1 = _mm256_mul_ps(df0, step_w);
+
+            std::size_t i = start;
+            for (; i + 2 * W <= end; i += 2 * W) {
+                acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(cash_flows + i), df0, acc0);
+                acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(cash_flows + i + W), df1, acc1);
+                df0 = _mm256_mul_ps(df0, step_2w);
+                df1 = _mm256_mul_ps(df1, step_2w);
+            }
+            if (i < end) {
+                tail += pv_tail(base, cash_flows, i, end);
+            }
+        }
+
+        const __m256 acc = _mm256_add_ps(acc0, acc1);
+        wide = _mm256_add_pd(wide, _mm256_cvtps_pd(_mm256_castps256_ps128(acc)));
+        wide = _mm256_add_pd(wide, _mm256_cvtps_pd(_mm256_extractf128_ps(acc, 1)));
+    }
+
+    const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(wide), _mm256_extractf128_pd(wide, 1));
+    return _mm_cvtsd_f64(half) + _mm_cvtsd_f64(_mm_unpackhi_pd(half, half)) + tail;
+}
+
+__attribute__((target("avx512f")))
+double pv_f32_avx512(double base, const float* cash_flows, std::size_t n) {
+    constexpr std::size_t W = 16;
+    alignas(64) float lanes[W];
+    for (std::size_t j = 0; j < W; ++j) {
+        lanes[j] = static_cast<float>(1.0 / std::pow(base, static_cast<double>(j)));
+    }
+    const __m512 pattern = _mm512_load_ps(lanes);
+    const __m512 step_w = _mm512_set1_ps(static_cast<float>(1.0 / std::pow(base, static_cast<double>(W))));
+    const __m512 step_2w = _mm512_set1_ps(static_cast<float>(1.0 / std::pow(base, static_cast<double>(2 * W))));
+
+    const double step_block = 1.0 / std::pow(base, static_cast<double>(simd::kAnchorInterval));
+    __m512d wide = _mm512_setzero_pd();
+    double tail = 0.0;
+
+    for (std::size_t chunk = 0; chunk < n; chunk += kFloatFlushInterval) {
+        const std::size_t chunk_end = (n - chunk < kFloatFlushInterval) ? n : chunk + kFloatFlushInterval;
+        double chunk_anchor = 1.0 / std::pow(base, static_cast<double>(chunk) + 1.0);
+        __m512 acc0 = _mm512_setzero_ps();
+        __m512 acc1 = _mm512_setzero_ps();
+
+        for (std::size_t start = chunk; start < chunk_end; start += simd::kAnchorInterval) {
+            const std::size_t end =
+                (chunk_end - start < simd::kAnchorInterval) ? chunk_end : start + simd::kAnchorInterval;
+            const float anchor = static_cast<float>(chunk_anchor);
+            chunk_anchor *= step_block;
+            __m512 df0 = _mm512_mul_ps(_mm512_set1_ps(anchor), pattern);
+            __m512 df1 = _mm512_mul_ps(df0, step_w);
+
+            std::size_t i = start;
+            for (; i + 2 * W <= end; i += 2 * W) {
+                acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(cash_flows + i), df0, acc0);
+                acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(cash_flows + i + W), df1, acc1);
+                df0 = _mm512_mul_ps(df0, step_2w);
+                df1 = _mm512_mul_ps(df1, step_2w);
+            }
+            if (i < end) {
+                tail += pv_tail(base, cash_flows, i, end);
+            }
+        }
+
+        // Low and high 8 floats, widened (extracted via the pd view: AVX-512F only)
+        const __m512d acc = _mm512_castps_pd(_mm512_add_ps(acc0, acc1));
+        wide = _mm512_add_pd(wide, _mm512_maskz_cvtps_pd(kAllLanes512,
+            _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(kAllLanes512, acc, 0))));
+        wide = _mm512_add_pd(wide, _mm512_maskz_cvtps_pd(kAllLanes512,
+            _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(kAllLanes512, acc, 1))));
+    }
+
+    alignas(64) double sums[8];
+    _mm512_store_pd(sums, wide);
+    return ((sums[0] + sums[1]) + (sums[2] + sums[3]))
+         + ((sums[4] + sums[5]) + (sums[6] + sums[7])) + tail;
+}
+
+#endif // CALCULATOR_SIMD_X86
+
+// ===========================================================================
+// Future Value Kernels
+// ===========================================================================
+// FV_i = P_i · (1 + r_i)^n_i with the integer power engine (IntegerPower.hpp):
+// binary exponentiation on unevaluated double-double squares and
+// accumulator, ≤ 0.5 ulp measured against the exact power.
+//
+// The vector kernels are that engine lane-wise: every lane runs the same
+// operation sequence as scaled_integer_power<FmaProducts> (lanes whose
+// exponent is exhausted keep squaring, but multiply their accumulator by an
+// exact 1), so all paths return bit-identical results. The scalar path
+// uses std::fma too, which is a (correctly rounded) libm call on CPUs
+// without FMA. Overflow turns the error terms into NaN (inf - inf); since
+// 1 + r > 0 the true result is +inf.
+// ===========================================================================
+
+using FvKernel = void (*)(const double*, const double*, const int*, std::size_t, double*);
+
+void fv_scalar(const double* principals, const double* rates, const int* periods,
+               std::size_t n, double* results) {
+    for (std::size_t i = 0; i < n; ++i) {
+        results[i] = scaled_integer_power<FmaProducts>(principals[i], 1.0 + rates[i],
+                                                       static_cast<unsigned>(periods[i]));
+    }
+}
+
+#ifdef CALCULATOR_SIMD_X86
+
+using integer_power_detail::kRenormalizeInterval;
+
+// Vector-kernel tails: the same code with std::fma inlined as an instruction
+__attribute__((target("fma")))
+void fv_scalar_fma(const double* principals, const double* rates, const int* periods,
+                   std::size_t n, double* results) {
+    for (std::size_t i = 0; i < n; ++i) {
+        results[i] = scaled_integer_power<FmaProducts>(principals[i], 1.0 + rates[i],
+                                                       static_cast<unsigned>(periods[i]));
+    }
+}
+
+// One register of lanes in flight. The squaring chain is latency-bound, so
+// the kernels advance two independent groups per loop iteration.
+struct FvLanes256 {
+    __m256d rate, square_hi, square_lo, acc_hi, acc_lo;
+    __m256i e;
+};
+
+__attribute__((target("avx2,fma"), always_inline))
+inline FvLanes256 fv_load_avx2(const double* rates, const int* periods) {
+    const __m256d rate = _mm256_loadu_pd(rates);
+    return {rate, _mm256_add_pd(_mm256_set1_pd(1.0), rate), _mm256_setzero_pd(),
+            _mm256_set1_pd(1.0), _mm256_setzero_pd(),
+            _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(periods)))};
+}
+
+__attribute__((target("avx2,fma"), always_inline))
+inline void fv_step_avx2(FvLanes256& g, unsigned bit) {
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256i low_bit = _mm256_set1_epi64x(1);
+
+    // factor = square where the exponent bit is set, exact {1, 0} elsewhere
+    const __m256d take = _mm256_castsi256_pd(
+        _mm256_cmpeq_epi64(_mm256_and_si256(g.e, low_bit), low_bit));
+    const __m256d f_hi = _mm256_blendv_pd(one, g.square_hi, take);
+    const __m256d f_lo = _mm256_and_pd(g.square_lo, take);
+
+    // acc = dd_mul(acc, factor)
+    const __m256d p = _mm256_mul_pd(g.acc_hi, f_hi);
+    __m256d err = _mm256_fmsub_pd(g.acc_hi, f_hi, p);
+    err = _mm256_fmadd_pd(g.acc_hi, f_lo, err);
+    err = _mm256_fmadd_pd(g.acc_lo, f_hi, err);
+    g.acc_hi = p;
+    g.acc_lo = err;
+
+    // square = dd_square(square)
+    const __m256d q = _mm256_mul_pd(g.square_hi, g.square_hi);
+    __m256d qerr = _mm256_fmsub_pd(g.square_hi, g.square_hi, q);
+    qerr = _mm256_fmadd_pd(_mm256_add_pd(g.square_hi, g.square_hi), g.square_lo, qerr);
+    g.square_hi = q;
+    g.square_lo = qerr;
+    if (bit % kRenormalizeInterval == 0) {
+        g.square_hi = _mm256_add_pd(q, qerr);
+        g.square_lo = _mm256_sub_pd(qerr, _mm256_sub_pd(g.square_hi, q));
+    }
+
+    g.e = _mm256_srli_epi64(g.e, 1);
+}
+
+__attribute__((target("avx2,fma"), always_inline))
+inline void fv_store_avx2(const FvLanes256& g, const double* principals, double* results) {
+    const __m256d principal = _mm256_loadu_pd(principals);
+    const __m256d head = _mm256_mul_pd(principal, g.acc_hi);
+    __m256d tail = _mm256_fmsub_pd(principal, g.acc_hi, head);
+    tail = _mm256_fmadd_pd(principal, g.acc_lo, tail);
+    const __m256d fv = _mm256_add_pd(head, tail);
+    const __m256d overflowed = _mm256_and_pd(_mm256_cmp_pd(fv, fv, _CMP_UNORD_Q),
+                                             _mm256_cmp_pd(g.rate, g.rate, _CMP_ORD_Q));
+    _mm256_storeu_pd(results, _mm256_blendv_pd(
+        fv, _mm256_mul_pd(principal, _mm256_set1_pd(HUGE_VAL)), overflowed));
+}
+
+__attribute__((target("avx2,fma")))
+void fv_avx2(const double* principals, const double* rates, const int* periods,
+             std::size_t n, double* results) {
+    constexpr std::size_t W = 4;
+
+    std::size_t i = 0;
+    for (; i + 2 * W <= n; i += 2 * W) {
+        FvLanes256 g0 = fv_load_avx2(rates + i, periods + i);
+        FvLanes256 g1 = fv_load_avx2(rates + i + W, periods + i + W);
+        for (unsigned bit = 1;
+             !_mm256_testz_si256(_mm256_or_si256(g0.e, g1.e), _mm256_or_si256(g0.e, g1.e)); ++bit) {
+            fv_step_avx2(g0, bit);
+            fv_step_avx2(g1, bit);
+        }
+        fv_store_avx2(g0, principals + i, results + i);
+        fv_store_avx2(g1, principals + i + W, results + i + W);
+    }
+    for (; i + W <= n; i += W) {
+        FvLanes256 g = fv_load_avx2(rates + i, periods + i);
+        for (unsigned bit = 1; !_mm256_testz_si256(g.e, g.e); ++bit) {
+            fv_step_avx2(g, bit);
+        }
+        fv_store_avx2(g, principals + i, results + i);
+    }
+    fv_scalar_fma(principals + i, rates + i, periods + i, n - i, results + i);
+}
+
+struct FvLanes512 {
+    __m512d rate, square_hi, square_lo, acc_hi, acc_lo;
+    __m512i e;
+};
+
+__attribute__((target("avx512f"), always_inline))
+inline FvLanes512 fv_load_avx512(const double* rates, const int* periods) {
+    const __m512d rate = _mm512_loadu_pd(rates);
+    return {rate, _mm512_add_pd(_mm512_set1_pd(1.0), rate), _mm512_setzero_pd(),
+            _mm512_set1_pd(1.0), _mm512_setzero_pd(),
+            _mm512_maskz_cvtepi32_epi64(kAllLanes512,
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(periods)))};
+}
+
+__attribute__((target("avx512f"), always_inline))
+inline void fv_step_avx512(FvLanes512& g, unsigned bit) {
+    // factor = square where the exponent bit is set, exact {1, 0} elsewhere
+    const __mmask8 take = _mm512_test_epi64_mask(g.e, _mm512_set1_epi64(1));
+    const __m512d f_hi = _mm512_mask_blend_pd(take, _mm512_set1_pd(1.0), g.square_hi);
+    const __m512d f_lo = _mm512_maskz_mov_pd(take, g.square_lo);
+
+    // acc = dd_mul(acc, factor)
+    const __m512d p = _mm512_mul_pd(g.acc_hi, f_hi);
+    __m512d err = _mm512_fmsub_pd(g.acc_hi, f_hi, p);
+    err = _mm512_fmadd_pd(g.acc_hi, f_lo, err);
+    err = _mm512_fmadd_pd(g.acc_lo, f_hi, err);
+    g.acc_hi = p;
+    g.acc_lo = err;
+
+    // square = dd_square(square)
+    const __m512d q = _mm512_mul_pd(g.square_hi, g.square_hi);
+    __m512d qerr = _mm512_fmsub_pd(g.square_hi, g.square_hi, q);
+    qerr = _mm512_fmadd_pd(_mm512_add_pd(g.square_hi, g.square_hi), g.square_lo, qerr);
+    g.square_hi = q;
+    g.square_lo = qerr;
+    if (bit % kRenormalizeInterval == 0) {
+        g.square_hi = _mm512_add_pd(q, qerr);
+        g.square_lo = _mm512_sub_pd(qerr, _mm512_sub_pd(g.square_hi, q));
+    }
+
+    g.e = _mm512_maskz_srli_epi64(kAllLanes512, g.e, 1);
+}
+
+__attribute__((target("avx512f"), always_inline))
+inline void fv_store_avx512(const FvLanes512& g, const double* principals, double* results) {
+    const __m512d principal = _mm512_loadu_pd(principals);
+    const __m512d head = _mm512_mul_pd(principal, g.acc_hi);
+    __m512d tail = _mm512_fmsub_pd(principal, g.acc_hi, head);
+    tail = _mm512_fmadd_pd(principal, g.acc_lo, tail);
+    const __m512d fv = _mm512_add_pd(head, tail);
+    const __mmask8 overflowed = _mm512_cmp_pd_mask(fv, fv, _CMP_UNORD_Q)
+                              & _mm512_cmp_pd_mask(g.rate, g.rate, _CMP_ORD_Q);
+    _mm512_storeu_pd(results, _mm512_mask_blend_pd(
+        overflowed, fv, _mm512_mul_pd(principal, _mm512_set1_pd(HUGE_VAL))));
+}
+
+__attribute__((target("avx512f")))
+void fv_avx512(const double* principals, const double* rates, const int* periods,
+               std::size_t n, double* results) {
+    constexpr std::size_t W = 8;
+
+    std::size_t i = 0;
+    for (; i + 2 * W <= n; i += 2 * W) {
+        FvLanes512 g0 = fv_load_avx512(rates + i, periods + i);
+        FvLanes512 g1 = fv_load_avx512(rates + i + W, periods + i + W);
+        for (unsigned bit = 1;
+             _mm512_test_epi64_mask(g0.e, g0.e) | _mm512_test_epi64_mask(g1.e, g1.e); ++bit) {
+            fv_step_avx512(g0, bit);
+            fv_step_avx512(g1, bit);
+        }
+        fv_store_avx512(g0, principals + i, results + i);
+        fv_store_avx512(g1, principals + i + W, results + i + W);
+    }
+    for (; i + W <= n; i += W) {
+        FvLanes512 g = fv_load_avx512(rates + i, periods + i);
+        for (unsigned bit = 1; _mm512_test_epi64_mask(g.e, g.e) != 0; ++bit) {
+            fv_step_avx512(g, bit);
+        }
+        fv_store_avx512(g, principals + i, results + i);
+    }
+    fv_scalar_fma(principals + i, rates + i, periods + i, n - i, results + i);
+}
+
+#endif // CALCULATOR_SIMD_X86
+
+// ===========================================================================
+// Dot Product Kernels
+// ===========================================================================
+// Σ a_i · b_i, for PV against precomputed discount factors
+// (DiscountFactorCache.hpp). Four independent accumulators per kernel hide
+// the add latency; lanes are summed in order at the end and the < 4W tail
+// runs in scalar code.
+// ===========================================================================
+
+using DotKernel = double (*)(const double*, const double*, std::size_t);
+
+double dot_scalar(const double* a, const double* b, std::size_t n) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+#ifdef CALCULATOR_SIMD_X86
+
+__attribute__((target("sse2")))
+double dot_sse2(const double* a, const double* b, std::size_t n) {
+    constexpr std::size_t W = 2;
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    __m128d acc2 = _mm_setzero_pd();
+    __m128d acc3 = _mm_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(a + i + W), _mm_loadu_pd(b + i + W)));
+        acc2 = _mm_add_pd(acc2, _mm_mul_pd(_mm_loadu_pd(a + i + 2 * W), _mm_loadu_pd(b + i + 2 * W)));
+        acc3 = _mm_add_pd(acc3, _mm_mul_pd(_mm_loadu_pd(a + i + 3 * W), _mm_loadu_pd(b + i + 3 * W)));
+    }
+
+    const __m128d acc = _mm_add_pd(_mm_add_pd(acc0, acc1), _mm_add_pd(acc2, acc3));
+    return _mm_cvtsd_f64(acc) + _mm_cvtsd_f64(_mm_unpackhi_pd(acc, acc)) + dot_scalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2,fma")))
+double dot_avx2(const double* a, const double* b, std::size_t n) {
+    constexpr std::size_t W = 4;
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    __m256d acc2 = _mm256_setzero_pd();
+    __m256d acc3 = _mm256_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), acc0);
+        acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + W), _mm256_loadu_pd(b + i + W), acc1);
+        acc2 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 2 * W), _mm256_loadu_pd(b + i + 2 * W), acc2);
+        acc3 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 3 * W), _mm256_loadu_pd(b + i + 3 * W), acc3);
+    }
+
+    const __m256d acc = _mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3));
+    const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+    return _mm_cvtsd_f64(half) + _mm_cvtsd_f64(_mm_unpackhi_pd(half, half)) + dot_scalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx512f")))
+double dot_avx512(const double* a, const double* b, std::size_t n) {
+    constexpr std::size_t W = 8;
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = _mm512_setzero_pd();
+    __m512d acc2 = _mm512_setzero_pd();
+    __m512d acc3 = _mm512_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), acc0);
+        acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + W), _mm512_loadu_pd(b + i + W), acc1);
+        acc2 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 2 * W), _mm512_loadu_pd(b + i + 2 * W), acc2);
+        acc3 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 3 * W), _mm512_loadu_pd(b + i + 3 * W), acc3);
+    }
+
+    alignas(64) double lanes[W];
+    _mm512_store_pd(lanes, _mm512_add_pd(_mm512_add_pd(acc0, acc1), _mm512_add_pd(acc2, acc3)));
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3]))
+         + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7])) + dot_scalar(a + i, b + i, n - i);
+}
+
+#endif // CALCULATOR_SIMD_X86
+
+// ===========================================================================
+// Discounted Moment Kernels
+// ===========================================================================
+// PV and its first two rate sensitivities in one pass, on the PV kernel
+// layout (anchored blocks, two registers of lanes stepping by v^(2W)). A
+// second pair of registers carries the discount counts k = t + 1, and each
+// period adds
+//   x = CF_t · v^k  to pv,   k · x  to first,   k · (k · x)  to second
+// so second accumulates Σ k² x; the entry point adds first to make it
+// Σ k(k+1) x. The < 2W tail of a block runs in scalar code.
+// ===========================================================================
+
+using MomentsKernel = simd::DiscountedMoments (*)(double, const double*, std::size_t);
+
+// Scalar accumulation of periods [begin, end), anchored at begin
+void moments_tail(double base, const double* cash_flows, std::size_t begin, std::size_t end,
+                  simd::DiscountedMoments& m) {
+    const double v = 1.0 / base;
+    double df = 1.0 / std::pow(base, static_cast<double>(begin) + 1.0);
+    double k = static_cast<double>(begin) + 1.0;
+    for (std::size_t i = begin; i < end; ++i) {
+        const double x = cash_flows[i] * df;
+        const double kx = k * x;
+        m.pv += x;
+        m.first += kx;
+        m.second += k * kx;
+        df *= v;
+        k += 1.0;
+    }
+}
+
+simd::DiscountedMoments moments_scalar(double base, const double* cash_flows, std::size_t n) {
+    simd::DiscountedMoments m{0.0, 0.0, 0.0};
+    for (std::size_t start = 0; start < n; start += simd::kAnchorInterval) {
+        const std::size_t end = (n - start < simd::kAnchorInterval) ? n : start + simd::kAnchorInterval;
+        moments_tail(base, cash_flows, start, end, m);
+    }
+    return m;
+}
+
+#ifdef CALCULATOR_SIMD_X86
+
+// Lane-order sums of two accumulator registers
+__attribute__((target("sse2")))
+inline double moments_sum_sse2(__m128d a, __m128d b) {
+    const __m128d acc = _mm_add_pd(a, b);
+    return _mm_cvtsd_f64(acc) + _mm_cvtsd_f64(_mm_unpackhi_pd(acc, acc));
+}
+
+__attribute__((target("avx2")))
+inline double moments_sum_avx2(__m256d a, __m256d b) {
+    const __m256d acc = _mm256_add_pd(a, b);
+    const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+    return _mm_cvtsd_f64(half) + _mm_cvtsd_f64(_mm_unpackhi_pd(half, half));
+}
+
+// Spill instead of _mm512_reduce_add_pd (trips GCC's -Wuninitialized)
+__attribute__((target("avx512f")))
+inline double moments_sum_avx512(__m512d a, __m512d b) {
+    alignas(64) double lanes[8];
+    _mm512_store_pd(lanes, _mm512_add_pd(a, b));
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3]))
+         + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+}
+
+__attribute__((target("sse2")))
+simd::DiscountedMoments moments_sse2(double base, const double* cash_flows, std::size_t n) {
+    constexpr std::size_t W = 2;
+    const __m128d pattern = _mm_set_pd(1.0 / base, 1.0);
+    const __m128d step_w = _mm_set1_pd(1.0 / std::pow(base, static_cast<double>(W)));
+    const __m128d step_2w = _mm_set1_pd(1.0 / std::pow(base, static_cast<double>(2 * W)));
+    const __m128d count_w = _mm_set1_pd(static_cast<double>(W));
+    const __m128d count_2w = _mm_set1_pd(static_cast<double>(2 * W));
+
+    __m128d pv0 = _mm_setzero_pd(), pv1 = _mm_setzero_pd();
+    __m128d first0 = _mm_setzero_pd(), first1 = _mm_setzero_pd();
+    __m128d second0 = _mm_setzero_pd(), second1 = _mm_setzero_pd();
+    simd::DiscountedMoments tail{0.0, 0.0, 0.0};
+
+    for (std::size_t start = 0; start < n; start += simd::kAnchorInterval) {
+        const std::size_t end = (n - start < simd::kAnchorInterval) ? n : start + simd::kAnchorInterval;
+        const double anchor = 1.0 / std::pow(base, static_cast<double>(start) + 1.0);
+        __m128d df0 = _mm_mul_pd(_mm_set1_pd(anchor), pattern);
+        __m128d df1 = _mm_mul_pd(df0, step_w);
+        __m128d k0 = _mm_add_pd(_mm_set1_pd(static_cast<double>(start) + 1.0), _mm_set_pd(1.0, 0.0));
+        __m128d k1 = _mm_add_pd(k0, count_w);
+
+        std::size_t i = start;
+        for (; i + 2 * W <= end; i += 2 * W) {
+            const __m128d x0 = _mm_mul_pd(_mm_loadu_pd(cash_flows + i), df0);
+            const __m128d x1 = _mm_mul_pd(_mm_loadu_pd(cash_flows + i + W), df1);
+            const __m128d kx0 = _mm_mul_pd(k0, x0);
+            const __m128d kx1 = _mm_mul_pd(k1, x1);
+            pv0 = _mm_add_pd(pv0, x0);
+            pv1 = _mm_add_pd(pv1, x1);
+            first0 = _mm_add_pd(first0, kx0);
+            first1 = _mm_add_pd(first1, kx1);
+            second0 = _mm_add_pd(second0, _mm_mul_pd(k0, kx0));
+            second1 = _mm_add_pd(second1, _mm_mul_pd(k1, kx1));
+            df0 = _mm_mul_pd(df0, step_2w);
+            df1 = _mm_mul_pd(df1, step_2w);
+            k0 = _mm_add_pd(k0, count_2w);
+            k1 = _mm_add_pd(k1, count_2w);
+        }
+        if (i < end) {
+            moments_tail(base, cash_flows, i, end, tail);
+        }
+    }
+
+    return {moments_sum_sse2(pv0, pv1) + tail.pv, moments_sum_sse2(first0, first1) + tail.first,
+            moments_sum_sse2(second0, second1) + tail.second};
+}
+
+__attribute__((target("avx2,fma")))
+simd::DiscountedMoments moments_avx2(double base, const double* cash_flows, std::size_t n) {
+    constexpr std::size_t W = 4;
+    alignas(32) double lanes[W];
+    lanes[0] = 1.0;
+    for (std::size_t j = 1; j < W; ++j) {
+        lanes[j] = 1.0 / std::pow(base, static_cast<double>(j));
+    }
+    const __m256d pattern = _mm256_load_pd(lanes);
+    const __m256d step_w = _mm256_set1_pd(1.0 / std::pow(base, static_cast<double>(W)));
+    const __m256d step_2w = _mm256_set1_pd(1.0 / std::pow(base, static_cast<double>(2 * W)));
+    const __m256d count_w = _mm256_set1_pd(static_cast<double>(W));
+    const __m256d count_2w = _mm256_set1_pd(static_cast<double>(2 * W));
+
+    __m256d pv0 = _mm256_setzero_pd(), pv1 = _mm256_setzero_pd();
+    __m256d first0 = _mm256_setzero_pd(), first1 = _mm256_setzero_pd();
+    __m256d second0 = _mm256_setzero_pd(), second1 = _mm256_setzero_pd();
+    simd::DiscountedMoments tail{0.0, 0.0, 0.0};
+
+    for (std::size_t start = 0; start < n; start += simd::kAnchorInterval) {
+        const std::size_t end = (n - start < simd::kAnchorInterval) ? n : start + simd::kAnchorInterval;
+        const double anchor = 1.0 / std::pow(base, static_cast<double>(start) + 1.0);
+        __m256d df0 = _mm256_mul_pd(_mm256_set1_pd(anchor), pattern);
+        __m256d df1 = _mm256_mul_pd(df0, step_w);
+        __m256d k0 = _mm256_add_pd(_mm256_set1_pd(static_cast<double>(start) + 1.0),
+                                   _mm256_set_pd(3.0, 2.0, 1.0, 0.0));
+        __m256d k1 = _mm256_add_pd(k0, count_w);
+
+        std::size_t i = start;
+        for (; i + 2 * W <= end; i += 2 * W) {
+            const __m256d x0 = _mm256_mul_pd(_mm256_loadu_pd(cash_flows + i), df0);
+            const __m256d x1 = _mm256_mul_pd(_mm256_loadu_pd(cash_flows + i + W), df1);
+            const __m256d kx0 = _mm256_mul_pd(k0, x0);
+            const __m256d kx1 = _mm256_mul_pd(k1, x1);
+            pv0 = _mm256_add_pd(pv0, x0);
+            pv1 = _mm256_add_pd(pv1, x1);
+            first0 = _mm256_add_pd(first0, kx0);
+            first1 = _mm256_add_pd(first1, kx1);
+            second0 = _mm256_fmadd_pd(k0, kx0, second0);
+            second1 = _mm256_fmadd_pd(k1, kx1, second1);
+            df0 = _mm256_mul_pd(df0, step_2w);
+            df1 = _mm256_mul_pd(df1, step_2w);
+            k0 = _mm256_add_pd(k0, count_2w);
+            k1 = _mm256_add_pd(k1, count_2w);
+        }
+        if (i < end) {
+            moments_tail(base, cash_flows, i, end, tail);
+        }
+    }
+
+    return {moments_sum_avx2(pv0, pv1) + tail.pv, moments_sum_avx2(first0, first1) + tail.first,
+            moments_sum_avx2(second0, second1) + tail.second};
+}
+
+__attribute__((target("avx512f")))
+simd::DiscountedMoments moments_avx512(double base, const double* cash_flows, std::size_t n) {
+    constexpr std::size_t W = 8;
+    alignas(64) double lanes[W];
+    lanes[0] = 1.0;
+    for (std::size_t j = 1; j < W; ++j) {
+        lanes[j] = 1.0 / std::pow(base, static_cast<double>(j));
+    }
+    const __m512d pattern = _mm512_load_pd(lanes);
+    const __m512d step_w = _mm512_set1_pd(1.0 / std::pow(base, static_cast<double>(W)));
+    const __m512d step_2w = _mm512_set1_pd(1.0 / std::pow(base, static_cast<double>(2 * W)));
+    const __m512d count_w = _mm512_set1_pd(static_cast<double>(W));
+    const __m512d count_2w = _mm512_set1_pd(static_cast<double>(2 * W));
+
+    __m512d pv0 = _mm512_setzero_pd(), pv1 = _mm512_setzero_pd();
+    __m512d first0 = _mm512_setzero_pd(), first1 = _mm512_setzero_pd();
+    __m512d second0 = _mm512_setzero_pd(), second1 = _mm512_setzero_pd();
+    simd::DiscountedMoments tail{0.0, 0.0, 0.0};
+
+    for (std::size_t start = 0; start < n; start += simd::kAnchorInterval) {
+        const std::size_t end = (n - start < simd::kAnchorInterval) ? n : start + simd::kAnchorInterval;
+        const double anchor = 1.0 / std::pow(base, static_cast<double>(start) + 1.0);
+        __m512d df0 = _mm512_mul_pd(_mm512_set1_pd(anchor), pattern);
+        __m512d df1 = _mm512_mul_pd(df0, step_w);
+        __m512d k0 = _mm512_add_pd(_mm512_set1_pd(static_cast<double>(start) + 1.0),
+                                   _mm512_set_pd(7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0));
+        __m512d k1 = _mm512_add_pd(k0, count_w);
+
+        std::size_t i = start;
+        for (; i + 2 * W <= end; i += 2 * W) {
+            const __m512d x0 = _mm512_mul_pd(_mm512_loadu_pd(cash_flows + i), df0);
+            const __m512d x1 = _mm512_mul_pd(_mm512_loadu_pd(cash_flows + i + W), df1);
+            const __m512d kx0 = _mm512_mul_pd(k0, x0);
+            const __m512d kx1 = _mm512_mul_pd(k1, x1);
+            pv0 = _mm512_add_pd(pv0, x0);
+            pv1 = _mm512_add_pd(pv1, x1);
+            first0 = _mm512_add_pd(first0, kx0);
+            first1 = _mm512_add_pd(first1, kx1);
+            second0 = _mm512_fmadd_pd(k0, kx0, second0);
+            second1 = _mm512_fmadd_pd(k1, kx1, second1);
+            df0 = _mm512_mul_pd(df0, step_2w);
+            df1 = _mm512_mul_pd(df1, step_2w);
+            k0 = _mm512_add_pd(k0, count_2w);
+            k1 = _mm512_add_pd(k1, count_2w);
+        }
+        if (i < end) {
+            moments_tail(base, cash_flows, i, end, tail);
+        }
+    }
+
+    return {moments_sum_avx512(pv0, pv1) + tail.pv, moments_sum_avx512(first0, first1) + tail.first,
+            moments_sum_avx512(second0, second1) + tail.second};
+}
+
+#endif // CALCULATOR_SIMD_X86
+
+simd::Isa detect() noexcept {
+#ifdef CALCULATOR_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return simd::Isa::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return simd::Isa::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return simd::Isa::SSE2;
+    }
+#endif
+    return simd::Isa::Scalar;
+}
+
+template <typename Flow>
+Kernel<Flow> kernel_for(simd::Isa isa) noexcept {
+    switch (isa) {
+#ifdef CALCULATOR_SIMD_X86
+        case simd::Isa::AVX512: return pv_avx512<Flow>;
+        case simd::Isa::AVX2:   return pv_avx2<Flow>;
+        case simd::Isa::SSE2:   return pv_sse2<Flow>;
+#endif
+        default:                return pv_scalar<Flow>;
+    }
+}
+
+Kernel<float> f32_kernel_for(simd::Isa isa) noexcept {
+    switch (isa) {
+#ifdef CALCULATOR_SIMD_X86
+        case simd::Isa::AVX512: return pv_f32_avx512;
+        case simd::Isa::AVX2:   return pv_f32_avx2;
+        case simd::Isa::SSE2:   return pv_f32_sse2;
+#endif
+        default:                return pv_f32_scalar;
+    }
+}
+
+// SSE2 has no FMA: its lanes would gain nothing over the scalar loop
+FvKernel fv_kernel_for(simd::Isa isa) noexcept {
+    switch (isa) {
+#ifdef CALCULATOR_SIMD_X86
+        case simd::Isa::AVX512: return fv_avx512;
+        case simd::Isa::AVX2:   return fv_avx2;
+#endif
+        default:                return fv_scalar;
+    }
+}
+
+DotKernel dot_kernel_for(simd::Isa isa) noexcept {
+    switch (isa) {
+#ifdef CALCULATOR_SIMD_X86
+        case simd::Isa::AVX512: return dot_avx512;
+        case simd::Isa::AVX2:   return dot_avx2;
+        case simd::Isa::SSE2:   return dot_sse2;
+#endif
+        default:                return dot_scalar;
+    }
+}
+
+MomentsKernel moments_kernel_for(simd::Isa isa) noexcept {
+    switch (isa) {
+#ifdef CALCULATOR_SIMD_X86
+        case simd::Isa::AVX512: return moments_avx512;
+        case simd::Isa::AVX2:   return moments_avx2;
+        case simd::Isa::SSE2:   return moments_sse2;
+#endif
+        default:                return moments_scalar;
+    }
+}
+
+} // namespace
+
+// ===========================================================================
+// Public Entry Points
+// ===========================================================================
+
+namespace simd {
+
+Isa detected_isa() noexcept {
+    static const Isa isa = detect();
+    return isa;
+}
+
+const char* isa_name(Isa isa) noexcept {
+    switch (isa) {
+        case Isa::SSE2:   return "sse2";
+        case Isa::AVX2:   return "avx2";
+        case Isa::AVX512: return "avx512";
+        default:          return "scalar";
+    }
+}
+
+bool isa_supported(Isa isa) noexcept {
+    return static_cast<int>(isa) <= static_cast<int>(detected_isa());
+}
+
+double present_value(double base, const double* cash_flows, std::size_t n) noexcept {
+    static const Kernel<double> kernel = kernel_for<double>(detected_isa());
+    return kernel(base, cash_flows, n);
+}
+
+double present_value(Isa isa, double base, const double* cash_flows, std::size_t n) noexcept {
+    return kernel_for<double>(isa)(base, cash_flows, n);
+}
+
+double present_value_reproducible(double base, const double* cash_flows, std::size_t n) noexcept {
+    return pv_scalar(base, cash_flows, n);
+}
+
+float present_value_f32(double base, const float* cash_flows, std::size_t n) noexcept {
+    static const Kernel<float> kernel = f32_kernel_for(detected_isa());
+    return static_cast<float>(kernel(base, cash_flows, n));
+}
+
+float present_value_f32(Isa isa, double base, const float* cash_flows, std::size_t n) noexcept {
+    return static_cast<float>(f32_kernel_for(isa)(base, cash_flows, n));
+}
+
+double present_value_mixed(double base, const float* cash_flows, std::size_t n) noexcept {
+    static const Kernel<float> kernel = kernel_for<float>(detected_isa());
+    return kernel(base, cash_flows, n);
+}
+
+double present_value_mixed(Isa isa, double base, const float* cash_flows, std::size_t n) noexcept {
+    return kernel_for<float>(isa)(base, cash_flows, n);
+}
+
+void future_value(const double* principals, const double* rates, const int* periods,
+                  std::size_t n, double* results) noexcept {
+    static const FvKernel kernel = fv_kernel_for(detected_isa());
+    kernel(principals, rates, periods, n, results);
+}
+
+void future_value(Isa isa, const double* principals, const double* rates, const int* periods,
+                  std::size_t n, double* results) noexcept {
+    fv_kernel_for(isa)(principals, rates, periods, n, results);
+}
+
+double dot(const double* a, const double* b, std::size_t n) noexcept {
+    static const DotKernel kernel = dot_kernel_for(detected_isa());
+    return kernel(a, b, n);
+}
+
+double dot(Isa isa, const double* a, const double* b, std::size_t n) noexcept {
+    return dot_kernel_for(isa)(a, b, n);
+}
+
+// Kernels accumulate Σ k² x in second; Σ k(k+1) x = Σ k² x + Σ k x
+DiscountedMoments discounted_moments(double base, const double* cash_flows, std::size_t n) noexcept {
+    static const MomentsKernel kernel = moments_kernel_for(detected_isa());
+    DiscountedMoments m = kernel(base, cash_flows, n);
+    m.second += m.first;
+    return m;
+}
+
+DiscountedMoments discounted_moments(Isa isa, double base, const double* cash_flows, std::size_t n) noexcept {
+    DiscountedMoments m = moments_kernel_for(isa)(base, cash_flows, n);
+    m.second += m.first;
+    return m;
+}
+
+} // namespace simd
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "../include/BondPricing.hpp"
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+// The materialized schedule: n coupons, face with the last one
+std::vector<double> schedule(const BondTerms& bond) {
+    const double coupon = bond.face * bond.coupon_rate / bond.frequency;
+    const std::size_t n = static_cast<std::size_t>(bond.periods);
+    std::vector<double> cf(n, coupon);
+    cf[n - 1] += bond.face;
+    return cf;
+}
+
+const std::vector<BondTerms> kBonds = {
+    {1000.0, 0.05, 10, 1},
+    {100.0, 0.0425, 20, 2},
+    {100.0, 0.0, 12, 4},      // zero coupon
+    {250.0, 0.07, 360, 12},
+    {100.0, 0.12, 1, 1},
+};
+
+// Period yields on both sides of the series / closed-form switch, plus 0
+// and negative yields
+const std::vector<double> kYields = {-0.02, -1e-7, 0.0, 1e-9, 1e-4, 0.004, 0.04, 0.25};
+
+} // namespace
+
+// ===========================================================================
+// Price
+// ===========================================================================
+
+TEST(BondPricingTest, PriceMatchesPresentValueOfSchedule) {
+    for (const BondTerms& bond : kBonds) {
+        const std::vector<double> cf = schedule(bond);
+        for (const double y : kYields) {
+            const double yield = y * bond.frequency;
+            const double expected = PresentValuePolicy::calculate(y, cf);
+            EXPECT_NEAR(BondPricingPolicy::calculate(bond, yield), expected, 1e-11 * expected)
+                << bond.periods << " periods at " << yield;
+            EXPECT_NEAR(BondPricingPolicy::analytics(bond, yield).price, expected, 1e-11 * expected)
+                << bond.periods << " periods at " << yield;
+        }
+    }
+}
+
+TEST(BondPricingTest, ParBondPricesAtFace) {
+    const BondTerms bond{100.0, 0.06, 30, 2};
+    EXPECT_NEAR(BondPricingPolicy::calculate(bond, 0.06), 100.0, 1e-12);
+    EXPECT_NEAR(BondPricingPolicy::yield_to_maturity(bond, 100.0), 0.06, 1e-14);
+}
+
+TEST(BondPricingTest, CalculatorWrapperAndBatch) {
+    Calculator<BondPricingPolicy> bond_calc;
+    const BondTerms bond{1000.0, 0.05, 10, 1};
+    EXPECT_NEAR(bond_calc.calculate(bond, 0.04), PresentValuePolicy::calculate(0.04, schedule(bond)), 1e-9);
+
+    const std::vector<double> yields = {0.03, 0.05, 0.08, 0.01, 0.2};
+    std::vector<double> prices(kBonds.size());
+    BondPricingPolicy::calculate_batch(kBonds, yields, prices);
+    for (std::size_t i = 0; i < kBonds.size(); ++i) {
+        EXPECT_DOUBLE_EQ(prices[i], BondPricingPolicy::calculate(kBonds[i], yields[i]));
+    }
+}
+
+// ===========================================================================
+// Duration and Convexity
+// ===========================================================================
+
+TEST(BondPricingTest, AnalyticsMatchTermByTermSums) {
+    for (const BondTerms& bond : kBonds) {
+        const std::vector<double> cf = schedule(bond);
+        const double f = bond.frequency;
+        for (const double y : kYields) {
+            double price = 0.0;
+            double weighted = 0.0;
+            double curvature = 0.0;
+            for (std::size_t t = 1; t <= cf.size(); ++t) {
+                const double k = static_cast<double>(t);
+                const double pv = cf[t - 1] * std::pow(1.0 + y, -k);
+                price += pv;
+                weighted += k * pv;
+                curvature += k * (k + 1.0) * pv;
+            }
+            const double macaulay = weighted / (price * f);
+            const double convexity = curvature / ((1.0 + y) * (1.0 + y) * price * f * f);
+
+            const auto a = BondPricingPolicy::analytics(bond, y * f);
+            EXPECT_NEAR(a.macaulay_duration, macaulay, 1e-10 * macaulay) << bond.periods << " at " << y;
+            EXPECT_NEAR(a.modified_duration, macaulay / (1.0 + y), 1e-10 * macaulay) << bond.periods << " at " << y;
+            EXPECT_NEAR(a.convexity, convexity, 1e-10 * convexity) << bond.periods << " at " << y;
+        }
+    }
+}
+
+TEST(BondPricingTest, DurationAndConvexityAreYieldDerivatives) {
+    const BondTerms bond{100.0, 0.045, 40, 2};
+    const double yield = 0.052;
+    const double h = 1e-5;
+    const double p = BondPricingPolicy::calculate(bond, yield);
+    const double up = BondPricingPolicy::calculate(bond, yield + h);
+    const double down = BondPricingPolicy::calculate(bond, yield - h);
+
+    const auto a = BondPricingPolicy::analytics(bond, yield);
+    EXPECT_NEAR(a.modified_duration, -(up - down) / (2.0 * h * p), 1e-6);
+    EXPECT_NEAR(a.convexity, (up - 2.0 * p + down) / (h * h * p), 1e-3);
+
+    // Zero coupon: Macaulay duration is the maturity
+    EXPECT_NEAR(BondPricingPolicy::analytics({100.0, 0.0, 20, 2}, 0.03).macaulay_duration, 10.0, 1e-12);
+}
+
+// ===========================================================================
+// Yield to Maturity
+// ===========================================================================
+
+TEST(BondPricingTest, YieldToMaturityRoundTrips) {
+    for (const BondTerms& bond : kBonds) {
+        for (const double y : kYields) {
+            const double yield = y * bond.frequency;
+            const double price = BondPricingPolicy::calculate(bond, yield);
+            EXPECT_NEAR(BondPricingPolicy::yield_to_maturity(bond, price), yield, 1e-11)
+                << bond.periods << " periods at " << yield;
+        }
+    }
+}
+
+TEST(BondPricingTest, YieldToMaturityOfDeepDiscountAndPremium) {
+    const BondTerms bond{100.0, 0.05, 20, 1};
+    for (const double yield : {-0.5, 0.9, 3.0}) {
+        const double price = BondPricingPolicy::calculate(bond, yield);
+        EXPECT_NEAR(BondPricingPolicy::yield_to_maturity(bond, price), yield, 1e-11 * std::fmax(1.0, yield));
+    }
+}
+
+// ===========================================================================
+// Error Handling
+// ===========================================================================
+
+TEST(BondPricingTest, InvalidInputsThrow) {
+    EXPECT_THROW(BondPricingPolicy::calculate({0.0, 0.05, 10, 1}, 0.04), std::invalid_argument);
+    EXPECT_THROW(BondPricingPolicy::calculate({100.0, -0.01, 10, 1}, 0.04), std::invalid_argument);
+    EXPECT_THROW(BondPricingPolicy::calculate({100.0, 0.05, 0, 1}, 0.04), std::invalid_argument);
+    EXPECT_THROW(BondPricingPolicy::calculate({100.0, 0.05, 10, 0}, 0.04), std::invalid_argument);
+    EXPECT_THROW(BondPricingPolicy::calculate({100.0, 0.05, 10, 2}, -2.0), std::invalid_argument);
+    EXPECT_THROW(BondPricingPolicy::analytics({100.0, 0.05, 10, 1}, NAN), std::invalid_argument);
+    EXPECT_THROW(BondPricingPolicy::yield_to_maturity({100.0, 0.05, 10, 1}, 0.0), std::invalid_argument);
+
+    const std::vector<double> one_yield = {0.04};
+    std::vector<double> results(2);
+    EXPECT_THROW(BondPricingPolicy::calculate_batch(kBonds, one_yield, results), std::invalid_argument);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
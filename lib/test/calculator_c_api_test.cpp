@@ -0,0 +1,1543 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+#include <thread>
+#include <vector>
+#include "../include/calculator_c_api.h"
+
+// ===========================================================================
+// Heap Allocation Counter
+// ===========================================================================
+// Replaces the global allocation functions for this test binary so the
+// C API hot paths can be checked for heap traffic.
+
+namespace {
+
+std::atomic<std::size_t> g_allocations{0};
+
+} // namespace
+
+// The replacements pair malloc with free; GCC cannot see that through
+// inlining and reports a new/free mismatch at the call sites.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+// ===========================================================================
+// Present Value C API Tests
+// ===========================================================================
+
+TEST(PresentValueCApiTest, CalculateMatchesFormula) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const double cash_flows[] = {50.0, 50.0, 1050.0};
+    double result = 0.0;
+    ASSERT_EQ(pv_calculator_calculate(calc, 0.06, cash_flows, 3, &result), 0);
+    ASSERT_NEAR(result, 973.27, 1.0);
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(PresentValueCApiTest, CalculatePerformsNoHeapAllocations) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const std::vector<double> cash_flows(360, 599.55);
+    double result = 0.0;
+    ASSERT_EQ(pv_calculator_calculate(calc, 0.005, cash_flows.data(), cash_flows.size(), &result), 0);
+
+    const std::size_t before = g_allocations.load();
+    int status = 0;
+    for (int i = 0; i < 1000; ++i) {
+        status |= pv_calculator_calculate(calc, 0.005, cash_flows.data(), cash_flows.size(), &result);
+    }
+    const std::size_t after = g_allocations.load();
+
+    ASSERT_EQ(status, 0);
+    ASSERT_EQ(after - before, 0u);
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(PresentValueCApiTest, BatchPerformsNoHeapAllocations) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const std::vector<double> cash_flows(1000, 25.0);
+    const std::vector<std::size_t> offsets = {0, 10, 360, 1000};
+    const std::vector<double> rates = {0.01, 0.02, 0.03};
+    std::vector<double> results(3, 0.0);
+
+    const std::size_t before = g_allocations.load();
+    const int status = pv_calculator_calculate_batch(
+        calc, rates.data(), cash_flows.data(), offsets.data(), 3, results.data());
+    const std::size_t after = g_allocations.load();
+
+    ASSERT_EQ(status, 0);
+    ASSERT_EQ(after - before, 0u);
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(PresentValueCApiTest, ParallelBatchMatchesSerial) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const std::size_t n_streams = 5000;
+    std::vector<double> rates(n_streams);
+    std::vector<std::size_t> offsets(n_streams + 1, 0);
+    for (std::size_t i = 0; i < n_streams; ++i) {
+        rates[i] = 0.0001 * static_cast<double>(i % 400);
+        offsets[i + 1] = offsets[i] + 1 + i % 97;
+    }
+    const std::vector<double> cash_flows(offsets.back(), 125.0);
+
+    std::vector<double> serial(n_streams, 0.0);
+    ASSERT_EQ(pv_calculator_calculate_batch(
+        calc, rates.data(), cash_flows.data(), offsets.data(), n_streams, serial.data()), 0);
+
+    for (std::size_t threads : {0u, 2u, 7u}) {
+        std::vector<double> parallel(n_streams, 0.0);
+        ASSERT_EQ(pv_calculator_calculate_batch_parallel(
+            calc, rates.data(), cash_flows.data(), offsets.data(), n_streams, parallel.data(), threads), 0);
+        ASSERT_EQ(parallel, serial);
+    }
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(PresentValueCApiTest, ParallelBatchReportsLowestFailingStream) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const std::size_t n_streams = 4000;
+    std::vector<double> rates(n_streams, 0.05);
+    std::vector<std::size_t> offsets(n_streams + 1);
+    for (std::size_t i = 0; i <= n_streams; ++i) {
+        offsets[i] = i;
+    }
+    const std::vector<double> cash_flows(n_streams, 100.0);
+    rates[3900] = -2.0;
+    rates[1234] = -2.0;
+
+    std::vector<double> results(n_streams, 0.0);
+    ASSERT_EQ(pv_calculator_calculate_batch_parallel(
+        calc, rates.data(), cash_flows.data(), offsets.data(), n_streams, results.data(), 0), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "stream 1234: discount_rate must be > -1");
+    ASSERT_DOUBLE_EQ(results[1233], 100.0 / 1.05);
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(PresentValueCApiTest, CacheCountsHitsMissesAndEvictions) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+    ASSERT_EQ(pv_calculator_set_cache(calc, 2), 0);
+
+    const std::vector<double> cash_flows(360, 100.0);
+    double result = 0.0;
+    ASSERT_EQ(pv_calculator_calculate(calc, 0.01, cash_flows.data(), 120, &result), 0);  // miss
+    ASSERT_EQ(pv_calculator_calculate(calc, 0.01, cash_flows.data(), 60, &result), 0);   // hit
+    ASSERT_EQ(pv_calculator_calculate(calc, 0.01, cash_flows.data(), 360, &result), 0);  // extend
+    ASSERT_EQ(pv_calculator_calculate(calc, 0.02, cash_flows.data(), 12, &result), 0);   // miss
+    ASSERT_EQ(pv_calculator_calculate(calc, 0.03, cash_flows.data(), 12, &result), 0);   // evicts 0.01
+
+    PVCacheStats stats{};
+    ASSERT_EQ(pv_calculator_get_cache_stats(calc, &stats), 0);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 4u);
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.rates, 2u);
+    EXPECT_EQ(stats.factors, 24u);
+
+    ASSERT_EQ(pv_calculator_set_cache(calc, 0), 0);
+    ASSERT_EQ(pv_calculator_get_cache_stats(calc, &stats), 0);
+    EXPECT_EQ(stats.misses, 0u);
+    EXPECT_EQ(stats.rates, 0u);
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(PresentValueCApiTest, CachedResultsMatchUncached) {
+    PVCalculatorHandle plain = pv_calculator_create();
+    PVCalculatorHandle cached = pv_calculator_create();
+    ASSERT_NE(plain, nullptr);
+    ASSERT_NE(cached, nullptr);
+    ASSERT_EQ(pv_calculator_set_cache(cached, 8), 0);
+
+    std::vector<double> cash_flows(1000);
+    for (std::size_t i = 0; i < cash_flows.size(); ++i) {
+        cash_flows[i] = 50.0 + static_cast<double>(i % 13);
+    }
+    std::vector<std::size_t> offsets = {0, 7, 360, 361, 1000};
+    const std::vector<double> rates = {0.004, 0.05, 0.004, -0.002};
+    std::vector<double> expected(4), results(4);
+    ASSERT_EQ(pv_calculator_calculate_batch(
+        plain, rates.data(), cash_flows.data(), offsets.data(), 4, expected.data()), 0);
+
+    // Twice: first builds the tables, second is served from them
+    for (int pass = 0; pass < 2; ++pass) {
+        ASSERT_EQ(pv_calculator_calculate_batch(
+            cached, rates.data(), cash_flows.data(), offsets.data(), 4, results.data()), 0);
+        for (std::size_t i = 0; i < 4; ++i) {
+            EXPECT_NEAR(results[i], expected[i], 1e-12 * expected[i]) << i;
+        }
+    }
+
+    double single = 0.0;
+    ASSERT_EQ(pv_calculator_calculate(cached, 0.05, cash_flows.data() + 7, 353, &single), 0);
+    EXPECT_EQ(single, results[1]);
+
+    PVCacheStats stats{};
+    ASSERT_EQ(pv_calculator_get_cache_stats(cached, &stats), 0);
+    EXPECT_EQ(stats.hits, 6u);
+    EXPECT_EQ(stats.misses, 3u);
+
+    pv_calculator_destroy(plain);
+    pv_calculator_destroy(cached);
+}
+
+TEST(PresentValueCApiTest, CachedBatchesMatchForEveryThreadCount) {
+    // 600 streams of 1..300 flows over three rates: parallel batches read
+    // prefilled tables, so they must agree with the serial cached batch bit
+    // for bit (4 rates cached), and still do when the rates outgrow the
+    // cache and the batch falls back to one thread (2 rates cached)
+    const std::size_t n_streams = 600;
+    const std::vector<double> rate_set = {0.004, 0.05, 0.0125};
+    std::vector<double> rates, cash_flows;
+    std::vector<std::size_t> offsets = {0};
+    for (std::size_t s = 0; s < n_streams; ++s) {
+        rates.push_back(rate_set[s % rate_set.size()]);
+        for (std::size_t t = 0; t < 1 + (s * 37) % 300; ++t) {
+            cash_flows.push_back(40.0 + static_cast<double>((s + t) % 23) * 3.5);
+        }
+        offsets.push_back(cash_flows.size());
+    }
+
+    for (const std::size_t max_rates : {std::size_t{4}, std::size_t{2}}) {
+        PVCalculatorHandle calc = pv_calculator_create();
+        ASSERT_NE(calc, nullptr);
+        ASSERT_EQ(pv_calculator_set_cache(calc, max_rates), 0);
+
+        std::vector<double> serial(n_streams), parallel(n_streams);
+        std::vector<int> statuses(n_streams);
+        ASSERT_EQ(pv_calculator_calculate_batch(calc, rates.data(), cash_flows.data(), offsets.data(), n_streams,
+                                                serial.data()), 0);
+        for (const std::size_t n_threads : {std::size_t{2}, std::size_t{4}, std::size_t{0}}) {
+            ASSERT_EQ(pv_calculator_calculate_batch_parallel(calc, rates.data(), cash_flows.data(), offsets.data(),
+                                                             n_streams, parallel.data(), n_threads), 0);
+            ASSERT_EQ(parallel, serial) << max_rates << " rates, " << n_threads << " threads";
+            ASSERT_EQ(pv_calculator_calculate_batch_status_parallel(calc, rates.data(), cash_flows.data(),
+                                                                    offsets.data(), n_streams, parallel.data(),
+                                                                    statuses.data(), n_threads), 0);
+            ASSERT_EQ(parallel, serial) << max_rates << " rates, " << n_threads << " threads (status)";
+        }
+
+        pv_calculator_destroy(calc);
+    }
+}
+
+TEST(PresentValueCApiTest, CacheHitsPerformNoHeapAllocations) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+    ASSERT_EQ(pv_calculator_set_cache(calc, 4), 0);
+
+    const std::vector<double> cash_flows(360, 599.55);
+    double result = 0.0;
+    ASSERT_EQ(pv_calculator_calculate(calc, 0.005, cash_flows.data(), cash_flows.size(), &result), 0);
+
+    const std::size_t before = g_allocations.load();
+    int status = 0;
+    for (int i = 0; i < 1000; ++i) {
+        status |= pv_calculator_calculate(calc, 0.005, cash_flows.data(), cash_flows.size(), &result);
+    }
+    const std::size_t after = g_allocations.load();
+
+    ASSERT_EQ(status, 0);
+    ASSERT_EQ(after - before, 0u);
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(PresentValueCApiTest, CacheKeepsValidation) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+    ASSERT_EQ(pv_calculator_set_cache(calc, 4), 0);
+
+    const double cash_flows[] = {100.0};
+    double result = 0.0;
+    ASSERT_EQ(pv_calculator_calculate(calc, -1.5, cash_flows, 1, &result), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "discount_rate must be > -1");
+
+    PVCacheStats stats{};
+    ASSERT_EQ(pv_calculator_get_cache_stats(calc, &stats), 0);
+    EXPECT_EQ(stats.rates, 0u);
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(PresentValueCApiTest, MatrixMatchesSingleCalls) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const std::size_t n_streams = 7, n_periods = 30, stride = 32;
+    const double rates[] = {0.01, 0.04, 0.07};
+    std::vector<double> cash_flows(n_streams * stride, 0.0);
+    for (std::size_t s = 0; s < n_streams; ++s) {
+        for (std::size_t t = 0; t < n_periods; ++t) {
+            cash_flows[s * stride + t] = 10.0 * static_cast<double>(s + 1) + static_cast<double>(t % 5);
+        }
+    }
+    std::vector<double> curves;
+    for (const double rate : rates) {
+        for (std::size_t t = 0; t < n_periods; ++t) {
+            curves.push_back(1.0 / std::pow(1.0 + rate, static_cast<double>(t) + 1.0));
+        }
+    }
+
+    std::vector<double> results(n_streams * 3);
+    ASSERT_EQ(pv_calculator_calculate_matrix(calc, cash_flows.data(), n_streams, n_periods, stride,
+                                             curves.data(), 3, 0, results.data()), 0);
+    for (std::size_t s = 0; s < n_streams; ++s) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            double expected = 0.0;
+            ASSERT_EQ(pv_calculator_calculate(calc, rates[c], cash_flows.data() + s * stride, n_periods,
+                                              &expected), 0);
+            EXPECT_NEAR(results[s * 3 + c], expected, 1e-12 * expected) << s << "," << c;
+        }
+    }
+
+    ASSERT_EQ(pv_calculator_calculate_matrix(calc, cash_flows.data(), n_streams, n_periods, 16,
+                                             curves.data(), 3, 0, results.data()), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "row stride must be >= number of periods");
+
+    pv_calculator_destroy(calc);
+}
+
+// ===========================================================================
+// XNPV C API Tests
+// ===========================================================================
+
+TEST(XnpvCApiTest, MatchesExcelAndBatch) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    // 2008-01-01, 2008-03-01, 2008-10-30, 2009-02-15, 2009-04-01
+    const int64_t dates[] = {13879, 13939, 14182, 14290, 14335};
+    const double cash_flows[] = {-10000.0, 2750.0, 4250.0, 3250.0, 2750.0};
+    double result = 0.0;
+    ASSERT_EQ(pv_calculator_calculate_xnpv(calc, 0.09, dates, cash_flows, 5, DAY_COUNT_ACT_365, &result), 0);
+    EXPECT_NEAR(result, 2086.647602, 1e-6);
+
+    const double rates[] = {0.09, 0.05, 0.09};
+    const size_t offsets[] = {0, 5, 7, 10};
+    const int64_t batch_dates[] = {13879, 13939, 14182, 14290, 14335, 14290, 14335, 13879, 13939, 14182};
+    const double batch_flows[] = {-10000.0, 2750.0, 4250.0, 3250.0, 2750.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+    for (const int day_count : {DAY_COUNT_ACT_365, DAY_COUNT_ACT_360, DAY_COUNT_30_360}) {
+        double results[3] = {};
+        ASSERT_EQ(pv_calculator_calculate_xnpv_batch(calc, rates, batch_dates, batch_flows, offsets, 3,
+                                                     day_count, results), 0);
+        for (size_t i = 0; i < 3; ++i) {
+            double expected = 0.0;
+            ASSERT_EQ(pv_calculator_calculate_xnpv(calc, rates[i], batch_dates + offsets[i],
+                                                   batch_flows + offsets[i], offsets[i + 1] - offsets[i],
+                                                   day_count, &expected), 0);
+            EXPECT_EQ(results[i], expected) << day_count << " " << i;
+        }
+    }
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(XnpvCApiTest, ReportsErrors) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const int64_t dates[] = {0, 365};
+    const double cash_flows[] = {-100.0, 110.0};
+    double result = 0.0;
+    ASSERT_EQ(pv_calculator_calculate_xnpv(calc, 0.1, dates, cash_flows, 2, 7, &result), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "unknown day count convention");
+    ASSERT_EQ(pv_calculator_calculate_xnpv(calc, -1.5, dates, cash_flows, 2, DAY_COUNT_ACT_365, &result), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "discount_rate must be > -1");
+
+    const double rates[] = {0.1, 0.1};
+    const size_t offsets[] = {0, 2, 2};
+    double results[2] = {};
+    ASSERT_EQ(pv_calculator_calculate_xnpv_batch(calc, rates, dates, cash_flows, offsets, 2,
+                                                 DAY_COUNT_30_360, results), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "stream 1: cash_flows must not be empty");
+    EXPECT_NEAR(results[0], 0.0, 1e-12);
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(XnpvCApiTest, StatusBatchMarksInvalidStreams) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const int64_t dates[] = {0, 365, 0, 180, 0, 90};
+    const double cash_flows[] = {-100.0, 110.0, -50.0, 52.0, -10.0, 11.0};
+    const double rates[] = {0.1, -1.5, 0.05, 0.08};
+    const size_t offsets[] = {0, 2, 4, 4, 6};
+    double results[4] = {};
+    int statuses[4] = {};
+    ASSERT_EQ(pv_calculator_calculate_xnpv_batch_status(calc, rates, dates, cash_flows, offsets, 4,
+                                                        DAY_COUNT_ACT_360, results, statuses), 2);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "stream 1: discount_rate must be > -1");
+    EXPECT_EQ(statuses[0], CALC_STATUS_OK);
+    EXPECT_EQ(statuses[1], CALC_STATUS_DISCOUNT_RATE);
+    EXPECT_EQ(statuses[2], CALC_STATUS_EMPTY_CASH_FLOWS);
+    EXPECT_EQ(statuses[3], CALC_STATUS_OK);
+    EXPECT_TRUE(std::isnan(results[1]));
+    EXPECT_TRUE(std::isnan(results[2]));
+    for (size_t i : {size_t{0}, size_t{3}}) {
+        double expected = 0.0;
+        ASSERT_EQ(pv_calculator_calculate_xnpv(calc, rates[i], dates + offsets[i], cash_flows + offsets[i],
+                                               offsets[i + 1] - offsets[i], DAY_COUNT_ACT_360, &expected), 0);
+        EXPECT_EQ(results[i], expected) << i;
+    }
+
+    ASSERT_EQ(pv_calculator_calculate_xnpv_batch_status(calc, rates, dates, cash_flows, offsets, 4, 7, results,
+                                                        statuses), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "unknown day count convention");
+
+    pv_calculator_destroy(calc);
+}
+
+// ===========================================================================
+// Run-Length PV C API Tests
+// ===========================================================================
+
+TEST(RunLengthCApiTest, MatchesExpandedStream) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const double values[] = {50.0, 1050.0, 3.0};
+    const size_t counts[] = {9, 1, 0};
+    const double expanded[] = {50.0, 50.0, 50.0, 50.0, 50.0, 50.0, 50.0, 50.0, 50.0, 1050.0};
+    double result = 0.0;
+    double expected = 0.0;
+    ASSERT_EQ(pv_calculator_calculate_runs(calc, 0.04, values, counts, 3, &result), 0);
+    ASSERT_EQ(pv_calculator_calculate(calc, 0.04, expanded, 10, &expected), 0);
+    EXPECT_NEAR(result, expected, 1e-10);
+
+    ASSERT_EQ(pv_calculator_calculate_runs(calc, 0.04, values + 2, counts + 2, 1, &result), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "cash_flows must not be empty");
+    ASSERT_EQ(pv_calculator_calculate_runs(calc, -1.0, values, counts, 3, &result), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "discount_rate must be > -1");
+    ASSERT_EQ(pv_calculator_calculate_runs(calc, 0.04, nullptr, counts, 3, &result), -1);
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(RunLengthCApiTest, StatusBatchMarksInvalidStreams) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    // Streams: {50 x 9, 1050}, {3 x 0} (empty), {100 x 4}, {20 x 12}
+    const double values[] = {50.0, 1050.0, 3.0, 100.0, 20.0};
+    const size_t counts[] = {9, 1, 0, 4, 12};
+    const size_t offsets[] = {0, 2, 3, 4, 5};
+    const double rates[] = {0.04, 0.04, -1.0, 0.01};
+    double results[4] = {};
+    int statuses[4] = {};
+    ASSERT_EQ(pv_calculator_calculate_runs_batch_status(calc, rates, values, counts, offsets, 4, results,
+                                                        statuses), 2);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "stream 1: cash_flows must not be empty");
+    EXPECT_EQ(statuses[0], CALC_STATUS_OK);
+    EXPECT_EQ(statuses[1], CALC_STATUS_EMPTY_CASH_FLOWS);
+    EXPECT_EQ(statuses[2], CALC_STATUS_DISCOUNT_RATE);
+    EXPECT_EQ(statuses[3], CALC_STATUS_OK);
+    EXPECT_TRUE(std::isnan(results[1]));
+    EXPECT_TRUE(std::isnan(results[2]));
+    for (size_t i : {size_t{0}, size_t{3}}) {
+        double expected = 0.0;
+        ASSERT_EQ(pv_calculator_calculate_runs(calc, rates[i], values + offsets[i], counts + offsets[i],
+                                               offsets[i + 1] - offsets[i], &expected), 0);
+        EXPECT_EQ(results[i], expected) << i;
+    }
+
+    // The stopping form names the first invalid stream
+    ASSERT_EQ(pv_calculator_calculate_runs_batch(calc, rates, values, counts, offsets, 4, results), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "stream 1: cash_flows must not be empty");
+    ASSERT_EQ(pv_calculator_calculate_runs_batch(calc, rates, values, counts, offsets, 1, results), 0);
+    ASSERT_EQ(pv_calculator_calculate_runs_batch_status(calc, rates, values, counts, nullptr, 4, results,
+                                                        statuses), -1);
+
+    pv_calculator_destroy(calc);
+}
+
+// ===========================================================================
+// Sensitivity C API Tests
+// ===========================================================================
+
+TEST(SensitivityCApiTest, MatchesPresentValueAndBumps) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    std::vector<double> cash_flows(40, 35.0);
+    cash_flows.back() += 1000.0;
+    const double rate = 0.035;
+    const double h = 1e-5;
+
+    PVSensitivities risk{};
+    double pv = 0.0;
+    double up = 0.0;
+    double down = 0.0;
+    ASSERT_EQ(pv_calculator_calculate_sensitivities(calc, rate, cash_flows.data(), cash_flows.size(), &risk), 0);
+    ASSERT_EQ(pv_calculator_calculate(calc, rate, cash_flows.data(), cash_flows.size(), &pv), 0);
+    ASSERT_EQ(pv_calculator_calculate(calc, rate + h, cash_flows.data(), cash_flows.size(), &up), 0);
+    ASSERT_EQ(pv_calculator_calculate(calc, rate - h, cash_flows.data(), cash_flows.size(), &down), 0);
+
+    EXPECT_NEAR(risk.pv, pv, 1e-10 * pv);
+    EXPECT_NEAR(risk.dpv_dr, (up - down) / (2.0 * h), 1e-6 * std::fabs(risk.dpv_dr));
+    EXPECT_NEAR(risk.d2pv_dr2, (up - 2.0 * pv + down) / (h * h), 1e-3 * risk.d2pv_dr2);
+    EXPECT_DOUBLE_EQ(risk.dv01, -risk.dpv_dr * 1e-4);
+    EXPECT_DOUBLE_EQ(risk.modified_duration, -risk.dpv_dr / risk.pv);
+    EXPECT_DOUBLE_EQ(risk.convexity, risk.d2pv_dr2 / risk.pv);
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(SensitivityCApiTest, BatchMatchesSingleCalls) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const std::size_t n_streams = 3000;
+    std::vector<double> rates(n_streams);
+    std::vector<std::size_t> offsets(n_streams + 1, 0);
+    for (std::size_t i = 0; i < n_streams; ++i) {
+        rates[i] = 0.0001 * static_cast<double>(i % 400);
+        offsets[i + 1] = offsets[i] + 1 + i % 61;
+    }
+    const std::vector<double> cash_flows(offsets.back(), 40.0);
+
+    std::vector<PVSensitivities> serial(n_streams);
+    std::vector<PVSensitivities> parallel(n_streams);
+    ASSERT_EQ(pv_calculator_calculate_sensitivities_batch(
+        calc, rates.data(), cash_flows.data(), offsets.data(), n_streams, serial.data()), 0);
+    ASSERT_EQ(pv_calculator_calculate_sensitivities_batch_parallel(
+        calc, rates.data(), cash_flows.data(), offsets.data(), n_streams, parallel.data(), 0), 0);
+
+    for (std::size_t i = 0; i < n_streams; i += 7) {
+        PVSensitivities single{};
+        ASSERT_EQ(pv_calculator_calculate_sensitivities(
+            calc, rates[i], cash_flows.data() + offsets[i], offsets[i + 1] - offsets[i], &single), 0);
+        EXPECT_EQ(serial[i].pv, single.pv) << i;
+        EXPECT_EQ(serial[i].dpv_dr, single.dpv_dr) << i;
+        EXPECT_EQ(serial[i].d2pv_dr2, single.d2pv_dr2) << i;
+        EXPECT_EQ(parallel[i].pv, single.pv) << i;
+        EXPECT_EQ(parallel[i].convexity, single.convexity) << i;
+    }
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(SensitivityCApiTest, ReportsErrors) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const double cash_flows[] = {100.0, 100.0};
+    PVSensitivities result{};
+    ASSERT_EQ(pv_calculator_calculate_sensitivities(calc, -1.0, cash_flows, 2, &result), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "discount_rate must be > -1");
+    ASSERT_EQ(pv_calculator_calculate_sensitivities(calc, 0.05, cash_flows, 0, &result), -1);
+    ASSERT_EQ(pv_calculator_calculate_sensitivities(calc, 0.05, cash_flows, 2, nullptr), -1);
+
+    const double rates[] = {0.05, 0.05};
+    const std::size_t offsets[] = {0, 2, 1};
+    PVSensitivities results[2] = {};
+    ASSERT_EQ(pv_calculator_calculate_sensitivities_batch(calc, rates, cash_flows, offsets, 2, results), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "stream 1: offsets must be non-decreasing");
+    EXPECT_DOUBLE_EQ(results[0].pv, 100.0 / 1.05 + 100.0 / (1.05 * 1.05));
+
+    pv_calculator_destroy(calc);
+}
+
+// ===========================================================================
+// Precision C API Tests
+// ===========================================================================
+
+TEST(PrecisionCApiTest, MixedBatchMatchesDoubleCallsOnWidenedFlows) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const std::size_t n_streams = 2000;
+    std::vector<double> rates(n_streams);
+    std::vector<std::size_t> offsets(n_streams + 1, 0);
+    for (std::size_t i = 0; i < n_streams; ++i) {
+        rates[i] = 0.0001 * static_cast<double>(i % 400);
+        offsets[i + 1] = offsets[i] + 1 + i % 97;
+    }
+    std::vector<float> cash_flows(offsets.back());
+    for (std::size_t t = 0; t < cash_flows.size(); ++t) {
+        cash_flows[t] = 25.0f + static_cast<float>(t % 13) * 0.5f;
+    }
+    const std::vector<double> widened(cash_flows.begin(), cash_flows.end());
+
+    std::vector<double> serial(n_streams);
+    std::vector<double> parallel(n_streams);
+    ASSERT_EQ(pv_calculator_calculate_batch_mixed(
+        calc, rates.data(), cash_flows.data(), offsets.data(), n_streams, serial.data()), 0);
+    ASSERT_EQ(pv_calculator_calculate_batch_mixed_parallel(
+        calc, rates.data(), cash_flows.data(), offsets.data(), n_streams, parallel.data(), 0), 0);
+
+    for (std::size_t i = 0; i < n_streams; i += 7) {
+        const std::size_t n = offsets[i + 1] - offsets[i];
+        double single = 0.0;
+        double expected = 0.0;
+        ASSERT_EQ(pv_calculator_calculate_mixed(calc, rates[i], cash_flows.data() + offsets[i], n, &single), 0);
+        ASSERT_EQ(pv_calculator_calculate(calc, rates[i], widened.data() + offsets[i], n, &expected), 0);
+        EXPECT_EQ(single, expected) << i;
+        EXPECT_EQ(serial[i], expected) << i;
+        EXPECT_EQ(parallel[i], expected) << i;
+    }
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(PrecisionCApiTest, SinglePrecisionKeepsSixDigits) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    std::vector<float> cash_flows(360, 100.0f);
+    cash_flows.back() += 10000.0f;
+    const std::vector<double> widened(cash_flows.begin(), cash_flows.end());
+
+    float pv32 = 0.0f;
+    double pv = 0.0;
+    ASSERT_EQ(pv_calculator_calculate_f32(calc, 0.004f, cash_flows.data(), cash_flows.size(), &pv32), 0);
+    ASSERT_EQ(pv_calculator_calculate(calc, static_cast<double>(0.004f), widened.data(), widened.size(), &pv), 0);
+    EXPECT_NEAR(pv32, pv, 1e-6 * pv);
+
+    const float rates[] = {0.004f, 0.004f};
+    const std::size_t offsets[] = {0, 360, 720};
+    std::vector<float> two_streams(cash_flows);
+    two_streams.insert(two_streams.end(), cash_flows.begin(), cash_flows.end());
+    float results[2] = {};
+    ASSERT_EQ(pv_calculator_calculate_batch_f32_parallel(calc, rates, two_streams.data(), offsets, 2, results, 0), 0);
+    EXPECT_EQ(results[0], pv32);
+    EXPECT_EQ(results[1], pv32);
+
+    // Reproducible mode pins the scalar kernel: same answer, within the bound
+    ASSERT_EQ(pv_calculator_set_reproducible(calc, 1), 0);
+    float reproducible = 0.0f;
+    ASSERT_EQ(pv_calculator_calculate_f32(calc, 0.004f, cash_flows.data(), cash_flows.size(), &reproducible), 0);
+    EXPECT_NEAR(reproducible, pv, 1e-6 * pv);
+
+    FVCalculatorHandle fv = fv_calculator_create();
+    IRCalculatorHandle ir = ir_calculator_create();
+    ASSERT_NE(fv, nullptr);
+    ASSERT_NE(ir, nullptr);
+    float fv32 = 0.0f;
+    float ear32 = 0.0f;
+    double fv64 = 0.0;
+    double ear64 = 0.0;
+    ASSERT_EQ(fv_calculator_calculate_f32(fv, 1000.0f, 0.05f, 10, &fv32), 0);
+    ASSERT_EQ(fv_calculator_calculate(fv, 1000.0, static_cast<double>(0.05f), 10, &fv64), 0);
+    EXPECT_EQ(fv32, static_cast<float>(fv64));
+    ASSERT_EQ(ir_calculator_calculate_f32(ir, 0.12f, 12, &ear32), 0);
+    ASSERT_EQ(ir_calculator_calculate(ir, static_cast<double>(0.12f), 12, &ear64), 0);
+    EXPECT_EQ(ear32, static_cast<float>(ear64));
+
+    fv_calculator_destroy(fv);
+    ir_calculator_destroy(ir);
+    pv_calculator_destroy(calc);
+}
+
+TEST(PrecisionCApiTest, ReportsErrors) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const float cash_flows[] = {100.0f, 100.0f};
+    float result32 = 0.0f;
+    double result = 0.0;
+    ASSERT_EQ(pv_calculator_calculate_f32(calc, -1.0f, cash_flows, 2, &result32), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "discount_rate must be > -1");
+    ASSERT_EQ(pv_calculator_calculate_mixed(calc, 0.05, cash_flows, 0, &result), -1);
+    ASSERT_EQ(pv_calculator_calculate_mixed(calc, 0.05, nullptr, 2, &result), -1);
+
+    const double rates[] = {0.05, 0.05};
+    const std::size_t offsets[] = {0, 2, 1};
+    double results[2] = {};
+    ASSERT_EQ(pv_calculator_calculate_batch_mixed(calc, rates, cash_flows, offsets, 2, results), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "stream 1: offsets must be non-decreasing");
+    EXPECT_DOUBLE_EQ(results[0], 100.0 / 1.05 + 100.0 / (1.05 * 1.05));
+
+    FVCalculatorHandle fv = fv_calculator_create();
+    ASSERT_NE(fv, nullptr);
+    ASSERT_EQ(fv_calculator_calculate_f32(fv, 1000.0f, 0.05f, -1, &result32), -1);
+    ASSERT_STREQ(fv_calculator_get_error(fv), "periods must be >= 0");
+    fv_calculator_destroy(fv);
+
+    pv_calculator_destroy(calc);
+}
+
+// ===========================================================================
+// Status Batch C API Tests
+// ===========================================================================
+
+TEST(StatusBatchCApiTest, PresentValueSkipsInvalidStreams) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const std::size_t n_streams = 2000;
+    std::vector<double> rates(n_streams);
+    std::vector<std::size_t> offsets(n_streams + 1, 0);
+    for (std::size_t i = 0; i < n_streams; ++i) {
+        rates[i] = i % 50 == 7 ? -1.5 : 0.0001 * static_cast<double>(i % 300);
+        offsets[i + 1] = offsets[i] + (i % 97 == 3 ? 0 : 1 + i % 41);
+    }
+    const std::vector<double> cash_flows(offsets.back(), 80.0);
+
+    std::size_t expected_invalid = 0;
+    for (std::size_t i = 0; i < n_streams; ++i) {
+        if (offsets[i + 1] == offsets[i] || rates[i] <= -1.0) {
+            ++expected_invalid;
+        }
+    }
+
+    for (std::size_t threads : {1u, 0u}) {
+        std::vector<double> results(n_streams, 0.0);
+        std::vector<int> statuses(n_streams, -1);
+        ASSERT_EQ(pv_calculator_calculate_batch_status_parallel(
+            calc, rates.data(), cash_flows.data(), offsets.data(), n_streams, results.data(),
+            statuses.data(), threads), static_cast<int>(expected_invalid));
+        ASSERT_STREQ(pv_calculator_get_error(calc), "stream 3: cash_flows must not be empty");
+
+        for (std::size_t i = 0; i < n_streams; ++i) {
+            const std::size_t n = offsets[i + 1] - offsets[i];
+            if (n == 0) {
+                EXPECT_EQ(statuses[i], CALC_STATUS_EMPTY_CASH_FLOWS) << i;
+                EXPECT_TRUE(std::isnan(results[i])) << i;
+            } else if (rates[i] <= -1.0) {
+                EXPECT_EQ(statuses[i], CALC_STATUS_DISCOUNT_RATE) << i;
+                EXPECT_TRUE(std::isnan(results[i])) << i;
+            } else {
+                double expected = 0.0;
+                ASSERT_EQ(pv_calculator_calculate(calc, rates[i], cash_flows.data() + offsets[i], n, &expected), 0);
+                EXPECT_EQ(statuses[i], CALC_STATUS_OK) << i;
+                EXPECT_EQ(results[i], expected) << i;
+            }
+        }
+    }
+
+    // All valid: 0, and no error
+    std::vector<double> results(2);
+    std::vector<int> statuses(2);
+    ASSERT_EQ(pv_calculator_calculate_batch_status(calc, rates.data(), cash_flows.data(), offsets.data(), 2,
+                                                   results.data(), statuses.data()), 0);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "");
+    ASSERT_EQ(pv_calculator_calculate_batch_status(calc, rates.data(), cash_flows.data(), offsets.data(), 2,
+                                                   results.data(), nullptr), -1);
+
+    pv_calculator_destroy(calc);
+}
+
+TEST(StatusBatchCApiTest, FutureValueAndRatesMarkEachInvalidElement) {
+    FVCalculatorHandle fv = fv_calculator_create();
+    IRCalculatorHandle ir = ir_calculator_create();
+    ASSERT_NE(fv, nullptr);
+    ASSERT_NE(ir, nullptr);
+
+    const double principals[] = {1000.0, -5.0, 2500.0, 100.0, 100.0, 750.0};
+    const double interest_rates[] = {0.05, 0.05, 0.01, -2.0, 0.03, 0.04};
+    const int periods[] = {10, 10, 360, 5, -1, 12};
+    double results[6] = {};
+    int statuses[6] = {};
+    ASSERT_EQ(fv_calculator_calculate_batch_status(fv, principals, interest_rates, periods, 6, results, statuses), 3);
+    ASSERT_STREQ(fv_calculator_get_error(fv), "element 1: principal must be >= 0");
+    const int expected_fv[] = {CALC_STATUS_OK, CALC_STATUS_PRINCIPAL, CALC_STATUS_OK,
+                               CALC_STATUS_INTEREST_RATE, CALC_STATUS_PERIODS, CALC_STATUS_OK};
+    for (std::size_t i = 0; i < 6; ++i) {
+        EXPECT_EQ(statuses[i], expected_fv[i]) << i;
+        if (statuses[i] == CALC_STATUS_OK) {
+            double expected = 0.0;
+            ASSERT_EQ(fv_calculator_calculate(fv, principals[i], interest_rates[i], periods[i], &expected), 0);
+            EXPECT_EQ(results[i], expected) << i;
+        } else {
+            EXPECT_TRUE(std::isnan(results[i])) << i;
+        }
+    }
+
+    const double nominal_rates[] = {0.12, -1.0, 0.06, 0.08};
+    const int compounding[] = {12, 4, 0, 365};
+    ASSERT_EQ(ir_calculator_calculate_batch_status_parallel(ir, nominal_rates, compounding, 4, results, statuses,
+                                                            0), 2);
+    ASSERT_STREQ(ir_calculator_get_error(ir), "element 1: nominal_rate must be > -1");
+    EXPECT_EQ(statuses[1], CALC_STATUS_NOMINAL_RATE);
+    EXPECT_EQ(statuses[2], CALC_STATUS_COMPOUNDING_PERIODS);
+    double ear = 0.0;
+    ASSERT_EQ(ir_calculator_calculate(ir, 0.08, 365, &ear), 0);
+    EXPECT_EQ(results[3], ear);
+
+    EXPECT_STREQ(calculator_status_message(CALC_STATUS_OK), "ok");
+    EXPECT_STREQ(calculator_status_message(CALC_STATUS_OFFSETS), "offsets must be non-decreasing");
+    EXPECT_STREQ(calculator_status_message(CALC_STATUS_DATE_COUNT), "dates and cash_flows must have the same length");
+    EXPECT_STREQ(calculator_status_message(CALC_STATUS_NEGATIVE_TIME), "times must be >= 0");
+    EXPECT_STREQ(calculator_status_message(99), "unknown status");
+
+    ir_calculator_destroy(ir);
+    fv_calculator_destroy(fv);
+}
+
+TEST(StatusBatchCApiTest, InvalidInputsPerformNoHeapAllocations) {
+    FVCalculatorHandle fv = fv_calculator_create();
+    ASSERT_NE(fv, nullptr);
+
+    // The single-call error path stores a static message: no exception
+    double result = 0.0;
+    const std::size_t before = g_allocations.load();
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(fv_calculator_calculate(fv, -1.0, 0.05, 10, &result), -1);
+    }
+    ASSERT_LE(g_allocations.load() - before, 1u);
+    ASSERT_STREQ(fv_calculator_get_error(fv), "principal must be >= 0");
+
+    fv_calculator_destroy(fv);
+}
+
+// ===========================================================================
+// Thread-Safe (*_ex) C API Tests
+// ===========================================================================
+
+TEST(StatelessCApiTest, TabulatedExCallsPerformNoHeapAllocations) {
+    IRCalculatorHandle ir = ir_calculator_create();
+    ASSERT_NE(ir, nullptr);
+    // Builds the EAR tables (the first tabulated use in this process)
+    ASSERT_EQ(ir_calculator_set_tabulated(ir, 1), 0);
+
+    const double rates[] = {0.0523, 0.0412345, 0.75};
+    const int compounding[] = {12, 365, 52};
+    double results[3] = {};
+    int statuses[3] = {};
+    double ear = 0.0;
+    const std::size_t before = g_allocations.load();
+    for (int n : {2, 4, 12, 52, 360, 365}) {
+        ASSERT_EQ(ir_calculator_calculate_ex(ir, 0.0523, n, &ear), CALC_STATUS_OK);
+    }
+    ASSERT_EQ(ir_calculator_calculate_batch_ex(ir, rates, compounding, 3, results, statuses), CALC_STATUS_OK);
+    ASSERT_EQ(ir_calculator_calculate_ex(ir, 0.0523, 12, &ear), CALC_STATUS_OK);
+    ASSERT_EQ(g_allocations.load() - before, 0u);
+    EXPECT_EQ(results[0], ear);
+
+    ir_calculator_destroy(ir);
+}
+
+TEST(StatelessCApiTest, ExCallsReturnCodesAndLeaveTheHandleUntouched) {
+    PVCalculatorHandle pv = pv_calculator_create();
+    FVCalculatorHandle fv = fv_calculator_create();
+    IRCalculatorHandle ir = ir_calculator_create();
+    ASSERT_NE(pv, nullptr);
+    ASSERT_NE(fv, nullptr);
+    ASSERT_NE(ir, nullptr);
+
+    const double cash_flows[] = {50.0, 50.0, 1050.0};
+    double result = 0.0;
+    double expected = 0.0;
+    ASSERT_EQ(pv_calculator_calculate_ex(pv, 0.06, cash_flows, 3, &result), CALC_STATUS_OK);
+    ASSERT_EQ(pv_calculator_calculate(pv, 0.06, cash_flows, 3, &expected), 0);
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(pv_calculator_calculate_ex(pv, -1.0, cash_flows, 3, &result), CALC_STATUS_DISCOUNT_RATE);
+    EXPECT_EQ(pv_calculator_calculate_ex(pv, 0.06, cash_flows, 0, &result), CALC_STATUS_EMPTY_CASH_FLOWS);
+    EXPECT_EQ(pv_calculator_calculate_ex(pv, 0.06, nullptr, 3, &result), CALC_STATUS_NULL_POINTER);
+    EXPECT_STREQ(calculator_last_error(), "Invalid arguments: null pointer");
+    EXPECT_STREQ(pv_calculator_get_error(pv), "");
+
+    ASSERT_EQ(fv_calculator_calculate_ex(fv, 1000.0, 0.05, 10, &result), CALC_STATUS_OK);
+    ASSERT_EQ(fv_calculator_calculate(fv, 1000.0, 0.05, 10, &expected), 0);
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(fv_calculator_calculate_ex(fv, 1000.0, 0.05, -1, &result), CALC_STATUS_PERIODS);
+    EXPECT_EQ(calculator_last_status(), CALC_STATUS_PERIODS);
+    EXPECT_STREQ(calculator_last_error(), "periods must be >= 0");
+    EXPECT_STREQ(fv_calculator_get_error(fv), "");
+
+    ASSERT_EQ(ir_calculator_calculate_ex(ir, 0.12, 12, &result), CALC_STATUS_OK);
+    EXPECT_EQ(calculator_last_status(), CALC_STATUS_OK);
+    EXPECT_EQ(ir_calculator_calculate_ex(ir, 0.12, 0, &result), CALC_STATUS_COMPOUNDING_PERIODS);
+
+    // Batches: every element marked, first invalid code returned
+    const double rates[] = {0.05, -2.0, 0.04};
+    const double flat[] = {100.0, 200.0, 50.0, 75.0};
+    const std::size_t offsets[] = {0, 2, 3, 4};
+    double results[3] = {};
+    int statuses[3] = {};
+    ASSERT_EQ(pv_calculator_calculate_batch_ex(pv, rates, flat, offsets, 3, results, statuses),
+              CALC_STATUS_DISCOUNT_RATE);
+    EXPECT_EQ(statuses[0], CALC_STATUS_OK);
+    EXPECT_EQ(statuses[1], CALC_STATUS_DISCOUNT_RATE);
+    EXPECT_EQ(statuses[2], CALC_STATUS_OK);
+    EXPECT_TRUE(std::isnan(results[1]));
+    ASSERT_EQ(pv_calculator_calculate_ex(pv, 0.04, flat + 3, 1, &expected), CALC_STATUS_OK);
+    EXPECT_EQ(results[2], expected);
+
+    const double principals[] = {100.0, 100.0, -1.0};
+    const double interest_rates[] = {0.05, 0.06, 0.05};
+    const int periods[] = {10, 20, 10};
+    ASSERT_EQ(fv_calculator_calculate_batch_ex(fv, principals, interest_rates, periods, 3, results, statuses),
+              CALC_STATUS_PRINCIPAL);
+    EXPECT_EQ(statuses[0], CALC_STATUS_OK);
+    EXPECT_EQ(statuses[2], CALC_STATUS_PRINCIPAL);
+
+    const int compounding[] = {12, 4, 365};
+    ASSERT_EQ(ir_calculator_calculate_batch_ex(ir, rates + 2, compounding, 1, results, statuses), CALC_STATUS_OK);
+    EXPECT_EQ(ir_calculator_calculate_batch_ex(ir, rates, compounding, 3, nullptr, statuses),
+              CALC_STATUS_NULL_POINTER);
+
+    ir_calculator_destroy(ir);
+    fv_calculator_destroy(fv);
+    pv_calculator_destroy(pv);
+}
+
+TEST(StatelessCApiTest, OneHandleSharedBy64Threads) {
+    PVCalculatorHandle pv = pv_calculator_create();
+    FVCalculatorHandle fv = fv_calculator_create();
+    ASSERT_NE(pv, nullptr);
+    ASSERT_NE(fv, nullptr);
+
+    const std::vector<double> cash_flows(360, 25.0);
+    double expected_pv = 0.0;
+    double expected_fv = 0.0;
+    ASSERT_EQ(pv_calculator_calculate(pv, 0.004, cash_flows.data(), cash_flows.size(), &expected_pv), 0);
+    ASSERT_EQ(fv_calculator_calculate(fv, 1000.0, 0.004, 360, &expected_fv), 0);
+
+    double result = 0.0;
+    ASSERT_EQ(fv_calculator_calculate_ex(fv, -1.0, 0.004, 360, &result), CALC_STATUS_PRINCIPAL);
+
+    // Odd threads fail every other call; each thread must only ever see
+    // its own last status
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 64; ++t) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < 500; ++i) {
+                double value = 0.0;
+                const bool fail = (t % 2 == 1) && (i % 2 == 0);
+                const int status = fail
+                    ? fv_calculator_calculate_ex(fv, 1000.0, 0.004, -1, &value)
+                    : pv_calculator_calculate_ex(pv, 0.004, cash_flows.data(), cash_flows.size(), &value);
+                const bool ok = fail ? status == CALC_STATUS_PERIODS
+                                     : status == CALC_STATUS_OK && value == expected_pv;
+                if (!ok || calculator_last_status() != status) {
+                    mismatches.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+
+    // The main thread's status is its own
+    EXPECT_EQ(calculator_last_status(), CALC_STATUS_PRINCIPAL);
+
+    ASSERT_EQ(fv_calculator_calculate_ex(fv, 1000.0, 0.004, 360, &result), CALC_STATUS_OK);
+    EXPECT_EQ(result, expected_fv);
+
+    fv_calculator_destroy(fv);
+    pv_calculator_destroy(pv);
+}
+
+TEST(StatelessCApiTest, ModeSettersMayRunDuringExCalls) {
+    PVCalculatorHandle pv = pv_calculator_create();
+    IRCalculatorHandle ir = ir_calculator_create();
+    ASSERT_NE(pv, nullptr);
+    ASSERT_NE(ir, nullptr);
+
+    // Every result must be that of one mode or the other
+    const std::vector<double> cash_flows(360, 25.0);
+    double fast_pv = 0.0, reproducible_pv = 0.0, exact_ear = 0.0, tabulated_ear = 0.0;
+    ASSERT_EQ(pv_calculator_calculate(pv, 0.004, cash_flows.data(), cash_flows.size(), &fast_pv), 0);
+    ASSERT_EQ(ir_calculator_calculate(ir, 0.08, 12, &exact_ear), 0);
+    ASSERT_EQ(pv_calculator_set_reproducible(pv, 1), 0);
+    ASSERT_EQ(ir_calculator_set_tabulated(ir, 1), 0);
+    ASSERT_EQ(pv_calculator_calculate(pv, 0.004, cash_flows.data(), cash_flows.size(), &reproducible_pv), 0);
+    ASSERT_EQ(ir_calculator_calculate(ir, 0.08, 12, &tabulated_ear), 0);
+
+    std::atomic<bool> done{false};
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 8; ++t) {
+        workers.emplace_back([&] {
+            while (!done.load(std::memory_order_relaxed)) {
+                double value = 0.0;
+                if (pv_calculator_calculate_ex(pv, 0.004, cash_flows.data(), cash_flows.size(), &value)
+                        != CALC_STATUS_OK
+                    || (value != fast_pv && value != reproducible_pv)) {
+                    mismatches.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (ir_calculator_calculate_ex(ir, 0.08, 12, &value) != CALC_STATUS_OK
+                    || (value != exact_ear && value != tabulated_ear)) {
+                    mismatches.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 200; ++i) {
+        pv_calculator_set_reproducible(pv, i % 2);
+        ir_calculator_set_tabulated(ir, i % 2);
+    }
+    done.store(true, std::memory_order_relaxed);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+
+    ir_calculator_destroy(ir);
+    pv_calculator_destroy(pv);
+}
+
+TEST(StatelessCApiTest, ErrorPathsPerformNoHeapAllocations) {
+    PVCalculatorHandle pv = pv_calculator_create();
+    IRCalculatorHandle ir = ir_calculator_create();
+    ASSERT_NE(pv, nullptr);
+    ASSERT_NE(ir, nullptr);
+
+    const double cash_flows[] = {50.0, 50.0, 1050.0};
+    double result = 0.0;
+    const std::size_t before = g_allocations.load();
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(pv_calculator_calculate_ex(pv, -3.0, cash_flows, 3, &result), CALC_STATUS_DISCOUNT_RATE);
+        ASSERT_EQ(ir_calculator_calculate_ex(ir, -3.0, 12, &result), CALC_STATUS_NOMINAL_RATE);
+        ASSERT_STREQ(calculator_last_error(), "nominal_rate must be > -1");
+        ASSERT_EQ(pv_calculator_calculate_ex(pv, 0.05, cash_flows, 3, &result), CALC_STATUS_OK);
+    }
+    ASSERT_EQ(g_allocations.load(), before);
+
+    ir_calculator_destroy(ir);
+    pv_calculator_destroy(pv);
+}
+
+// ===========================================================================
+// Yield Curve C API Tests
+// ===========================================================================
+
+TEST(YieldCurveCApiTest, CurveBatchMatchesSingleCalls) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    YieldCurveHandle curve = yield_curve_create();
+    ASSERT_NE(calc, nullptr);
+    ASSERT_NE(curve, nullptr);
+
+    const double pillar_times[] = {0.5, 1.0, 2.0, 5.0, 10.0};
+    const double pillar_dfs[] = {0.985, 0.97, 0.935, 0.83, 0.66};
+    ASSERT_EQ(yield_curve_set_pillars(curve, pillar_times, pillar_dfs, 5, CURVE_QUOTE_DISCOUNT_FACTOR,
+                                      CURVE_INTERP_MONOTONE_CUBIC), 0);
+
+    double df = 0.0;
+    ASSERT_EQ(yield_curve_discount_factors(curve, pillar_times + 2, 1, &df), 0);
+    EXPECT_NEAR(df, 0.935, 1e-15);
+
+    // Semi-annual coupons: 2y, 5y and 7.5y bonds
+    std::vector<double> times, cash_flows;
+    std::vector<std::size_t> offsets = {0};
+    for (const int n_coupons : {4, 10, 15}) {
+        for (int i = 1; i <= n_coupons; ++i) {
+            times.push_back(0.5 * i);
+            cash_flows.push_back(i == n_coupons ? 102.0 : 2.0);
+        }
+        offsets.push_back(times.size());
+    }
+
+    std::vector<double> results(3);
+    ASSERT_EQ(pv_calculator_calculate_curve_batch(calc, curve, times.data(), cash_flows.data(),
+                                                  offsets.data(), 3, results.data()), 0);
+    for (std::size_t i = 0; i < 3; ++i) {
+        double expected = 0.0;
+        ASSERT_EQ(pv_calculator_calculate_curve(calc, curve, times.data() + offsets[i],
+                                                cash_flows.data() + offsets[i],
+                                                offsets[i + 1] - offsets[i], &expected), 0);
+        EXPECT_EQ(results[i], expected) << i;
+    }
+    EXPECT_NEAR(results[0], 2.0 * (0.985 + 0.97) + 102.0 * 0.935 + 2.0 * 0.9525, 1.0);
+
+    times[offsets[2]] = -0.5;
+    ASSERT_EQ(pv_calculator_calculate_curve_batch(calc, curve, times.data(), cash_flows.data(),
+                                                  offsets.data(), 3, results.data()), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "stream 2: times must be >= 0");
+
+    std::vector<int> statuses(3);
+    ASSERT_EQ(pv_calculator_calculate_curve_batch_status(calc, curve, times.data(), cash_flows.data(),
+                                                         offsets.data(), 3, results.data(), statuses.data()), 1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "stream 2: times must be >= 0");
+    EXPECT_EQ(statuses[0], CALC_STATUS_OK);
+    EXPECT_EQ(statuses[1], CALC_STATUS_OK);
+    EXPECT_EQ(statuses[2], CALC_STATUS_NEGATIVE_TIME);
+    EXPECT_TRUE(std::isnan(results[2]));
+    double expected = 0.0;
+    ASSERT_EQ(pv_calculator_calculate_curve(calc, curve, times.data() + offsets[1], cash_flows.data() + offsets[1],
+                                            offsets[2] - offsets[1], &expected), 0);
+    EXPECT_EQ(results[1], expected);
+
+    yield_curve_destroy(curve);
+    pv_calculator_destroy(calc);
+}
+
+TEST(YieldCurveCApiTest, ReportsInvalidCurves) {
+    PVCalculatorHandle calc = pv_calculator_create();
+    YieldCurveHandle curve = yield_curve_create();
+    ASSERT_NE(calc, nullptr);
+    ASSERT_NE(curve, nullptr);
+
+    const double times[] = {1.0};
+    const double cash_flows[] = {100.0};
+    double result = 0.0;
+    ASSERT_EQ(pv_calculator_calculate_curve(calc, curve, times, cash_flows, 1, &result), -1);
+    ASSERT_STREQ(pv_calculator_get_error(calc), "yield curve has no pillars");
+
+    const double bad_times[] = {2.0, 1.0};
+    const double rates[] = {0.02, 0.03};
+    ASSERT_EQ(yield_curve_set_pillars(curve, bad_times, rates, 2, CURVE_QUOTE_ZERO_RATE,
+                                      CURVE_INTERP_LINEAR), -1);
+    ASSERT_STREQ(yield_curve_get_error(curve), "pillar 1: times must be positive and strictly increasing");
+    ASSERT_EQ(yield_curve_set_pillars(curve, times, rates, 1, CURVE_QUOTE_ZERO_RATE, 7), -1);
+
+    ASSERT_EQ(yield_curve_set_pillars(curve, times, rates, 1, CURVE_QUOTE_ZERO_RATE, CURVE_INTERP_LINEAR), 0);
+    ASSERT_EQ(pv_calculator_calculate_curve(calc, curve, times, cash_flows, 1, &result), 0);
+    EXPECT_NEAR(result, 100.0 * std::exp(-0.02), 1e-12);
+
+    yield_curve_destroy(curve);
+    pv_calculator_destroy(calc);
+}
+
+// ===========================================================================
+// Future Value / Interest Rate Batch C API Tests
+// ===========================================================================
+
+TEST(FutureValueCApiTest, BatchMatchesScalarCalls) {
+    FVCalculatorHandle calc = fv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const double principals[] = {1000.0, 5000.0, 100.0};
+    const double rates[] = {0.05, 0.0325, 1.0};
+    const int periods[] = {10, 8, 5};
+    double results[3] = {};
+    ASSERT_EQ(fv_calculator_calculate_batch(calc, principals, rates, periods, 3, results), 0);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        double expected = 0.0;
+        ASSERT_EQ(fv_calculator_calculate(calc, principals[i], rates[i], periods[i], &expected), 0);
+        ASSERT_DOUBLE_EQ(results[i], expected);
+    }
+
+    fv_calculator_destroy(calc);
+}
+
+TEST(FutureValueCApiTest, BatchReportsFailingElement) {
+    FVCalculatorHandle calc = fv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const double principals[] = {1000.0, 1000.0};
+    const double rates[] = {0.05, 0.05};
+    const int periods[] = {10, -1};
+    double results[2] = {};
+    ASSERT_EQ(fv_calculator_calculate_batch(calc, principals, rates, periods, 2, results), -1);
+    ASSERT_STREQ(fv_calculator_get_error(calc), "element 1: periods must be >= 0");
+
+    fv_calculator_destroy(calc);
+}
+
+TEST(FutureValueCApiTest, ParallelBatchMatchesSerial) {
+    FVCalculatorHandle calc = fv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const std::size_t n = 3000;
+    std::vector<double> principals(n), rates(n);
+    std::vector<int> periods(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        principals[i] = 1000.0 + static_cast<double>(i);
+        rates[i] = 0.0001 * static_cast<double>(i);
+        periods[i] = static_cast<int>(i % 40);
+    }
+
+    std::vector<double> serial(n), parallel(n);
+    ASSERT_EQ(fv_calculator_calculate_batch(
+        calc, principals.data(), rates.data(), periods.data(), n, serial.data()), 0);
+    ASSERT_EQ(fv_calculator_calculate_batch_parallel(
+        calc, principals.data(), rates.data(), periods.data(), n, parallel.data(), 4), 0);
+    ASSERT_EQ(parallel, serial);
+
+    periods[2999] = -1;
+    periods[600] = -1;
+    ASSERT_EQ(fv_calculator_calculate_batch_parallel(
+        calc, principals.data(), rates.data(), periods.data(), n, parallel.data(), 4), -1);
+    ASSERT_STREQ(fv_calculator_get_error(calc), "element 600: periods must be >= 0");
+
+    fv_calculator_destroy(calc);
+}
+
+TEST(InterestRateCApiTest, BatchMatchesScalarCalls) {
+    IRCalculatorHandle calc = ir_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const double rates[] = {0.10, 0.12, 0.06};
+    const int periods[] = {1, 12, 365};
+    double results[3] = {};
+    ASSERT_EQ(ir_calculator_calculate_batch(calc, rates, periods, 3, results), 0);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        double expected = 0.0;
+        ASSERT_EQ(ir_calculator_calculate(calc, rates[i], periods[i], &expected), 0);
+        ASSERT_DOUBLE_EQ(results[i], expected);
+    }
+
+    ir_calculator_destroy(calc);
+}
+
+TEST(InterestRateCApiTest, UniformBatchMatchesScalarCalls) {
+    IRCalculatorHandle calc = ir_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    // Quotes on the 0.01bp grid, a few between grid points, one outside the table
+    const size_t n = 5000;
+    std::vector<double> rates(n);
+    for (size_t i = 0; i < n; ++i) {
+        rates[i] = static_cast<double>(40000 + (i * 37) % 20000) / 1e6;
+    }
+    rates[7] = 0.0512345678;
+    rates[4001] = 0.75;
+
+    for (int tabulated : {0, 1}) {
+        ASSERT_EQ(ir_calculator_set_tabulated(calc, tabulated), 0);
+        std::vector<double> serial(n);
+        std::vector<double> parallel(n);
+        ASSERT_EQ(ir_calculator_calculate_batch_uniform(calc, rates.data(), n, 365, serial.data()), 0);
+        ASSERT_EQ(ir_calculator_calculate_batch_uniform_parallel(calc, rates.data(), n, 365, parallel.data(), 4),
+                  0);
+        for (size_t i = 0; i < n; ++i) {
+            double expected = 0.0;
+            ASSERT_EQ(ir_calculator_calculate(calc, rates[i], 365, &expected), 0);
+            if (tabulated && i == 7) {
+                EXPECT_NEAR(serial[i], expected, 2e-16);  // off-grid: SIMD vs. scalar multiply-add
+            } else {
+                EXPECT_EQ(serial[i], expected) << tabulated << " " << i;
+            }
+            EXPECT_EQ(parallel[i], serial[i]) << tabulated << " " << i;
+        }
+    }
+
+    // Tabulated grid rates give the computed bits
+    double exact = 0.0;
+    double tabulated = 0.0;
+    ASSERT_EQ(ir_calculator_set_tabulated(calc, 0), 0);
+    ASSERT_EQ(ir_calculator_calculate(calc, 0.0523, 12, &exact), 0);
+    ASSERT_EQ(ir_calculator_set_tabulated(calc, 1), 0);
+    ASSERT_EQ(ir_calculator_calculate(calc, 0.0523, 12, &tabulated), 0);
+    EXPECT_EQ(tabulated, exact);
+
+    rates[3000] = -1.0;
+    rates[1200] = -2.0;
+    std::vector<double> results(n);
+    ASSERT_EQ(ir_calculator_calculate_batch_uniform_parallel(calc, rates.data(), n, 12, results.data(), 4), -1);
+    EXPECT_STREQ(ir_calculator_get_error(calc), "element 1200: nominal_rate must be > -1");
+    ASSERT_EQ(ir_calculator_calculate_batch_uniform(calc, rates.data(), n, 12, results.data()), -1);
+    EXPECT_STREQ(ir_calculator_get_error(calc), "element 1200: nominal_rate must be > -1");
+    double before_error = 0.0;
+    ASSERT_EQ(ir_calculator_calculate(calc, rates[1199], 12, &before_error), 0);
+    EXPECT_EQ(results[1199], before_error);
+    ASSERT_EQ(ir_calculator_calculate_batch_uniform(calc, rates.data(), n, 0, results.data()), -1);
+    EXPECT_STREQ(ir_calculator_get_error(calc), "compounding_periods must be > 0");
+    EXPECT_EQ(ir_calculator_calculate_batch_uniform(calc, nullptr, n, 12, results.data()), -1);
+    EXPECT_EQ(ir_calculator_set_tabulated(nullptr, 1), -1);
+
+    ir_calculator_destroy(calc);
+}
+
+// ===========================================================================
+// IRR C API Tests
+// ===========================================================================
+
+TEST(IrrCApiTest, BatchMatchesSingleCalls) {
+    IRRCalculatorHandle calc = irr_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const double cash_flows[] = {-100.0, 110.0, -1000.0, 300.0, 400.0, 500.0, 100.0, -230.0, 132.0};
+    const size_t offsets[] = {0, 2, 6, 9};
+    const double guesses[] = {0.0, 0.1, 0.3};
+
+    double result = 0.0;
+    ASSERT_EQ(irr_calculator_calculate(calc, cash_flows, 2, 0.1, &result), 0);
+    EXPECT_NEAR(result, 0.1, 1e-14);
+
+    double results[3] = {};
+    double parallel[3] = {};
+    ASSERT_EQ(irr_calculator_calculate_batch(calc, cash_flows, offsets, 3, guesses, results), 0);
+    ASSERT_EQ(irr_calculator_calculate_batch_parallel(calc, cash_flows, offsets, 3, guesses, parallel, 0), 0);
+    for (size_t i = 0; i < 3; ++i) {
+        double expected = 0.0;
+        ASSERT_EQ(irr_calculator_calculate(calc, cash_flows + offsets[i], offsets[i + 1] - offsets[i],
+                                           guesses[i], &expected), 0);
+        EXPECT_EQ(results[i], expected) << i;
+        EXPECT_EQ(parallel[i], expected) << i;
+    }
+    EXPECT_NEAR(results[2], 0.2, 1e-13);  // the root nearest the 30% guess
+
+    // NULL guesses start every stream at 10%
+    ASSERT_EQ(irr_calculator_calculate_batch(calc, cash_flows, offsets, 3, nullptr, results), 0);
+    EXPECT_NEAR(results[2], 0.1, 1e-13);
+
+    irr_calculator_destroy(calc);
+}
+
+TEST(IrrCApiTest, ReportsErrors) {
+    IRRCalculatorHandle calc = irr_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const double cash_flows[] = {-100.0, 110.0, 1.0, 2.0};
+    double result = 0.0;
+    ASSERT_EQ(irr_calculator_calculate(calc, cash_flows + 2, 2, 0.1, &result), -1);
+    ASSERT_STREQ(irr_calculator_get_error(calc), "cash_flows must change sign");
+    ASSERT_EQ(irr_calculator_calculate(calc, cash_flows, 2, -2.0, &result), -1);
+    ASSERT_STREQ(irr_calculator_get_error(calc), "guess must be > -1");
+    ASSERT_EQ(irr_calculator_set_tolerance(calc, 0.0, 10), -1);
+
+    const size_t offsets[] = {0, 2, 4};
+    double results[2] = {};
+    ASSERT_EQ(irr_calculator_calculate_batch(calc, cash_flows, offsets, 2, nullptr, results), -1);
+    ASSERT_STREQ(irr_calculator_get_error(calc), "stream 1: cash_flows must change sign");
+    EXPECT_NEAR(results[0], 0.1, 1e-14);
+
+    // A loose tolerance still lands within it
+    ASSERT_EQ(irr_calculator_set_tolerance(calc, 1e-4, 50), 0);
+    ASSERT_EQ(irr_calculator_calculate(calc, cash_flows, 2, 0.5, &result), 0);
+    EXPECT_NEAR(result, 0.1, 1e-4);
+
+    irr_calculator_destroy(calc);
+}
+
+TEST(IrrCApiTest, StatusBatchMarksFailingStreams) {
+    IRRCalculatorHandle calc = irr_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    // Solvable, no sign change, no root (PV > 0 everywhere), empty, solvable
+    // with a bad guess, solvable
+    const double cash_flows[] = {-100.0, 110.0, 1.0, 2.0, 1.0, -1.0, 1.0, -100.0, 121.0, -50.0, 60.0};
+    const size_t offsets[] = {0, 2, 4, 7, 7, 9, 11};
+    const double guesses[] = {0.1, 0.1, 0.1, 0.1, -2.0, 0.1};
+    double results[6] = {};
+    double parallel[6] = {};
+    int statuses[6] = {};
+    int parallel_statuses[6] = {};
+    ASSERT_EQ(irr_calculator_calculate_batch_status(calc, cash_flows, offsets, 6, guesses, results, statuses), 4);
+    ASSERT_STREQ(irr_calculator_get_error(calc), "stream 1: cash_flows must change sign");
+    ASSERT_EQ(irr_calculator_calculate_batch_status_parallel(calc, cash_flows, offsets, 6, guesses, parallel,
+                                                             parallel_statuses, 0), 4);
+    const int expected_statuses[] = {CALC_STATUS_OK, CALC_STATUS_SIGN_CHANGE, CALC_STATUS_IRR_NOT_FOUND,
+                                     CALC_STATUS_EMPTY_CASH_FLOWS, CALC_STATUS_GUESS, CALC_STATUS_OK};
+    for (size_t i = 0; i < 6; ++i) {
+        EXPECT_EQ(statuses[i], expected_statuses[i]) << i;
+        EXPECT_EQ(parallel_statuses[i], expected_statuses[i]) << i;
+        EXPECT_EQ(std::isnan(results[i]), expected_statuses[i] != CALC_STATUS_OK) << i;
+    }
+    EXPECT_NEAR(results[0], 0.1, 1e-14);
+    EXPECT_EQ(parallel[5], results[5]);
+    EXPECT_NEAR(results[5], 0.2, 1e-14);
+
+    // The stopping batch names the solver failure without a throw
+    const size_t no_root_offsets[] = {0, 3};
+    ASSERT_EQ(irr_calculator_calculate_batch(calc, cash_flows + 4, no_root_offsets, 1, nullptr, results), -1);
+    ASSERT_STREQ(irr_calculator_get_error(calc), "stream 0: IRR not found: no sign change of PV over rates > -1");
+
+    irr_calculator_destroy(calc);
+}
+
+// ===========================================================================
+// Bond C API Tests
+// ===========================================================================
+
+TEST(BondCApiTest, PriceMatchesPresentValueOfSchedule) {
+    BondCalculatorHandle calc = bond_calculator_create();
+    PVCalculatorHandle pv_calc = pv_calculator_create();
+    ASSERT_NE(calc, nullptr);
+    ASSERT_NE(pv_calc, nullptr);
+
+    // 10 annual 5% coupons on 1000 face, at 4%
+    std::vector<double> schedule(10, 50.0);
+    schedule[9] += 1000.0;
+    double expected = 0.0;
+    ASSERT_EQ(pv_calculator_calculate(pv_calc, 0.04, schedule.data(), schedule.size(), &expected), 0);
+
+    double price = 0.0;
+    ASSERT_EQ(bond_calculator_price(calc, 1000.0, 0.05, 10, 1, 0.04, &price), 0);
+    EXPECT_NEAR(price, expected, 1e-9);
+
+    double yield = 0.0;
+    ASSERT_EQ(bond_calculator_yield(calc, 1000.0, 0.05, 10, 1, price, &yield), 0);
+    EXPECT_NEAR(yield, 0.04, 1e-13);
+
+    BondAnalytics analytics{};
+    ASSERT_EQ(bond_calculator_analytics(calc, 1000.0, 0.05, 10, 1, 0.04, &analytics), 0);
+    EXPECT_EQ(analytics.price, price);
+    EXPECT_NEAR(analytics.modified_duration, analytics.macaulay_duration / 1.04, 1e-12);
+    EXPECT_GT(analytics.convexity, 0.0);
+
+    pv_calculator_destroy(pv_calc);
+    bond_calculator_destroy(calc);
+}
+
+TEST(BondCApiTest, BatchMatchesSingleCalls) {
+    BondCalculatorHandle calc = bond_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const double faces[] = {1000.0, 100.0, 100.0, 250.0};
+    const double coupon_rates[] = {0.05, 0.0425, 0.0, 0.07};
+    const int periods[] = {10, 20, 12, 360};
+    const int frequencies[] = {1, 2, 4, 12};
+    const double yields[] = {0.04, 0.05, 0.03, 0.065};
+
+    double prices[4] = {};
+    double parallel[4] = {};
+    double back[4] = {};
+    BondAnalytics analytics[4] = {};
+    ASSERT_EQ(bond_calculator_price_batch(calc, faces, coupon_rates, periods, frequencies, yields, 4, prices), 0);
+    ASSERT_EQ(bond_calculator_price_batch_parallel(calc, faces, coupon_rates, periods, frequencies, yields, 4,
+                                                   parallel, 0), 0);
+    ASSERT_EQ(bond_calculator_yield_batch_parallel(calc, faces, coupon_rates, periods, frequencies, prices, 4,
+                                                   back, 0), 0);
+    ASSERT_EQ(bond_calculator_analytics_batch(calc, faces, coupon_rates, periods, frequencies, yields, 4,
+                                              analytics), 0);
+    for (size_t i = 0; i < 4; ++i) {
+        double expected = 0.0;
+        ASSERT_EQ(bond_calculator_price(calc, faces[i], coupon_rates[i], periods[i], frequencies[i], yields[i],
+                                        &expected), 0);
+        EXPECT_EQ(prices[i], expected) << i;
+        EXPECT_EQ(parallel[i], expected) << i;
+        EXPECT_NEAR(back[i], yields[i], 1e-12) << i;
+        EXPECT_NEAR(analytics[i].price, expected, 1e-12 * expected) << i;
+    }
+
+    // Zero coupon: Macaulay duration is the maturity (12 quarters)
+    EXPECT_NEAR(analytics[2].macaulay_duration, 3.0, 1e-12);
+
+    bond_calculator_destroy(calc);
+}
+
+TEST(BondCApiTest, ReportsErrors) {
+    BondCalculatorHandle calc = bond_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    double result = 0.0;
+    ASSERT_EQ(bond_calculator_price(calc, 100.0, 0.05, 0, 1, 0.04, &result), -1);
+    ASSERT_STREQ(bond_calculator_get_error(calc), "periods must be >= 1");
+    ASSERT_EQ(bond_calculator_yield(calc, 100.0, 0.05, 10, 1, -5.0, &result), -1);
+    ASSERT_STREQ(bond_calculator_get_error(calc), "price must be > 0");
+    ASSERT_EQ(bond_calculator_price(calc, 100.0, 0.05, 10, 1, 0.04, nullptr), -1);
+    ASSERT_STREQ(bond_calculator_get_error(calc), "Invalid arguments: null pointer");
+
+    const double faces[] = {100.0, 100.0};
+    const double coupon_rates[] = {0.05, 0.05};
+    const int periods[] = {10, 10};
+    const int frequencies[] = {2, 0};
+    const double yields[] = {0.04, 0.04};
+    double results[2] = {};
+    ASSERT_EQ(bond_calculator_price_batch(calc, faces, coupon_rates, periods, frequencies, yields, 2, results), -1);
+    ASSERT_STREQ(bond_calculator_get_error(calc), "bond 1: frequency must be >= 1");
+    EXPECT_GT(results[0], 100.0);
+
+    bond_calculator_destroy(calc);
+    ASSERT_STREQ(bond_calculator_get_error(nullptr), "Invalid calculator handle");
+}
+
+TEST(BondCApiTest, StatusBatchesMarkFailingBonds) {
+    BondCalculatorHandle calc = bond_calculator_create();
+    ASSERT_NE(calc, nullptr);
+
+    const double faces[] = {1000.0, -1.0, 100.0, 100.0, 250.0};
+    const double coupon_rates[] = {0.05, 0.05, 0.04, 0.04, 0.07};
+    const int periods[] = {10, 10, 20, 20, 360};
+    const int frequencies[] = {1, 1, 2, 2, 12};
+    const double values[] = {0.04, 0.04, -3.0, 0.0, 0.065};  // yields, then prices
+
+    double prices[5] = {};
+    double parallel[5] = {};
+    int statuses[5] = {};
+    ASSERT_EQ(bond_calculator_price_batch_status(calc, faces, coupon_rates, periods, frequencies, values, 5,
+                                                 prices, statuses), 2);
+    ASSERT_STREQ(bond_calculator_get_error(calc), "bond 1: face must be > 0");
+    const int price_statuses[] = {CALC_STATUS_OK, CALC_STATUS_FACE, CALC_STATUS_YIELD, CALC_STATUS_OK,
+                                  CALC_STATUS_OK};
+    for (size_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(statuses[i], price_statuses[i]) << i;
+    }
+    EXPECT_TRUE(std::isnan(prices[1]));
+    EXPECT_TRUE(std::isnan(prices[2]));
+    ASSERT_EQ(bond_calculator_price_batch_status_parallel(calc, faces, coupon_rates, periods, frequencies, values,
+                                                          5, parallel, statuses, 0), 2);
+    for (size_t i : {size_t{0}, size_t{3}, size_t{4}}) {
+        double expected = 0.0;
+        ASSERT_EQ(bond_calculator_price(calc, faces[i], coupon_rates[i], periods[i], frequencies[i], values[i],
+                                        &expected), 0);
+        EXPECT_EQ(prices[i], expected) << i;
+        EXPECT_EQ(parallel[i], expected) << i;
+    }
+
+    // Back to yields from the prices (NaN prices are invalid)
+    double yields[5] = {};
+    ASSERT_EQ(bond_calculator_yield_batch_status(calc, faces, coupon_rates, periods, frequencies, prices, 5,
+                                                 yields, statuses), 2);
+    EXPECT_EQ(statuses[1], CALC_STATUS_FACE);
+    EXPECT_EQ(statuses[2], CALC_STATUS_PRICE);
+    EXPECT_NEAR(yields[0], 0.04, 1e-12);
+    EXPECT_NEAR(yields[4], 0.065, 1e-12);
+
+    BondAnalytics analytics[5] = {};
+    ASSERT_EQ(bond_calculator_analytics_batch_status_parallel(calc, faces, coupon_rates, periods, frequencies,
+                                                              values, 5, analytics, statuses, 0), 2);
+    EXPECT_EQ(statuses[2], CALC_STATUS_YIELD);
+    EXPECT_TRUE(std::isnan(analytics[2].price));
+    EXPECT_TRUE(std::isnan(analytics[2].convexity));
+    EXPECT_NEAR(analytics[4].price, prices[4], 1e-12 * prices[4]);
+
+    ASSERT_EQ(bond_calculator_analytics_batch_status(calc, faces, coupon_rates, periods, frequencies, values, 5,
+                                                     analytics, nullptr), -1);
+    ASSERT_STREQ(bond_calculator_get_error(calc), "Invalid arguments: null pointer");
+
+    bond_calculator_destroy(calc);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 #include <vector>
+#include <array>
+#include <span>
 #include <cmath>
+#include <cstddef>
 #include "../include/Calculator.hpp"
 #include "../include/CalculationPolicies.hpp"
+#include "../include/ErrorPolicies.hpp"
+#include "test_streams.hpp"
 
 // ===========================================================================
 // Present Value Policy Tests
@@ -58,6 +63,103 @@ TEST(PresentValuePolicyTest, InvalidDiscountRate) {
     ASSERT_THROW(calc.calculate(-1.5, cash_flows), std::invalid_argument);
 }
 
+TEST(PresentValuePolicyTest, AcceptsContiguousRangesWithoutCopy) {
+    Calculator<PresentValuePolicy> calc;
+
+    const double expected = 100.0 / 1.05 + 200.0 / (1.05 * 1.05);
+
+    // Braced list, std::array, std::span over a raw buffer
+    ASSERT_NEAR(calc.calculate(0.05, {100.0, 200.0}), expected, 1e-9);
+
+    const std::array<double, 2> fixed = {100.0, 200.0};
+    ASSERT_NEAR(calc.calculate(0.05, fixed), expected, 1e-9);
+
+    const double raw[] = {100.0, 200.0, 300.0};
+    ASSERT_NEAR(calc.calculate(0.05, std::span<const double>(raw, 2)), expected, 1e-9);
+
+    // Subrange of a larger stream, no temporary vector
+    std::vector<double> stream = {999.0, 100.0, 200.0};
+    ASSERT_NEAR(calc.calculate(0.05, std::span<const double>(stream).subspan(1)), expected, 1e-9);
+}
+
+// ===========================================================================
+// Recurrence / Horner Present Value Policy Tests
+// ===========================================================================
+
+TEST(RecurrencePresentValuePolicyTest, MatchesPowPathOnMortgageStrip) {
+    Calculator<PresentValuePolicy> pow_calc;
+    Calculator<RecurrencePresentValuePolicy> rec_calc;
+
+    // 30-year monthly level payment at 6% / 12
+    std::vector<double> cash_flows(360, 599.55);
+    const double rate = 0.06 / 12.0;
+
+    const double expected = pow_calc.calculate(rate, cash_flows);
+    const double actual = rec_calc.calculate(rate, cash_flows);
+
+    const double bound = (40.0 + 2.0 * 360.0) * std::ldexp(1.0, -53)
+                       * discounted_mass(1.0 + rate, cash_flows);
+    ASSERT_NEAR(actual, expected, bound);
+    ASSERT_NEAR(actual, 100000.0, 1.0);
+}
+
+TEST(RecurrencePresentValuePolicyTest, MatchesPowPathOnLongMixedStream) {
+    const std::vector<double> cash_flows = make_mixed_stream(100000);
+    const double rate = 0.0001;
+
+    const double expected = PresentValuePolicy::calculate(rate, cash_flows);
+    const double actual = RecurrencePresentValuePolicy::calculate(rate, cash_flows);
+
+    const double mass = discounted_mass(1.0 + rate, cash_flows);
+    const double bound = (40.0 + 2.0 * 100000.0) * std::ldexp(1.0, -53) * mass;
+    ASSERT_NEAR(actual, expected, bound);
+}
+
+TEST(RecurrencePresentValuePolicyTest, ZeroRateIsPlainSum) {
+    Calculator<RecurrencePresentValuePolicy> calc;
+
+    std::vector<double> cash_flows = {100.0, 200.0, 300.0};
+    ASSERT_DOUBLE_EQ(calc.calculate(0.0, cash_flows), 600.0);
+}
+
+TEST(RecurrencePresentValuePolicyTest, InvalidInputs) {
+    Calculator<RecurrencePresentValuePolicy> calc;
+
+    std::vector<double> empty_flows;
+    std::vector<double> cash_flows = {100.0};
+    ASSERT_THROW(calc.calculate(0.05, empty_flows), std::invalid_argument);
+    ASSERT_THROW(calc.calculate(-1.0, cash_flows), std::invalid_argument);
+}
+
+TEST(HornerPresentValuePolicyTest, MatchesPowPath) {
+    Calculator<HornerPresentValuePolicy> calc;
+
+    std::vector<double> cash_flows = {50.0, 50.0, 1050.0};
+    ASSERT_NEAR(calc.calculate(0.06, cash_flows),
+                PresentValuePolicy::calculate(0.06, cash_flows), 1e-10);
+}
+
+TEST(HornerPresentValuePolicyTest, WithinDocumentedBoundOnLongMixedStream) {
+    const std::vector<double> cash_flows = make_mixed_stream(100000);
+    const double rate = 0.0001;
+
+    const double expected = PresentValuePolicy::calculate(rate, cash_flows);
+    const double actual = HornerPresentValuePolicy::calculate(rate, cash_flows);
+
+    const double mass = discounted_mass(1.0 + rate, cash_flows);
+    const double bound = (3.0 + 2.0) * 100000.0 * std::ldexp(1.0, -53) * mass;
+    ASSERT_NEAR(actual, expected, bound);
+}
+
+TEST(HornerPresentValuePolicyTest, InvalidInputs) {
+    Calculator<HornerPresentValuePolicy> calc;
+
+    std::vector<double> empty_flows;
+    std::vector<double> cash_flows = {100.0};
+    ASSERT_THROW(calc.calculate(0.05, empty_flows), std::invalid_argument);
+    ASSERT_THROW(calc.calculate(-1.5, cash_flows), std::invalid_argument);
+}
+
 // ===========================================================================
 // Future Value Policy Tests
 // ===========================================================================
@@ -183,6 +285,86 @@ TEST(InterestRateConversionPolicyTest, InvalidNominalRate) {
     ASSERT_THROW(calc.calculate(-1.5, 12), std::invalid_argument);
 }
 
+// ===========================================================================
+// Compile-Time Evaluation Tests
+// ===========================================================================
+
+namespace {
+
+// A 5-year 10% annual bond on 1000 face
+constexpr std::array<double, 5> kFixedSchedule = {100.0, 100.0, 100.0, 100.0, 1100.0};
+
+constexpr std::array<int, 7> kFrequencies = {1, 2, 4, 12, 52, 360, 365};
+
+constexpr bool within(double a, double b, double tolerance) {
+    return (a > b ? a - b : b - a) <= tolerance;
+}
+
+// Growth factors (1.05)^n, n = 0..30, baked into a table at compile time
+constexpr std::array<double, 31> kGrowth = [] {
+    constexpr Calculator<FutureValuePolicy> fv_calc;
+    std::array<double, 31> table{};
+    for (std::size_t n = 0; n < table.size(); ++n) {
+        table[n] = fv_calc.calculate(1.0, 0.05, static_cast<int>(n));
+    }
+    return table;
+}();
+
+// EAR of a 5% nominal rate per standard compounding frequency
+constexpr std::array<double, 7> kEar = [] {
+    constexpr Calculator<InterestRateConversionPolicy> ir_calc;
+    std::array<double, 7> table{};
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        table[i] = ir_calc.calculate(0.05, kFrequencies[i]);
+    }
+    return table;
+}();
+
+constexpr Calculator<PresentValuePolicy> kPvCalc;
+
+static_assert(kGrowth[0] == 1.0 && kGrowth[1] == 1.05);
+static_assert(within(kGrowth[10], 1.628894626777442, 2e-16));
+static_assert(kEar[0] == 0.05);
+static_assert(within(kEar[3], 0.051161897881733004, 1e-17));
+static_assert(within(kEar[6], 0.051267496467447424, 1e-17));
+static_assert(within(kPvCalc.calculate(0.05, kFixedSchedule), 1216.473833531541, 1e-12));
+static_assert(kPvCalc.calculate(0.0, {1.0, 2.0, 3.0}) == 6.0);
+static_assert(Calculator<FutureValuePolicy>{}.calculate(250.0, 0.0, 1000) == 250.0);
+static_assert(Calculator<PresentValuePolicy, StatusErrorPolicy>{}.calculate(-1.0, kFixedSchedule).error()
+              == CalcError::DiscountRate);
+
+} // namespace
+
+TEST(ConstexprEvaluationTest, TablesMatchRuntimeResults) {
+    for (std::size_t n = 0; n < kGrowth.size(); ++n) {
+        EXPECT_DOUBLE_EQ(kGrowth[n], FutureValuePolicy::calculate(1.0, 0.05, static_cast<int>(n))) << n;
+    }
+    // Off the runtime fast path EAR is std::pow(...) - 1, good to about ulp(1)
+    // absolute; the compile-time engine subtracts the 1 before rounding
+    for (std::size_t i = 0; i < kEar.size(); ++i) {
+        EXPECT_NEAR(kEar[i], InterestRateConversionPolicy::calculate(0.05, kFrequencies[i]), 4e-16) << i;
+    }
+
+    const std::vector<double> schedule(kFixedSchedule.begin(), kFixedSchedule.end());
+    constexpr double kPv = kPvCalc.calculate(0.05, kFixedSchedule);
+    EXPECT_DOUBLE_EQ(kPv, PresentValuePolicy::calculate(0.05, schedule));
+}
+
+TEST(ConstexprEvaluationTest, LongHorizonsBeyondTheRuntimeFastPath) {
+    // The runtime takes std::pow here; compile time the integer power engine
+    constexpr double kFv = Calculator<FutureValuePolicy>{}.calculate(1000.0, 0.004, 360);
+    EXPECT_DOUBLE_EQ(kFv, FutureValuePolicy::calculate(1000.0, 0.004, 360));
+
+    constexpr std::array<double, 360> kMortgage = [] {
+        std::array<double, 360> flows{};
+        flows.fill(1342.05);
+        return flows;
+    }();
+    constexpr double kPv = kPvCalc.calculate(0.004, kMortgage);
+    const std::vector<double> mortgage(kMortgage.begin(), kMortgage.end());
+    EXPECT_NEAR(kPv, PresentValuePolicy::calculate(0.004, mortgage), 1e-13 * kPv);
+}
+
 // ===========================================================================
 // Integration Tests - Multiple Policies
 // ===========================================================================
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "../include/Calculator.hpp"
+#include "../include/DatedPresentValue.hpp"
+
+// ===========================================================================
+// Calendar Conversion
+// ===========================================================================
+
+static_assert(days_from_civil(1970, 1, 1) == 0);
+static_assert(days_from_civil(2000, 3, 1) == 11017);
+static_assert(days_from_civil(1969, 12, 31) == -1);
+static_assert(civil_from_days(11016).month == 2 && civil_from_days(11016).day == 29);
+static_assert(days_in_month(1900, 2) == 28 && days_in_month(2000, 2) == 29 && days_in_month(2023, 4) == 30);
+
+TEST(CivilDateTest, RoundTripsEveryDayFrom1900To2100) {
+    std::int64_t serial = days_from_civil(1900, 1, 1);
+    for (std::int64_t year = 1900; year < 2100; ++year) {
+        for (std::int64_t month = 1; month <= 12; ++month) {
+            for (std::int64_t day = 1; day <= days_in_month(year, month); ++day, ++serial) {
+                ASSERT_EQ(days_from_civil(year, month, day), serial);
+                const CivilDate civil = civil_from_days(serial);
+                ASSERT_EQ(civil.year, year);
+                ASSERT_EQ(civil.month, month);
+                ASSERT_EQ(civil.day, day);
+            }
+        }
+    }
+}
+
+// ===========================================================================
+// Day-Count Tests
+// ===========================================================================
+
+namespace {
+
+std::int64_t thirty_360(std::int64_t y1, std::int64_t m1, std::int64_t d1,
+                        std::int64_t y2, std::int64_t m2, std::int64_t d2) {
+    Thirty360::Counter counter(days_from_civil(y1, m1, d1));
+    return counter.days(days_from_civil(y2, m2, d2));
+}
+
+} // namespace
+
+TEST(DayCountTest, Thirty360BondBasis) {
+    EXPECT_EQ(thirty_360(2020, 1, 15, 2020, 3, 15), 60);
+    EXPECT_EQ(thirty_360(2020, 1, 31, 2020, 3, 31), 60);   // both 31sts become 30
+    EXPECT_EQ(thirty_360(2020, 1, 15, 2020, 3, 31), 76);   // end stays 31
+    EXPECT_EQ(thirty_360(2020, 2, 29, 2020, 3, 31), 32);   // no February adjustment
+    EXPECT_EQ(thirty_360(2019, 12, 30, 2020, 12, 31), 360);
+    EXPECT_EQ(thirty_360(2021, 6, 1, 2020, 6, 1), -360);
+}
+
+TEST(DayCountTest, Thirty360CounterMatchesFreshCounterInAnyOrder) {
+    const std::int64_t start = days_from_civil(2023, 1, 31);
+    Thirty360::Counter walking(start);
+    // Daily forward walk across month and year ends, then jumps and steps back
+    std::vector<std::int64_t> dates;
+    for (std::int64_t d = start; d < start + 800; ++d) {
+        dates.push_back(d);
+    }
+    for (std::int64_t d : {start + 5000, start + 12, start - 40, start + 61, start + 92}) {
+        dates.push_back(d);
+    }
+    for (std::int64_t d : dates) {
+        const CivilDate a = civil_from_days(start);
+        const CivilDate b = civil_from_days(d);
+        ASSERT_EQ(walking.days(d), thirty_360(a.year, a.month, a.day, b.year, b.month, b.day)) << d;
+    }
+}
+
+TEST(DayCountTest, ActualCountsCalendarDays) {
+    const Actual365Fixed::Counter counter(days_from_civil(2024, 1, 1));
+    EXPECT_EQ(counter.days(days_from_civil(2025, 1, 1)), 366);
+    EXPECT_EQ(Actual360::Counter(days_from_civil(2024, 3, 1)).days(days_from_civil(2024, 2, 1)), -29);
+}
+
+// ===========================================================================
+// XnpvPolicy Tests
+// ===========================================================================
+
+namespace {
+
+const std::vector<std::int64_t> kExcelDates = {
+    days_from_civil(2008, 1, 1), days_from_civil(2008, 3, 1), days_from_civil(2008, 10, 30),
+    days_from_civil(2009, 2, 15), days_from_civil(2009, 4, 1),
+};
+const std::vector<double> kExcelFlows = {-10000.0, 2750.0, 4250.0, 3250.0, 2750.0};
+
+template <typename DayCount>
+double xnpv_with_pow(double rate, const std::vector<std::int64_t>& dates, const std::vector<double>& flows) {
+    double pv = 0.0;
+    for (std::size_t i = 0; i < dates.size(); ++i) {
+        typename DayCount::Counter counter(dates[0]);
+        const double yf = static_cast<double>(counter.days(dates[i])) / DayCount::kDaysPerYear;
+        pv += flows[i] / std::pow(1.0 + rate, yf);
+    }
+    return pv;
+}
+
+} // namespace
+
+TEST(XnpvPolicyTest, MatchesExcelXnpv) {
+    Calculator<XnpvPolicy<>> xnpv;
+    EXPECT_NEAR(xnpv.calculate(0.09, kExcelDates, kExcelFlows), 2086.647602, 1e-6);
+}
+
+TEST(XnpvPolicyTest, EveryDayCountMatchesPowPerFlow) {
+    std::vector<std::int64_t> dates;
+    std::vector<double> flows;
+    // Monthly on the 31st (or month end) for 30 years
+    for (std::int64_t m = 0; m < 360; ++m) {
+        const std::int64_t year = 2025 + m / 12;
+        const std::int64_t month = m % 12 + 1;
+        dates.push_back(days_from_civil(year, month, days_in_month(year, month)));
+        flows.push_back(m == 0 ? -100000.0 : 650.0 + static_cast<double>(m % 7));
+    }
+    const double rate = 0.0425;
+    auto close = [](double a, double b) { return std::fabs(a - b) <= 1e-12 * 250000.0; };
+    EXPECT_TRUE(close(XnpvPolicy<Actual365Fixed>::calculate(rate, dates, flows),
+                      xnpv_with_pow<Actual365Fixed>(rate, dates, flows)));
+    EXPECT_TRUE(close(XnpvPolicy<Actual360>::calculate(rate, dates, flows),
+                      xnpv_with_pow<Actual360>(rate, dates, flows)));
+    EXPECT_TRUE(close(XnpvPolicy<Thirty360>::calculate(rate, dates, flows),
+                      xnpv_with_pow<Thirty360>(rate, dates, flows)));
+}
+
+TEST(XnpvPolicyTest, RegularScheduleMatchesPresentValue) {
+    // Under 30/360 mid-month monthly flows are exact 1/12 year steps
+    std::vector<std::int64_t> dates = {days_from_civil(2024, 1, 15)};
+    std::vector<double> flows = {0.0};
+    double expected = 0.0;
+    const double monthly = std::pow(1.05, 1.0 / 12.0);
+    for (std::int64_t m = 1; m <= 24; ++m) {
+        dates.push_back(days_from_civil(2024 + m / 12, m % 12 + 1, 15));
+        flows.push_back(100.0);
+        expected += 100.0 / std::pow(monthly, static_cast<double>(m));
+    }
+    EXPECT_NEAR(XnpvPolicy<Thirty360>::calculate(0.05, dates, flows), expected, 1e-9);
+}
+
+TEST(XnpvPolicyTest, InvalidInputs) {
+    const std::vector<std::int64_t> no_dates;
+    const std::vector<double> no_flows;
+    const std::vector<std::int64_t> one_date = {0};
+    const std::vector<double> one_flow = {1.0};
+    EXPECT_THROW(XnpvPolicy<>::calculate(0.05, no_dates, no_flows), std::invalid_argument);
+    EXPECT_THROW(XnpvPolicy<>::calculate(0.05, one_date, kExcelFlows), std::invalid_argument);
+    EXPECT_THROW(XnpvPolicy<>::calculate(-1.0, one_date, one_flow), std::invalid_argument);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+#include "../include/DiscountFactorCache.hpp"
+
+// ===========================================================================
+// DiscountFactorCache Tests
+// ===========================================================================
+
+TEST(DiscountFactorCacheTest, FactorsMatchPow) {
+    DiscountFactorCache cache(4);
+    const std::span<const double> df = cache.factors(0.05, 360);
+    ASSERT_EQ(df.size(), 360u);
+    for (std::size_t t = 0; t < df.size(); ++t) {
+        ASSERT_EQ(df[t], 1.0 / std::pow(1.05, static_cast<double>(t) + 1.0)) << t;
+    }
+}
+
+TEST(DiscountFactorCacheTest, ExtendsLazilyAndCountsHits) {
+    DiscountFactorCache cache(4);
+    const std::span<const double> first = cache.factors(0.01, 12);
+    const std::vector<double> short_table(first.begin(), first.end());
+    cache.factors(0.01, 6);
+    const std::span<const double> long_table = cache.factors(0.01, 120);
+
+    // The first call misses, the second hits, the third extends
+    const DiscountFactorCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.rates, 1u);
+    EXPECT_EQ(stats.factors, 120u);
+
+    for (std::size_t t = 0; t < short_table.size(); ++t) {
+        ASSERT_EQ(long_table[t], short_table[t]);
+    }
+}
+
+TEST(DiscountFactorCacheTest, EvictsLeastRecentlyUsedRate) {
+    DiscountFactorCache cache(2);
+    cache.factors(0.01, 10);
+    cache.factors(0.02, 20);
+    cache.factors(0.01, 10);  // 0.02 is now the oldest
+    cache.factors(0.03, 30);
+
+    DiscountFactorCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.rates, 2u);
+    EXPECT_EQ(stats.factors, 40u);
+
+    cache.factors(0.01, 10);
+    EXPECT_EQ(cache.stats().hits, 2u);
+    cache.factors(0.02, 20);
+    stats = cache.stats();
+    EXPECT_EQ(stats.misses, 4u);
+    EXPECT_EQ(stats.evictions, 2u);
+}
+
+TEST(DiscountFactorCacheTest, FindOnlyReadsExistingTables) {
+    DiscountFactorCache cache(2);
+    const std::span<const double> built = cache.factors(0.01, 24);
+    const DiscountFactorCache::Stats before = cache.stats();
+
+    const std::span<const double> found = cache.find(0.01, 12);
+    ASSERT_EQ(found.size(), 12u);
+    EXPECT_EQ(found.data(), built.data());
+    EXPECT_TRUE(cache.find(0.01, 25).empty());  // would need extending
+    EXPECT_TRUE(cache.find(0.02, 1).empty());   // no table
+
+    const DiscountFactorCache::Stats after = cache.stats();
+    EXPECT_EQ(after.hits, before.hits);
+    EXPECT_EQ(after.misses, before.misses);
+    EXPECT_EQ(after.rates, 1u);
+}
+
+TEST(DiscountFactorCacheTest, SignedZeroSharesATable) {
+    DiscountFactorCache cache(2);
+    cache.factors(0.0, 5);
+    const std::span<const double> df = cache.factors(-0.0, 5);
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_EQ(df[4], 1.0);
+}
+
+TEST(DiscountFactorCacheTest, ClearResetsEverything) {
+    DiscountFactorCache cache(2);
+    cache.factors(0.01, 10);
+    cache.factors(0.01, 10);
+    cache.clear();
+
+    const DiscountFactorCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.hits, 0u);
+    EXPECT_EQ(stats.misses, 0u);
+    EXPECT_EQ(stats.rates, 0u);
+    EXPECT_EQ(stats.factors, 0u);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
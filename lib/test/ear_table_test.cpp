@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/EarTable.hpp"
+#include "../include/ErrorPolicies.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+const simd::Isa kAllIsas[] = {
+    simd::Isa::Scalar,
+    simd::Isa::SSE2,
+    simd::Isa::AVX2,
+    simd::Isa::AVX512,
+};
+
+const int kStandardFrequencies[] = {2, 4, 12, 52, 360, 365};
+
+// Quotes on the 0.01bp grid, as a feed parses them
+std::vector<double> grid_rates(std::size_t n) {
+    std::vector<double> rates(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        rates[i] = (static_cast<double>((i * 7919) % 300000) - 10000.0) / 1e6;
+    }
+    return rates;
+}
+
+// Rates between grid points (up to half a step either side)
+std::vector<double> off_grid_rates(std::size_t n) {
+    std::vector<double> rates(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double fraction = static_cast<double>(i % 101) / 100.0 - 0.5;
+        rates[i] = (static_cast<double>((i * 7919) % 300000) - 10000.0 + fraction) / 1e6;
+    }
+    return rates;
+}
+
+// (1 + r/n)^n - 1 in long double
+double reference_ear(double nominal_rate, int compounding_periods) {
+    const long double n = compounding_periods;
+    return static_cast<double>(std::expm1(n * std::log1p(static_cast<long double>(nominal_rate) / n)));
+}
+
+} // namespace
+
+// ===========================================================================
+// Table Lookup
+// ===========================================================================
+
+TEST(EarTableTest, GridRatesReturnThePolicyExactly) {
+    const std::vector<double> rates = grid_rates(1001);
+    for (int n : kStandardFrequencies) {
+        const EarTable* table = EarTable::standard(n);
+        ASSERT_NE(table, nullptr);
+        for (double r : rates) {
+            EXPECT_EQ(table->convert(r), InterestRateConversionPolicy::evaluate(r, n)) << n << " " << r;
+        }
+        EXPECT_EQ(table->convert(0.0523), InterestRateConversionPolicy::calculate(0.0523, n));
+    }
+}
+
+TEST(EarTableTest, OffGridRatesStayWithinThePolicyError) {
+    const std::vector<double> rates = off_grid_rates(2000);
+    for (int n : kStandardFrequencies) {
+        const EarTable* table = EarTable::standard(n);
+        ASSERT_NE(table, nullptr);
+        for (double r : rates) {
+            const double policy = InterestRateConversionPolicy::evaluate(r, n);
+            const double expected = reference_ear(r, n);
+            // The policy's own error: r/n and 1 + r/n rounded, then raised to n
+            const double tolerance = (n + 4.0) * 0x1p-52 * (1.0 + expected);
+            EXPECT_NEAR(policy, expected, tolerance);
+            EXPECT_NEAR(table->convert(r), expected, tolerance) << n << " " << r;
+        }
+    }
+}
+
+TEST(EarTableTest, AllPathsAgree) {
+    const EarTable* table = EarTable::standard(365);
+    ASSERT_NE(table, nullptr);
+    // Lengths straddle the AVX2 / AVX-512 widths
+    for (std::size_t size : {1u, 3u, 4u, 7u, 8u, 9u, 1001u}) {
+        const std::vector<double> on_grid = grid_rates(size);
+        const std::vector<double> off_grid = off_grid_rates(size);
+        for (simd::Isa isa : kAllIsas) {
+            if (!simd::isa_supported(isa)) {
+                continue;
+            }
+            std::vector<double> out(size);
+            table->convert(isa, on_grid.data(), size, out.data());
+            for (std::size_t i = 0; i < size; ++i) {
+                EXPECT_EQ(out[i], table->convert(on_grid[i])) << simd::isa_name(isa) << " " << i;
+            }
+            table->convert(isa, off_grid.data(), size, out.data());
+            for (std::size_t i = 0; i < size; ++i) {
+                EXPECT_NEAR(out[i], table->convert(off_grid[i]), 2e-16) << simd::isa_name(isa) << " " << i;
+            }
+        }
+    }
+}
+
+TEST(EarTableTest, RatesOutsideTheTableComputeExactly) {
+    const EarTable table(12, 0.01, 0.02);
+    EXPECT_EQ(table.min_rate(), 0.01);
+    EXPECT_EQ(table.max_rate(), 0.02);
+    EXPECT_EQ(table.nodes().size(), 10001u);
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<double> rates = {0.01, 0.02, 0.0099994, 0.0200006, -0.5, 0.35, 7.0, 0.015, nan};
+    for (simd::Isa isa : kAllIsas) {
+        if (!simd::isa_supported(isa)) {
+            continue;
+        }
+        std::vector<double> out(rates.size());
+        table.convert(isa, rates.data(), rates.size(), out.data());
+        for (std::size_t i = 0; i + 1 < rates.size(); ++i) {
+            EXPECT_EQ(out[i], InterestRateConversionPolicy::evaluate(rates[i], 12)) << simd::isa_name(isa) << " " << i;
+        }
+        EXPECT_TRUE(std::isnan(out.back()));
+    }
+}
+
+TEST(EarTableTest, StandardTablesAreSharedAndCoverTheDefaultRange) {
+    const EarTable* monthly = EarTable::standard(12);
+    ASSERT_NE(monthly, nullptr);
+    EXPECT_EQ(EarTable::standard(12), monthly);
+    EXPECT_EQ(monthly->compounding_periods(), 12);
+    EXPECT_EQ(monthly->min_rate(), EarTable::kDefaultMinRate);
+    EXPECT_EQ(monthly->max_rate(), EarTable::kDefaultMaxRate);
+
+    EXPECT_EQ(EarTable::standard(1), nullptr);
+    EXPECT_EQ(EarTable::standard(3), nullptr);
+    EXPECT_EQ(EarTable::standard(0), nullptr);
+
+    EXPECT_TRUE(EarTable::build_standard());
+    EXPECT_EQ(EarTable::standard(12), monthly);  // not rebuilt
+    for (int n : EarTable::kStandardFrequencies) {
+        EXPECT_NE(EarTable::standard(n), nullptr) << n;
+    }
+}
+
+TEST(EarTableTest, InvalidConstruction) {
+    EXPECT_THROW(EarTable(0), std::invalid_argument);
+    EXPECT_THROW(EarTable(12, 0.02, 0.01), std::invalid_argument);
+    EXPECT_THROW(EarTable(12, -1.0, 0.01), std::invalid_argument);
+    EXPECT_THROW(EarTable(12, 0.0, std::numeric_limits<double>::infinity()), std::invalid_argument);
+    EXPECT_THROW(EarTable(12, 0.0, 100.0), std::invalid_argument);  // > kMaxNodes
+}
+
+// ===========================================================================
+// TabulatedInterestRateConversionPolicy
+// ===========================================================================
+
+TEST(TabulatedInterestRateConversionPolicyTest, MatchesTheTableAndTheExactPolicy) {
+    Calculator<TabulatedInterestRateConversionPolicy> ir_calc;
+    EXPECT_EQ(ir_calc.calculate(0.0523, 365), InterestRateConversionPolicy::calculate(0.0523, 365));
+    EXPECT_EQ(ir_calc.calculate(0.05234567, 12), EarTable::standard(12)->convert(0.05234567));
+    // Frequencies without a table
+    EXPECT_EQ(ir_calc.calculate(0.12, 7), InterestRateConversionPolicy::calculate(0.12, 7));
+    EXPECT_EQ(ir_calc.calculate(0.12, 1), 0.12);
+
+    const std::vector<double> rates = off_grid_rates(100);
+    for (int n : {12, 7}) {
+        std::vector<double> ears(rates.size());
+        ir_calc.calculate_batch(rates, n, ears);
+        for (std::size_t i = 0; i < rates.size(); ++i) {
+            EXPECT_NEAR(ears[i], ir_calc.calculate(rates[i], n), 2e-16);
+        }
+    }
+}
+
+TEST(TabulatedInterestRateConversionPolicyTest, InvalidInputs) {
+    Calculator<TabulatedInterestRateConversionPolicy> ir_calc;
+    EXPECT_THROW(ir_calc.calculate(-1.0, 12), std::invalid_argument);
+    EXPECT_THROW(ir_calc.calculate(0.05, 0), std::invalid_argument);
+
+    const std::vector<double> rates = {0.05, 0.06, -1.5, 0.07};
+    std::vector<double> ears(rates.size(), -7.0);
+    try {
+        ir_calc.calculate_batch(rates, 12, ears);
+        FAIL() << "expected std::invalid_argument";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_EQ(std::string(e.what()), "element 2: nominal_rate must be > -1");
+    }
+    EXPECT_EQ(ears[0], -7.0);  // nothing written
+    EXPECT_THROW(ir_calc.calculate_batch(rates, 0, ears), std::invalid_argument);
+    std::vector<double> short_results(2);
+    EXPECT_THROW(ir_calc.calculate_batch(rates, 12, short_results), std::invalid_argument);
+
+    Calculator<TabulatedInterestRateConversionPolicy, StatusErrorPolicy> status_calc;
+    EXPECT_EQ(status_calc.calculate(-2.0, 12).error(), CalcError::NominalRate);
+    EXPECT_EQ(*status_calc.calculate(0.05, 12), InterestRateConversionPolicy::calculate(0.05, 12));
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
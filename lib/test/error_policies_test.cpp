@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../include/BondPricing.hpp"
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/DatedPresentValue.hpp"
+#include "../include/ErrorPolicies.hpp"
+#include "../include/InternalRateOfReturn.hpp"
+#include "../include/PresentValueSensitivities.hpp"
+#include "../include/RunLengthPresentValue.hpp"
+#include "../include/SimdKernels.hpp"
+#include "../include/SummationPolicies.hpp"
+#include "../include/YieldCurve.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+const std::vector<double> kCashFlows = {-1000.0, 300.0, 400.0, 500.0, 200.0};
+const std::vector<double> kEmpty;
+
+// The message the throwing path reports for the same arguments
+template <typename F>
+std::string thrown_message(F&& f) {
+    try {
+        f();
+    } catch (const std::invalid_argument& e) {
+        return e.what();
+    }
+    return "";
+}
+
+// Status calculators must not be able to throw for bad arguments
+static_assert(noexcept(StatusErrorPolicy::call<PresentValuePolicy>(0.05, std::span<const double>())));
+static_assert(noexcept(StatusErrorPolicy::call<FutureValuePolicy>(100.0, 0.05, 10)));
+static_assert(noexcept(StatusErrorPolicy::call<InterestRateConversionPolicy>(0.05, 12)));
+static_assert(noexcept(StatusErrorPolicy::call<InternalRateOfReturnPolicy>(std::span<const double>(), 0.1)));
+static_assert(noexcept(StatusErrorPolicy::call<BondPricingPolicy>(BondTerms{100.0, 0.05, 10, 2}, 0.04)));
+static_assert(noexcept(StatusErrorPolicy::call<XnpvPolicy<Thirty360>>(
+    0.05, std::span<const std::int64_t>(), std::span<const double>())));
+static_assert(noexcept(StatusErrorPolicy::call<RunLengthPresentValuePolicy>(0.05, std::span<const CashFlowRun>())));
+static_assert(noexcept(StatusErrorPolicy::call<CurvePresentValuePolicy>(
+    std::declval<const YieldCurve&>(), std::span<const double>(), std::span<const double>())));
+
+// A solver's Expected<T> is passed through, not nested
+static_assert(std::is_same_v<decltype(StatusErrorPolicy::call<InternalRateOfReturnPolicy>(
+                                 std::span<const double>(), 0.1)),
+                             Expected<double>>);
+
+// Span batches have no Expected<> form: only the throwing calculator has
+// them, and they are callable on a const calculator
+template <typename Calc>
+concept HasFvBatch = requires(const Calc& calc, std::span<const double> values, std::span<const int> periods,
+                              std::span<double> results) {
+    calc.calculate_batch(values, values, periods, results);
+};
+static_assert(HasFvBatch<Calculator<SimdFutureValuePolicy>>);
+static_assert(!HasFvBatch<Calculator<SimdFutureValuePolicy, StatusErrorPolicy>>);
+
+const std::vector<std::int64_t> kDates = {0, 90, 200, 365, 800};
+
+const std::vector<CashFlowRun> kRuns = {{50.0, 9}, {1050.0, 1}};
+const std::vector<double> kTimes = {0.5, 1.0, 2.0, 3.5, 5.0};
+const std::vector<double> kPillarTimes = {1.0, 5.0};
+const std::vector<double> kPillarRates = {0.02, 0.03};
+
+} // namespace
+
+// ===========================================================================
+// Expected
+// ===========================================================================
+
+TEST(ErrorPoliciesTest, ExpectedHoldsValueOrError) {
+    const Expected<double> ok = 1.5;
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(ok.error(), CalcError::None);
+    EXPECT_EQ(*ok, 1.5);
+    EXPECT_EQ(ok.value(), 1.5);
+
+    const Expected<double> bad = CalcError::DiscountRate;
+    EXPECT_FALSE(bad);
+    EXPECT_EQ(bad.error(), CalcError::DiscountRate);
+    EXPECT_EQ(bad.value_or(-7.0), -7.0);
+    EXPECT_THROW(static_cast<void>(bad.value()), std::invalid_argument);
+    EXPECT_EQ(error_message(CalcError::None), nullptr);
+}
+
+// ===========================================================================
+// Calculator<Policy, StatusErrorPolicy>
+// ===========================================================================
+
+TEST(ErrorPoliciesTest, StatusResultsMatchThrowingResults) {
+    Calculator<PresentValuePolicy> pv_throwing;
+    Calculator<PresentValuePolicy, StatusErrorPolicy> pv_status;
+    const Expected<double> pv = pv_status.calculate(0.05, kCashFlows);
+    ASSERT_TRUE(pv);
+    EXPECT_EQ(*pv, pv_throwing.calculate(0.05, kCashFlows));
+    EXPECT_EQ(*pv_status.calculate(0.05, {100.0, 200.0}), pv_throwing.calculate(0.05, {100.0, 200.0}));
+
+    Calculator<FutureValuePolicy, StatusErrorPolicy> fv_status;
+    EXPECT_EQ(*fv_status.calculate(1000.0, 0.05, 10), FutureValuePolicy::calculate(1000.0, 0.05, 10));
+
+    Calculator<InterestRateConversionPolicy, StatusErrorPolicy> ir_status;
+    EXPECT_EQ(*ir_status.calculate(0.12, 12), InterestRateConversionPolicy::calculate(0.12, 12));
+
+    Calculator<SimdPresentValuePolicy, StatusErrorPolicy> simd_status;
+    EXPECT_EQ(*simd_status.calculate(0.05, kCashFlows), SimdPresentValuePolicy::calculate(0.05, kCashFlows));
+
+    Calculator<SummedPresentValuePolicy<NeumaierSummation>, StatusErrorPolicy> summed_status;
+    EXPECT_EQ(*summed_status.calculate(0.05, kCashFlows),
+              SummedPresentValuePolicy<NeumaierSummation>::calculate(0.05, kCashFlows));
+
+    Calculator<PresentValueSensitivityPolicy, StatusErrorPolicy> risk_status;
+    const Expected<PvSensitivities> risk = risk_status.calculate(0.05, kCashFlows);
+    ASSERT_TRUE(risk);
+    EXPECT_EQ(risk->dpv_dr, PresentValueSensitivityPolicy::calculate(0.05, kCashFlows).dpv_dr);
+
+    Calculator<InternalRateOfReturnPolicy, StatusErrorPolicy> irr_status;
+    const Expected<double> irr = irr_status.calculate(kCashFlows, 0.1);
+    ASSERT_TRUE(irr);
+    EXPECT_EQ(*irr, InternalRateOfReturnPolicy::calculate(kCashFlows, 0.1));
+
+    const BondTerms bond{1000.0, 0.05, 10, 2};
+    Calculator<BondPricingPolicy, StatusErrorPolicy> bond_status;
+    EXPECT_EQ(*bond_status.calculate(bond, 0.04), BondPricingPolicy::calculate(bond, 0.04));
+    const Expected<double> ytm = BondPricingPolicy::evaluate_yield(bond, 950.0);
+    ASSERT_TRUE(ytm);
+    EXPECT_EQ(*ytm, BondPricingPolicy::yield_to_maturity(bond, 950.0));
+
+    Calculator<XnpvPolicy<Actual360>, StatusErrorPolicy> xnpv_status;
+    EXPECT_EQ(*xnpv_status.calculate(0.05, kDates, kCashFlows),
+              XnpvPolicy<Actual360>::calculate(0.05, kDates, kCashFlows));
+
+    Calculator<RunLengthPresentValuePolicy, StatusErrorPolicy> runs_status;
+    EXPECT_EQ(*runs_status.calculate(0.04, kRuns), RunLengthPresentValuePolicy::calculate(0.04, kRuns));
+
+    const YieldCurve curve(kPillarTimes, kPillarRates);
+    Calculator<CurvePresentValuePolicy, StatusErrorPolicy> curve_status;
+    EXPECT_EQ(*curve_status.calculate(curve, kTimes, kCashFlows),
+              CurvePresentValuePolicy::calculate(curve, kTimes, kCashFlows));
+}
+
+TEST(ErrorPoliciesTest, StatusErrorsCarryTheThrownMessage) {
+    Calculator<PresentValuePolicy, StatusErrorPolicy> pv_status;
+    const Expected<double> bad_rate = pv_status.calculate(-1.0, kCashFlows);
+    EXPECT_EQ(bad_rate.error(), CalcError::DiscountRate);
+    EXPECT_EQ(error_message(bad_rate.error()),
+              thrown_message([] { PresentValuePolicy::calculate(-1.0, kCashFlows); }));
+    EXPECT_EQ(pv_status.calculate(0.05, kEmpty).error(), CalcError::EmptyCashFlows);
+
+    Calculator<FutureValuePolicy, StatusErrorPolicy> fv_status;
+    EXPECT_EQ(fv_status.calculate(-1.0, 0.05, 10).error(), CalcError::Principal);
+    EXPECT_EQ(fv_status.calculate(100.0, -1.5, 10).error(), CalcError::InterestRate);
+    EXPECT_EQ(fv_status.calculate(100.0, 0.05, -1).error(), CalcError::Periods);
+    EXPECT_EQ(error_message(CalcError::Periods),
+              thrown_message([] { FutureValuePolicy::calculate(100.0, 0.05, -1); }));
+    EXPECT_STREQ(SimdFutureValuePolicy::check(100.0, 0.05, -1), error_message(CalcError::Periods));
+
+    Calculator<InterestRateConversionPolicy, StatusErrorPolicy> ir_status;
+    EXPECT_EQ(ir_status.calculate(-2.0, 12).error(), CalcError::NominalRate);
+    EXPECT_EQ(ir_status.calculate(0.05, 0).error(), CalcError::CompoundingPeriods);
+    EXPECT_EQ(error_message(CalcError::CompoundingPeriods),
+              thrown_message([] { InterestRateConversionPolicy::calculate(0.05, 0); }));
+
+    Calculator<InternalRateOfReturnPolicy, StatusErrorPolicy> irr_status;
+    const std::vector<double> all_positive = {1.0, 2.0};
+    EXPECT_EQ(irr_status.calculate(kEmpty, 0.1).error(), CalcError::EmptyCashFlows);
+    EXPECT_EQ(irr_status.calculate(all_positive, 0.1).error(), CalcError::SignChange);
+    EXPECT_EQ(irr_status.calculate(kCashFlows, -1.0).error(), CalcError::Guess);
+    EXPECT_EQ(error_message(CalcError::SignChange),
+              thrown_message([&] { InternalRateOfReturnPolicy::calculate(all_positive); }));
+    const std::vector<double> no_root = {1.0, -1.0, 1.0};  // PV > 0 for every rate
+    EXPECT_EQ(irr_status.calculate(no_root, 0.1).error(), CalcError::IrrNotFound);
+    try {
+        InternalRateOfReturnPolicy::calculate(no_root);
+        FAIL() << "expected std::domain_error";
+    } catch (const std::domain_error& e) {
+        EXPECT_STREQ(e.what(), error_message(CalcError::IrrNotFound));
+    }
+
+    Calculator<BondPricingPolicy, StatusErrorPolicy> bond_status;
+    EXPECT_EQ(bond_status.calculate(BondTerms{0.0, 0.05, 10, 2}, 0.04).error(), CalcError::Face);
+    EXPECT_EQ(bond_status.calculate(BondTerms{100.0, -0.05, 10, 2}, 0.04).error(), CalcError::CouponRate);
+    EXPECT_EQ(bond_status.calculate(BondTerms{100.0, 0.05, 0, 2}, 0.04).error(), CalcError::BondPeriods);
+    EXPECT_EQ(bond_status.calculate(BondTerms{100.0, 0.05, 10, 0}, 0.04).error(), CalcError::Frequency);
+    EXPECT_EQ(bond_status.calculate(BondTerms{100.0, 0.05, 10, 2}, -2.0).error(), CalcError::Yield);
+    EXPECT_EQ(BondPricingPolicy::validate_price(BondTerms{100.0, 0.05, 10, 2}, 0.0), CalcError::Price);
+    EXPECT_EQ(error_message(CalcError::Yield),
+              thrown_message([] { BondPricingPolicy::analytics(BondTerms{100.0, 0.05, 10, 2}, -2.0); }));
+
+    Calculator<XnpvPolicy<>, StatusErrorPolicy> xnpv_status;
+    const std::vector<std::int64_t> short_dates = {0, 90};
+    EXPECT_EQ(xnpv_status.calculate(0.05, short_dates, kCashFlows).error(), CalcError::DateCount);
+    EXPECT_EQ(xnpv_status.calculate(-1.0, kDates, kCashFlows).error(), CalcError::DiscountRate);
+    EXPECT_EQ(error_message(CalcError::DateCount),
+              thrown_message([&] { XnpvPolicy<>::calculate(0.05, short_dates, kCashFlows); }));
+
+    Calculator<RunLengthPresentValuePolicy, StatusErrorPolicy> runs_status;
+    const std::vector<CashFlowRun> zero_length = {{50.0, 0}};
+    EXPECT_EQ(runs_status.calculate(-1.0, kRuns).error(), CalcError::DiscountRate);
+    EXPECT_EQ(runs_status.calculate(0.04, zero_length).error(), CalcError::EmptyCashFlows);
+    EXPECT_EQ(error_message(CalcError::EmptyCashFlows),
+              thrown_message([&] { RunLengthPresentValuePolicy::calculate(0.04, zero_length); }));
+
+    const YieldCurve curve(kPillarTimes, kPillarRates);
+    Calculator<CurvePresentValuePolicy, StatusErrorPolicy> curve_status;
+    const std::vector<double> short_times = {1.0, 2.0};
+    const std::vector<double> negative_times = {0.5, 1.0, -2.0, 3.5, 5.0};
+    EXPECT_EQ(curve_status.calculate(curve, kTimes, kEmpty).error(), CalcError::EmptyCashFlows);
+    EXPECT_EQ(curve_status.calculate(curve, short_times, kCashFlows).error(), CalcError::DateCount);
+    EXPECT_EQ(curve_status.calculate(curve, negative_times, kCashFlows).error(), CalcError::NegativeTime);
+    EXPECT_EQ(error_message(CalcError::NegativeTime),
+              thrown_message([&] { CurvePresentValuePolicy::calculate(curve, negative_times, kCashFlows); }));
+}
+
+TEST(ErrorPoliciesTest, ThrowingPolicyIsTheDefault) {
+    static_assert(std::is_same_v<Calculator<PresentValuePolicy>,
+                                 Calculator<PresentValuePolicy, ThrowingErrorPolicy>>);
+    static_assert(std::is_same_v<decltype(Calculator<FutureValuePolicy>{}.calculate(1.0, 0.05, 1)), double>);
+
+    Calculator<PresentValuePolicy> pv_calc;
+    EXPECT_THROW(pv_calc.calculate(-1.0, kCashFlows), std::invalid_argument);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
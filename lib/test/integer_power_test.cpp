@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include "../include/CalculationPolicies.hpp"
+#include "../include/IntegerPower.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+// Distance in representable doubles (both finite, same sign)
+std::int64_t ulp_distance(double a, double b) {
+    std::int64_t ia = 0;
+    std::int64_t ib = 0;
+    std::memcpy(&ia, &a, sizeof a);
+    std::memcpy(&ib, &b, sizeof b);
+    return ia > ib ? ia - ib : ib - ia;
+}
+
+double base_for(unsigned i) {
+    return 0.98 + 0.32 * static_cast<double>((i * 2654435761u) % 4096) / 4096.0;
+}
+
+} // namespace
+
+// ===========================================================================
+// Constant Evaluation
+// ===========================================================================
+
+static_assert(integer_power(2.0, 10) == 1024.0);
+static_assert(integer_power(1.5, 0) == 1.0);
+static_assert(integer_power(-2.0, 3) == -8.0);
+static_assert(integer_power(0.5, 1074) == 0x1p-1074);
+static_assert(scaled_integer_power(3.0, 0.5, 4) == 0.1875);
+static_assert(integer_power_minus_one(1.5, 2) == 1.25);
+static_assert(integer_power<FmaProducts>(1.25, 3) == 1.953125);
+
+TEST(IntegerPowerTest, ConstantEvaluationMatchesRuntime) {
+    constexpr double monthly = integer_power(1.0 + 0.05 / 12.0, 12);
+    volatile double base = 1.0 + 0.05 / 12.0;
+    EXPECT_LE(ulp_distance(monthly, integer_power(base, 12)), 1);
+}
+
+// ===========================================================================
+// Accuracy vs. std::pow
+// Both are within ~0.5 ulp of the exact power, so they may differ by 1 ulp
+// ===========================================================================
+
+template <typename Products>
+void expect_within_one_ulp_of_pow(unsigned max_n) {
+    for (unsigned n = 0; n <= max_n; ++n) {
+        for (unsigned i = 0; i < 8; ++i) {
+            const double x = base_for(n * 8 + i);
+            const double expected = std::pow(x, static_cast<double>(n));
+            if (!std::isfinite(expected) || expected < 1e-300) {
+                continue;
+            }
+            ASSERT_LE(ulp_distance(integer_power<Products>(x, n), expected), 1)
+                << "x = " << x << ", n = " << n;
+        }
+    }
+}
+
+TEST(IntegerPowerTest, FmaProductsWithinOneUlpOfPowUpTo10000) {
+    expect_within_one_ulp_of_pow<FmaProducts>(10000);
+}
+
+TEST(IntegerPowerTest, SplitProductsWithinOneUlpOfPowUpTo10000) {
+    expect_within_one_ulp_of_pow<SplitProducts>(10000);
+}
+
+TEST(IntegerPowerTest, HugeExponentsNearOne) {
+    // Exercise every exponent bit, including the renormalized squares
+    for (const unsigned n : {65535u, 65536u, 1u << 20, 2147483647u}) {
+        const double x = 1.0 + 1e-10;
+        EXPECT_LE(ulp_distance(integer_power(x, n), std::pow(x, static_cast<double>(n))), 1) << n;
+    }
+}
+
+// ===========================================================================
+// Scaled Power and x^n - 1
+// ===========================================================================
+
+TEST(IntegerPowerTest, ScaledPowerMatchesPow) {
+    for (unsigned n = 0; n <= 400; ++n) {
+        const double x = base_for(n);
+        const double expected = 1234.5 * std::pow(x, static_cast<double>(n));
+        // pow's 0.5 ulp plus the rounding of the product
+        EXPECT_LE(ulp_distance(scaled_integer_power(1234.5, x, n), expected), 2) << n;
+    }
+}
+
+TEST(IntegerPowerTest, MinusOneKeepsLowOrderDigits) {
+    // (1 + h)^12 - 1 = 12h + 66h² + 220h³ + ... for the h actually stored
+    const double x = 1.0 + 1e-10;
+    const long double h = static_cast<long double>(x) - 1.0L;
+    const long double exact = 12.0L * h + 66.0L * h * h + 220.0L * h * h * h;
+
+    const double ear = integer_power_minus_one(x, 12);
+    EXPECT_LT(std::fabs(static_cast<long double>(ear) - exact) / exact, 4.0L * 0x1p-53L);
+}
+
+// ===========================================================================
+// Special Values
+// ===========================================================================
+
+TEST(IntegerPowerTest, OverflowIsSignedInfinity) {
+    EXPECT_EQ(integer_power(10.0, 400), HUGE_VAL);
+    EXPECT_EQ(integer_power(-10.0, 401), -HUGE_VAL);
+    EXPECT_EQ(integer_power(-10.0, 400), HUGE_VAL);
+    EXPECT_EQ(integer_power<SplitProducts>(1.5, 2000), HUGE_VAL);
+    EXPECT_EQ(scaled_integer_power(2.0, 1e200, 2), HUGE_VAL);
+    EXPECT_EQ(scaled_integer_power(1e300, 10.0, 9), HUGE_VAL);
+    EXPECT_EQ(integer_power_minus_one(1.5, 2000), HUGE_VAL);
+}
+
+TEST(IntegerPowerTest, NearOverflowStaysFinite) {
+    // Squares above 2^995 take SplitProducts' pre-scaled path
+    const double x = 0x1.0000000000001p+1;
+    for (const unsigned n : {1000u, 1020u, 1023u}) {
+        const double expected = std::pow(x, static_cast<double>(n));
+        EXPECT_LE(ulp_distance(integer_power<SplitProducts>(x, n), expected), 1) << n;
+        EXPECT_LE(ulp_distance(integer_power<FmaProducts>(x, n), expected), 1) << n;
+    }
+}
+
+TEST(IntegerPowerTest, UnderflowAndNaN) {
+    EXPECT_EQ(integer_power(0.5, 2000), 0.0);
+    EXPECT_TRUE(std::isnan(integer_power(std::nan(""), 3)));
+    EXPECT_EQ(integer_power(std::nan(""), 0), 1.0);
+}
+
+// ===========================================================================
+// Policies
+// ===========================================================================
+
+TEST(IntegerPowerTest, PoliciesUseEngineOnFastPathOnly) {
+    for (const int n : {1, 2, 3, 4, 7, 12, 127, 128, 360, 10000}) {
+        const unsigned u = static_cast<unsigned>(n);
+        const double fv = FutureValuePolicy::calculate(1000.0, 0.004, n);
+        const double ear = InterestRateConversionPolicy::calculate(0.12, n);
+        if (n > 1 && integer_power_fast_path(u)) {
+            EXPECT_EQ(fv, scaled_integer_power(1000.0, 1.004, u)) << n;
+            EXPECT_EQ(ear, integer_power_minus_one(1.0 + 0.12 / n, u)) << n;
+        } else if (!integer_power_fast_path(u)) {
+            EXPECT_EQ(fv, 1000.0 * std::pow(1.004, static_cast<double>(n))) << n;
+            EXPECT_EQ(ear, std::pow(1.0 + 0.12 / n, static_cast<double>(n)) - 1.0) << n;
+        }
+    }
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
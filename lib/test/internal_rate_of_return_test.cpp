@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/InternalRateOfReturn.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+IrrSolution solve(const std::vector<double>& cash_flows, double guess) {
+    return InternalRateOfReturnPolicy::solve(cash_flows.data(), cash_flows.size(), guess);
+}
+
+// Level-payment loan seen by the lender: advance, then n payments
+std::vector<double> loan(double principal, double periodic_rate, std::size_t n) {
+    const double payment = principal * periodic_rate / (1.0 - std::pow(1.0 + periodic_rate, -static_cast<double>(n)));
+    std::vector<double> cf(n + 1, payment);
+    cf[0] = -principal;
+    return cf;
+}
+
+} // namespace
+
+// ===========================================================================
+// Fused Evaluation
+// ===========================================================================
+
+TEST(InternalRateOfReturnTest, EvaluateMatchesPresentValueAndDerivatives) {
+    const std::vector<double> cf = {-1000.0, 300.0, 400.0, 500.0, 60.0, -20.0, 75.0};
+    for (const double r : {-0.5, -0.05, 0.0, 0.07, 0.4, 3.0}) {
+        const auto e = InternalRateOfReturnPolicy::evaluate_pv(r, cf.data(), cf.size());
+        EXPECT_NEAR(e.pv, PresentValuePolicy::calculate(r, cf), 1e-10 * std::fabs(e.pv) + 1e-10) << r;
+
+        // Analytic derivatives of Σ CF_t (1 + r)^-(t+1)
+        double dpv = 0.0;
+        double d2pv = 0.0;
+        for (std::size_t t = 0; t < cf.size(); ++t) {
+            const double k = static_cast<double>(t) + 1.0;
+            dpv -= k * cf[t] * std::pow(1.0 + r, -k - 1.0);
+            d2pv += k * (k + 1.0) * cf[t] * std::pow(1.0 + r, -k - 2.0);
+        }
+        EXPECT_NEAR(e.dpv, dpv, 1e-10 * std::fabs(dpv)) << r;
+        EXPECT_NEAR(e.d2pv, d2pv, 1e-10 * std::fabs(d2pv)) << r;
+    }
+}
+
+// ===========================================================================
+// Solver Tests
+// ===========================================================================
+
+TEST(InternalRateOfReturnTest, KnownRates) {
+    EXPECT_NEAR(InternalRateOfReturnPolicy::calculate(std::vector<double>{-100.0, 110.0}), 0.1, 1e-14);
+    // Excel IRR example: -70000, 12000, 15000, 18000, 21000, 26000 → 8.663%
+    EXPECT_NEAR(InternalRateOfReturnPolicy::calculate(
+                    std::vector<double>{-70000.0, 12000.0, 15000.0, 18000.0, 21000.0, 26000.0}),
+                0.086630948036531, 1e-12);
+
+    Calculator<InternalRateOfReturnPolicy> irr_calc;
+    const std::vector<double> mortgage = loan(250000.0, 0.045 / 12.0, 360);
+    EXPECT_NEAR(irr_calc.calculate(mortgage, 0.01), 0.045 / 12.0, 1e-13);
+}
+
+TEST(InternalRateOfReturnTest, RootHasZeroPresentValue) {
+    const std::vector<std::vector<double>> streams = {
+        {-1000.0, 300.0, 400.0, 500.0},
+        {-100.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1e6},  // ~178% a period
+        {-1.0, 0.01, 0.01, 0.01, 0.01},                         // deep negative IRR
+        {1000.0, -10.0, -10.0, -10.0},                          // borrower's view
+    };
+    for (const auto& cf : streams) {
+        const double r = InternalRateOfReturnPolicy::calculate(cf);
+        double scale = 0.0;
+        for (double x : cf) {
+            scale += std::fabs(x);
+        }
+        EXPECT_GT(r, -1.0);
+        EXPECT_LT(std::fabs(PresentValuePolicy::calculate(r, cf)), 1e-12 * scale) << r;
+    }
+}
+
+TEST(InternalRateOfReturnTest, WarmStartConvergesInFewerSteps) {
+    const std::vector<double> cf = loan(1e6, 0.0061, 240);
+    const IrrSolution cold = solve(cf, InternalRateOfReturnPolicy::kDefaultGuess);
+    const IrrSolution warm = solve(cf, 0.0060);
+    EXPECT_NEAR(warm.rate, cold.rate, 1e-15);
+    EXPECT_LE(warm.iterations, 3);
+    EXPECT_LT(warm.iterations, cold.iterations);
+}
+
+TEST(InternalRateOfReturnTest, FarGuessesFallBackToBracket) {
+    const std::vector<double> cf = {-1000.0, 300.0, 400.0, 500.0};
+    const double expected = solve(cf, 0.1).rate;
+    for (const double guess : {-0.95, 4.0, 1e3}) {
+        EXPECT_NEAR(solve(cf, guess).rate, expected, 1e-13) << guess;
+    }
+}
+
+TEST(InternalRateOfReturnTest, MultipleRootsFollowTheGuess) {
+    // PV = v (100 - 230 v + 132 v²): IRRs of 10% and 20%
+    const std::vector<double> cf = {100.0, -230.0, 132.0};
+    EXPECT_NEAR(solve(cf, 0.05).rate, 0.1, 1e-13);
+    EXPECT_NEAR(solve(cf, 0.3).rate, 0.2, 1e-13);
+    EXPECT_NEAR(solve(cf, 5.0).rate, 0.2, 1e-13);
+}
+
+TEST(InternalRateOfReturnTest, InvalidInputs) {
+    const std::vector<double> empty;
+    const std::vector<double> all_positive = {1.0, 2.0};
+    const std::vector<double> no_root = {1.0, -1.0, 1.0};  // PV > 0 for every rate
+    EXPECT_THROW(InternalRateOfReturnPolicy::calculate(empty), std::invalid_argument);
+    EXPECT_THROW(InternalRateOfReturnPolicy::calculate(all_positive), std::invalid_argument);
+    EXPECT_THROW(InternalRateOfReturnPolicy::calculate(std::vector<double>{-1.0, 2.0}, -1.0),
+                 std::invalid_argument);
+    EXPECT_THROW(InternalRateOfReturnPolicy::calculate(no_root), std::domain_error);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
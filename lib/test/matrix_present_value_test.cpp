@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/MatrixPresentValue.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+const simd::Isa kAllIsas[] = {
+    simd::Isa::Scalar,
+    simd::Isa::SSE2,
+    simd::Isa::AVX2,
+    simd::Isa::AVX512,
+};
+
+// rows × cols matrix with row stride `stride`; padding holds NaN so any
+// read of it shows up in the results
+struct Matrix {
+    std::vector<double> values;
+    ConstMatrixView view;
+
+    Matrix(std::size_t rows, std::size_t cols, std::size_t stride, double seed)
+        : values(rows * stride, std::nan("")), view{nullptr, rows, cols, stride} {
+        for (std::size_t r = 0; r < rows; ++r) {
+            for (std::size_t t = 0; t < cols; ++t) {
+                const double x = static_cast<double>((r * 131 + t * 17) % 97);
+                values[r * stride + t] = seed * (x - 40.0) / (1.0 + 0.001 * static_cast<double>(t));
+            }
+        }
+        view.data = values.data();
+    }
+};
+
+} // namespace
+
+// ===========================================================================
+// Kernel Tests (every ISA this CPU supports)
+// ===========================================================================
+
+TEST(MatrixPresentValueTest, AllPathsMatchReferenceAcrossTileAndBlockEdges) {
+    // Streams / curves straddle the 4 × 4 and 4 × 2 tiles and the curve
+    // block; periods the vector widths and the period block
+    for (std::size_t m : {1u, 3u, 4u, 5u, 9u}) {
+        for (std::size_t n : {1u, 2u, 3u, 5u, 65u}) {
+            for (std::size_t k : {1u, 7u, 8u, 9u, 255u, 256u, 257u, 600u}) {
+                const Matrix cf(m, k, k, 1.0);
+                const Matrix df(n, k, k, 0.01);
+
+                for (simd::Isa isa : kAllIsas) {
+                    if (!simd::isa_supported(isa)) {
+                        continue;
+                    }
+                    std::vector<double> out(m * n);
+                    simd::present_value_matrix(isa, cf.view, df.view, out.data(), n);
+
+                    for (std::size_t s = 0; s < m; ++s) {
+                        for (std::size_t c = 0; c < n; ++c) {
+                            long double exact = 0.0L;
+                            double mass = 0.0;
+                            for (std::size_t t = 0; t < k; ++t) {
+                                const double p = cf.values[s * k + t] * df.values[c * k + t];
+                                exact += static_cast<long double>(cf.values[s * k + t])
+                                       * static_cast<long double>(df.values[c * k + t]);
+                                mass += std::fabs(p);
+                            }
+                            const double bound = 2.0 * static_cast<double>(k) * std::ldexp(1.0, -53) * mass;
+                            ASSERT_NEAR(out[s * n + c], static_cast<double>(exact), bound)
+                                << "isa=" << simd::isa_name(isa) << " m=" << m << " n=" << n
+                                << " k=" << k << " s=" << s << " c=" << c;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(MatrixPresentValueTest, PaddedRowsGiveIdenticalResults) {
+    const std::size_t m = 11, n = 6, k = 45;
+    const Matrix dense_cf(m, k, k, 1.0);
+    const Matrix dense_df(n, k, k, 0.02);
+    const Matrix padded_cf(m, k, padded_stride(k) + 8, 1.0);
+    const Matrix padded_df(n, k, padded_stride(k), 0.02);
+
+    for (simd::Isa isa : kAllIsas) {
+        if (!simd::isa_supported(isa)) {
+            continue;
+        }
+        std::vector<double> dense(m * n), padded(m * n);
+        simd::present_value_matrix(isa, dense_cf.view, dense_df.view, dense.data(), n);
+        simd::present_value_matrix(isa, padded_cf.view, padded_df.view, padded.data(), n);
+        ASSERT_EQ(padded, dense) << "isa=" << simd::isa_name(isa);
+    }
+}
+
+// ===========================================================================
+// MatrixPresentValuePolicy Tests
+// ===========================================================================
+
+TEST(MatrixPresentValuePolicyTest, FlatCurveMatchesPresentValuePolicy) {
+    const std::vector<double> bond = {50.0, 50.0, 50.0, 1050.0};
+    const std::vector<double> annuity = {100.0, 100.0, 100.0, 100.0};
+    std::vector<double> flows = bond;
+    flows.insert(flows.end(), annuity.begin(), annuity.end());
+
+    std::vector<double> curves = MatrixPresentValuePolicy::discount_factors(0.05, 4);
+    const std::vector<double> second = MatrixPresentValuePolicy::discount_factors(0.08, 4);
+    curves.insert(curves.end(), second.begin(), second.end());
+
+    Calculator<MatrixPresentValuePolicy> calc;
+    std::vector<double> pv(4);
+    calc.calculate_matrix(ConstMatrixView{flows.data(), 2, 4, 4}, ConstMatrixView{curves.data(), 2, 4, 4}, pv);
+
+    EXPECT_NEAR(pv[0], PresentValuePolicy::calculate(0.05, bond), 1e-10);
+    EXPECT_NEAR(pv[1], PresentValuePolicy::calculate(0.08, bond), 1e-10);
+    EXPECT_NEAR(pv[2], PresentValuePolicy::calculate(0.05, annuity), 1e-10);
+    EXPECT_NEAR(pv[3], PresentValuePolicy::calculate(0.08, annuity), 1e-10);
+}
+
+TEST(MatrixPresentValuePolicyTest, InvalidShapes) {
+    const std::vector<double> data(12, 1.0);
+    std::vector<double> out(4);
+
+    EXPECT_THROW(MatrixPresentValuePolicy::calculate_matrix(
+        ConstMatrixView{data.data(), 2, 3, 3}, ConstMatrixView{data.data(), 2, 4, 4}, out),
+        std::invalid_argument);
+    EXPECT_THROW(MatrixPresentValuePolicy::calculate_matrix(
+        ConstMatrixView{data.data(), 2, 3, 2}, ConstMatrixView{data.data(), 2, 3, 3}, out),
+        std::invalid_argument);
+    EXPECT_THROW(MatrixPresentValuePolicy::calculate_matrix(
+        ConstMatrixView{data.data(), 2, 0, 0}, ConstMatrixView{data.data(), 2, 0, 0}, out),
+        std::invalid_argument);
+    EXPECT_THROW(MatrixPresentValuePolicy::calculate_matrix(
+        ConstMatrixView{data.data(), 2, 3, 3}, ConstMatrixView{data.data(), 3, 3, 3}, out),
+        std::invalid_argument);
+    EXPECT_THROW(MatrixPresentValuePolicy::calculate_matrix(
+        ConstMatrixView{nullptr, 2, 3, 3}, ConstMatrixView{data.data(), 2, 3, 3}, out),
+        std::invalid_argument);
+    EXPECT_THROW(MatrixPresentValuePolicy::discount_factors(-1.0, 3), std::invalid_argument);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/SimdKernels.hpp"
+#include "../include/ParallelPresentValuePolicy.hpp"
+#include "test_streams.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+constexpr std::size_t kChunk = ParallelPresentValuePolicy::kChunkPeriods;
+
+} // namespace
+
+// ===========================================================================
+// ParallelPresentValuePolicy Tests
+// ===========================================================================
+
+TEST(ParallelPresentValueTest, SingleChunkMatchesSimdPolicy) {
+    for (std::size_t n : {1u, 65u, 1000u, static_cast<unsigned>(kChunk)}) {
+        const std::vector<double> cf = make_mixed_stream(n);
+        ASSERT_EQ(ParallelPresentValuePolicy::calculate(0.004, cf),
+                  SimdPresentValuePolicy::calculate(0.004, cf)) << "n=" << n;
+        ASSERT_EQ(ReproducibleParallelPresentValuePolicy::calculate(0.004, cf),
+                  ReproducibleSimdPresentValuePolicy::calculate(0.004, cf)) << "n=" << n;
+    }
+}
+
+TEST(ParallelPresentValueTest, MultiChunkMatchesPowPathWithinBound) {
+    // Chunk boundary plus a ragged last chunk
+    const std::vector<double> cf = make_mixed_stream(5 * kChunk + 4321);
+    const double base = 1.00001;
+    const double expected = PresentValuePolicy::calculate(base - 1.0, cf);
+    const double bound = (128.0 + 2.0 * static_cast<double>(cf.size())) * std::ldexp(1.0, -53)
+                       * discounted_mass(base, cf);
+
+    ASSERT_NEAR(ParallelPresentValuePolicy::calculate(base - 1.0, cf), expected, bound);
+    ASSERT_NEAR(ReproducibleParallelPresentValuePolicy::calculate(base - 1.0, cf), expected, bound);
+}
+
+TEST(ParallelPresentValueTest, ResultIndependentOfThreadCount) {
+    const std::vector<double> cf = make_mixed_stream(9 * kChunk + 17);
+
+    const double one = ParallelPresentValuePolicy::calculate(0.0001, cf, 1);
+    const double reproducible_one = ReproducibleParallelPresentValuePolicy::calculate(0.0001, cf, 1);
+    for (std::size_t threads : {2u, 3u, 8u, 0u}) {
+        ASSERT_EQ(ParallelPresentValuePolicy::calculate(0.0001, cf, threads), one)
+            << "threads=" << threads;
+        ASSERT_EQ(ReproducibleParallelPresentValuePolicy::calculate(0.0001, cf, threads),
+                  reproducible_one) << "threads=" << threads;
+    }
+}
+
+TEST(ParallelPresentValueTest, WorksThroughCalculator) {
+    Calculator<ParallelPresentValuePolicy> calc;
+    const std::vector<double> cf(3 * kChunk, 1.0);
+    const double r = 0.0002;
+
+    // Level annuity: (1 - (1 + r)^-n) / r
+    const double expected = (1.0 - std::pow(1.0 + r, -static_cast<double>(cf.size()))) / r;
+    ASSERT_NEAR(calc.calculate(r, cf), expected, 1e-9 * expected);
+    ASSERT_NEAR(calc.calculate(0.05, {100.0}), 100.0 / 1.05, 1e-12);
+}
+
+TEST(ParallelPresentValueTest, InvalidInputsThrow) {
+    const std::vector<double> cf(10, 1.0);
+    ASSERT_THROW(ParallelPresentValuePolicy::calculate(-1.0, cf), std::invalid_argument);
+    ASSERT_THROW(ParallelPresentValuePolicy::calculate(0.05, std::span<const double>()),
+                 std::invalid_argument);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/ErrorPolicies.hpp"
+#include "../include/PrecisionPolicies.hpp"
+#include "../include/SimdKernels.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+// Monthly scenario flows, exact in float
+std::vector<double> make_scenario(std::size_t n) {
+    std::vector<double> cf(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        cf[i] = (i % 12 == 11) ? -250.5 : 100.0 + static_cast<double>(i % 7) * 12.25;
+    }
+    return cf;
+}
+
+template <typename Real>
+std::vector<Real> convert(const std::vector<double>& cf) {
+    return std::vector<Real>(cf.begin(), cf.end());
+}
+
+} // namespace
+
+// ===========================================================================
+// Present Value
+// ===========================================================================
+
+TEST(PrecisionPoliciesTest, FloatPresentValueKeepsSixDigits) {
+    const std::vector<double> cf = make_scenario(360);
+    const std::vector<float> cf32 = convert<float>(cf);
+
+    Calculator<PrecisionPresentValuePolicy<float>> pv32;
+    const float pv = pv32.calculate(0.004f, cf32);
+    static_assert(std::is_same_v<decltype(pv32.calculate(0.004f, cf32)), float>);
+
+    const double expected = PresentValuePolicy::calculate(static_cast<double>(0.004f), cf);
+    EXPECT_NEAR(pv, expected, 1e-6 * std::fabs(expected));
+}
+
+TEST(PrecisionPoliciesTest, MixedPresentValueIsTheDoubleKernelOnWidenedFlows) {
+    const std::vector<double> cf = make_scenario(1001);
+    const std::vector<float> cf32 = convert<float>(cf);
+
+    Calculator<MixedPrecisionPresentValuePolicy> mixed;
+    EXPECT_EQ(mixed.calculate(0.05, cf32), SimdPresentValuePolicy::calculate(0.05, cf));
+}
+
+TEST(PrecisionPoliciesTest, DoubleInstantiationsMatchDefaultPolicies) {
+    const std::vector<double> cf = make_scenario(100);
+    EXPECT_EQ(PrecisionPresentValuePolicy<double>::calculate(0.05, cf), SimdPresentValuePolicy::calculate(0.05, cf));
+    EXPECT_EQ(PrecisionFutureValuePolicy<double>::calculate(1000.0, 0.05, 30),
+              FutureValuePolicy::calculate(1000.0, 0.05, 30));
+    EXPECT_EQ(PrecisionInterestRateConversionPolicy<double>::calculate(0.12, 12),
+              InterestRateConversionPolicy::calculate(0.12, 12));
+}
+
+TEST(PrecisionPoliciesTest, LongDoubleAgreesWithDouble) {
+    const std::vector<double> cf = make_scenario(360);
+    const std::vector<long double> cf80 = convert<long double>(cf);
+
+    Calculator<PrecisionPresentValuePolicy<long double>> pv80;
+    const long double pv = pv80.calculate(0.004L, cf80);
+    const double expected = PresentValuePolicy::calculate(0.004, cf);
+    EXPECT_NEAR(static_cast<double>(pv), expected, 1e-12 * std::fabs(expected));
+}
+
+// ===========================================================================
+// Future Value and Rate Conversion
+// ===========================================================================
+
+TEST(PrecisionPoliciesTest, FloatFutureValueAndRatesRoundTheDoubleResultOnce) {
+    Calculator<PrecisionFutureValuePolicy<float>> fv32;
+    EXPECT_EQ(fv32.calculate(1000.0f, 0.05f, 10),
+              static_cast<float>(FutureValuePolicy::calculate(1000.0, static_cast<double>(0.05f), 10)));
+
+    Calculator<PrecisionInterestRateConversionPolicy<float>> ir32;
+    EXPECT_EQ(ir32.calculate(0.12f, 12),
+              static_cast<float>(InterestRateConversionPolicy::calculate(static_cast<double>(0.12f), 12)));
+    EXPECT_EQ(ir32.calculate(0.12f, 1), 0.12f);
+}
+
+TEST(PrecisionPoliciesTest, LongDoubleFutureValueAndRates) {
+    Calculator<PrecisionFutureValuePolicy<long double>> fv80;
+    EXPECT_NEAR(static_cast<double>(fv80.calculate(1000.0L, 0.05L, 10)), 1628.894626777442, 1e-9);
+
+    Calculator<PrecisionInterestRateConversionPolicy<long double>> ir80;
+    EXPECT_NEAR(static_cast<double>(ir80.calculate(0.12L, 12)), 0.12682503013196977, 1e-15);
+    // (1 + r/n)^n - 1 ≈ r + (n - 1)/(2n)·r² for tiny r: the square survives
+    EXPECT_NEAR(static_cast<double>(ir80.calculate(1e-10L, 365)), 1e-10 + 0.5 * (364.0 / 365.0) * 1e-20, 1e-26);
+}
+
+// ===========================================================================
+// Validation
+// ===========================================================================
+
+TEST(PrecisionPoliciesTest, InvalidInputsMatchDoublePolicies) {
+    const std::vector<float> cf32 = {100.0f, 200.0f};
+    const std::vector<float> empty;
+
+    Calculator<PrecisionPresentValuePolicy<float>> pv32;
+    EXPECT_THROW(pv32.calculate(-1.0f, cf32), std::invalid_argument);
+    EXPECT_THROW(pv32.calculate(0.05f, empty), std::invalid_argument);
+    EXPECT_THROW(Calculator<MixedPrecisionPresentValuePolicy>{}.calculate(0.05, empty), std::invalid_argument);
+    EXPECT_THROW(Calculator<PrecisionFutureValuePolicy<float>>{}.calculate(-1.0f, 0.05f, 10),
+                 std::invalid_argument);
+    EXPECT_THROW(Calculator<PrecisionInterestRateConversionPolicy<long double>>{}.calculate(0.05L, 0),
+                 std::invalid_argument);
+
+    Calculator<PrecisionPresentValuePolicy<float>, StatusErrorPolicy> status32;
+    const Expected<float> bad = status32.calculate(-2.0f, cf32);
+    EXPECT_EQ(bad.error(), CalcError::DiscountRate);
+    EXPECT_TRUE(status32.calculate(0.05f, cf32));
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
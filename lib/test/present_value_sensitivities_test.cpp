@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "../include/BondPricing.hpp"
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/PresentValueSensitivities.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+// Term-by-term sums in long double: Σ x, Σ k x, Σ k(k+1) x with x = CF_t / (1 + r)^k
+struct Reference {
+    double pv;
+    double first;
+    double second;
+    double scale;  // Σ |x| k(k+1), for tolerances
+};
+
+Reference reference(double rate, const std::vector<double>& cash_flows) {
+    long double pv = 0.0L;
+    long double first = 0.0L;
+    long double second = 0.0L;
+    long double scale = 0.0L;
+    for (std::size_t t = 0; t < cash_flows.size(); ++t) {
+        const long double k = static_cast<long double>(t) + 1.0L;
+        const long double x = cash_flows[t] * std::pow(1.0L + rate, -k);
+        pv += x;
+        first += k * x;
+        second += k * (k + 1.0L) * x;
+        scale += std::fabs(x) * k * (k + 1.0L);
+    }
+    return {static_cast<double>(pv), static_cast<double>(first), static_cast<double>(second),
+            static_cast<double>(scale)};
+}
+
+std::vector<double> mixed_stream(std::size_t n) {
+    std::vector<double> cash_flows(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        cash_flows[i] = (i % 5 == 0 ? -250.0 : 100.0) + static_cast<double>(i % 13);
+    }
+    return cash_flows;
+}
+
+// Lengths around the lane counts, the 2W unroll and the anchor interval
+const std::vector<std::size_t> kLengths = {1, 3, 7, 16, 17, 63, 64, 65, 130, 1000};
+const std::vector<double> kRates = {-0.2, 0.0, 0.004, 0.05, 0.8};
+
+constexpr simd::Isa kIsas[] = {simd::Isa::Scalar, simd::Isa::SSE2, simd::Isa::AVX2, simd::Isa::AVX512};
+
+} // namespace
+
+// ===========================================================================
+// Discounted Moment Kernels
+// ===========================================================================
+
+TEST(PresentValueSensitivitiesTest, KernelsMatchTermByTermSums) {
+    for (const simd::Isa isa : kIsas) {
+        if (!simd::isa_supported(isa)) {
+            continue;
+        }
+        for (const std::size_t n : kLengths) {
+            const std::vector<double> cash_flows = mixed_stream(n);
+            for (const double r : kRates) {
+                const Reference expected = reference(r, cash_flows);
+                const simd::DiscountedMoments m = simd::discounted_moments(isa, 1.0 + r, cash_flows.data(), n);
+                const double tolerance = 1e-13 * expected.scale;
+                EXPECT_NEAR(m.pv, expected.pv, tolerance) << simd::isa_name(isa) << " n=" << n << " r=" << r;
+                EXPECT_NEAR(m.first, expected.first, tolerance) << simd::isa_name(isa) << " n=" << n << " r=" << r;
+                EXPECT_NEAR(m.second, expected.second, tolerance) << simd::isa_name(isa) << " n=" << n << " r=" << r;
+            }
+        }
+    }
+}
+
+TEST(PresentValueSensitivitiesTest, ReproducibleUsesTheScalarKernel) {
+    const std::vector<double> cash_flows = mixed_stream(1000);
+    const simd::DiscountedMoments m = simd::discounted_moments(simd::Isa::Scalar, 1.004, cash_flows.data(), 1000);
+    const PvSensitivities expected = ReproducibleSensitivityPolicy::from_moments(1.004, m);
+    const PvSensitivities s = ReproducibleSensitivityPolicy::calculate(0.004, cash_flows);
+    EXPECT_EQ(s.pv, expected.pv);
+    EXPECT_EQ(s.dpv_dr, expected.dpv_dr);
+    EXPECT_EQ(s.d2pv_dr2, expected.d2pv_dr2);
+}
+
+// ===========================================================================
+// Sensitivities
+// ===========================================================================
+
+TEST(PresentValueSensitivitiesTest, DerivativesMatchBumpedPresentValues) {
+    const std::vector<double> cash_flows = mixed_stream(120);
+    const double r = 0.006;
+    const double h = 1e-5;
+    const double up = PresentValuePolicy::calculate(r + h, cash_flows);
+    const double mid = PresentValuePolicy::calculate(r, cash_flows);
+    const double down = PresentValuePolicy::calculate(r - h, cash_flows);
+
+    const PvSensitivities s = PresentValueSensitivityPolicy::calculate(r, cash_flows);
+    EXPECT_NEAR(s.pv, mid, 1e-12 * std::fabs(mid));
+    EXPECT_NEAR(s.dpv_dr, (up - down) / (2.0 * h), 1e-6 * std::fabs(s.dpv_dr));
+    EXPECT_NEAR(s.d2pv_dr2, (up - 2.0 * mid + down) / (h * h), 1e-4 * std::fabs(s.d2pv_dr2));
+}
+
+TEST(PresentValueSensitivitiesTest, DerivedRiskMatchesBondAnalytics) {
+    // Annual bond: rate per period = annual yield, so the units agree
+    const BondTerms bond{1000.0, 0.05, 30, 1};
+    std::vector<double> schedule(30, 50.0);
+    schedule[29] += 1000.0;
+
+    Calculator<PresentValueSensitivityPolicy> risk_calc;
+    const PvSensitivities s = risk_calc.calculate(0.045, schedule);
+    const BondPricingPolicy::Analytics a = BondPricingPolicy::analytics(bond, 0.045);
+    EXPECT_NEAR(s.pv, a.price, 1e-11 * a.price);
+    EXPECT_NEAR(s.modified_duration, a.modified_duration, 1e-11 * a.modified_duration);
+    EXPECT_NEAR(s.convexity, a.convexity, 1e-11 * a.convexity);
+    EXPECT_DOUBLE_EQ(s.dv01, -s.dpv_dr * 1e-4);
+    EXPECT_DOUBLE_EQ(s.modified_duration, -s.dpv_dr / s.pv);
+}
+
+TEST(PresentValueSensitivitiesTest, InvalidInputsThrow) {
+    const std::vector<double> empty;
+    const std::vector<double> one = {100.0};
+    EXPECT_THROW(PresentValueSensitivityPolicy::calculate(0.05, empty), std::invalid_argument);
+    EXPECT_THROW(PresentValueSensitivityPolicy::calculate(-1.0, one), std::invalid_argument);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
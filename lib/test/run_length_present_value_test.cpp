@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/RunLengthPresentValue.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+// Σ CF_t / (1 + r)^(t+1), one std::pow per period
+double pv_per_period(double rate, const std::vector<double>& cash_flows) {
+    double pv = 0.0;
+    for (std::size_t i = 0; i < cash_flows.size(); ++i) {
+        pv += cash_flows[i] / std::pow(1.0 + rate, static_cast<double>(i) + 1.0);
+    }
+    return pv;
+}
+
+std::vector<double> expand(const std::vector<CashFlowRun>& runs) {
+    std::vector<double> cash_flows;
+    for (const CashFlowRun& run : runs) {
+        cash_flows.insert(cash_flows.end(), run.count, run.value);
+    }
+    return cash_flows;
+}
+
+const std::vector<std::vector<CashFlowRun>> kSchedules = {
+    {{1342.05, 360}},                               // 30-year monthly annuity
+    {{50.0, 9}, {1050.0, 1}},                       // bullet bond
+    {{-1000.0, 1}, {0.0, 11}, {120.0, 24}, {150.0, 36}, {-75.5, 3}, {2000.0, 1}},  // step-up with gaps
+};
+
+const std::vector<double> kRates = {-0.3, -1e-9, 0.0, 1e-12, 0.004, 0.05, 2.0};
+
+} // namespace
+
+// ===========================================================================
+// Closed Form per Run
+// ===========================================================================
+
+TEST(RunLengthPresentValueTest, MatchesPerPeriodDiscounting) {
+    for (const auto& runs : kSchedules) {
+        const std::vector<double> cash_flows = expand(runs);
+        double scale = 0.0;
+        for (const double cf : cash_flows) {
+            scale += std::fabs(cf);
+        }
+        for (const double r : kRates) {
+            const double expected = pv_per_period(r, cash_flows);
+            const double tolerance = 1e-13 * scale * std::fmax(1.0, std::pow(1.0 + r, -static_cast<double>(cash_flows.size())));
+            EXPECT_NEAR(RunLengthPresentValuePolicy::calculate(r, runs), expected, tolerance)
+                << runs.size() << " runs at " << r;
+        }
+    }
+}
+
+TEST(RunLengthPresentValueTest, CalculatorWrapperAndEmptyRuns) {
+    Calculator<RunLengthPresentValuePolicy> calc;
+    const std::vector<CashFlowRun> annuity = {{100.0, 3}};
+    EXPECT_NEAR(calc.calculate(0.05, annuity), 272.3248, 1e-4);
+
+    // Zero-length runs contribute nothing
+    const std::vector<CashFlowRun> padded = {{7.0, 0}, {100.0, 3}, {9.0, 0}};
+    EXPECT_DOUBLE_EQ(calc.calculate(0.05, padded), calc.calculate(0.05, annuity));
+}
+
+TEST(RunLengthPresentValueTest, InvalidInputsThrow) {
+    const std::vector<CashFlowRun> none;
+    const std::vector<CashFlowRun> zero_length = {{100.0, 0}};
+    const std::vector<CashFlowRun> annuity = {{100.0, 3}};
+    EXPECT_THROW(RunLengthPresentValuePolicy::calculate(0.05, none), std::invalid_argument);
+    EXPECT_THROW(RunLengthPresentValuePolicy::calculate(0.05, zero_length), std::invalid_argument);
+    EXPECT_THROW(RunLengthPresentValuePolicy::calculate(-1.0, annuity), std::invalid_argument);
+}
+
+// ===========================================================================
+// Encoding and Detection
+// ===========================================================================
+
+TEST(RunLengthPresentValueTest, EncodeRoundTrips) {
+    for (const auto& runs : kSchedules) {
+        const std::vector<double> cash_flows = expand(runs);
+        const std::vector<CashFlowRun> encoded = RunLengthPresentValuePolicy::encode(cash_flows);
+        ASSERT_EQ(encoded.size(), runs.size());
+        for (std::size_t i = 0; i < runs.size(); ++i) {
+            EXPECT_EQ(encoded[i].value, runs[i].value);
+            EXPECT_EQ(encoded[i].count, runs[i].count);
+        }
+    }
+    EXPECT_TRUE(RunLengthPresentValuePolicy::encode(std::vector<double>{}).empty());
+}
+
+TEST(RunLengthPresentValueTest, DetectsLevelStreams) {
+    const std::vector<double> annuity(360, 1342.05);
+    EXPECT_TRUE(RunLengthPresentValuePolicy::worthwhile(annuity.data(), annuity.size()));
+    EXPECT_TRUE(RunLengthPresentValuePolicy::worthwhile(expand(kSchedules[1]).data(), 10));
+
+    std::vector<double> varying(360);
+    for (std::size_t i = 0; i < varying.size(); ++i) {
+        varying[i] = 100.0 + static_cast<double>(i % 17);
+    }
+    EXPECT_FALSE(RunLengthPresentValuePolicy::worthwhile(varying.data(), varying.size()));
+    EXPECT_FALSE(RunLengthPresentValuePolicy::worthwhile(annuity.data(), 3));  // too short to pay off
+}
+
+TEST(RunLengthPresentValueTest, PresentValuePolicyTakesTheRunPath) {
+    for (const auto& runs : kSchedules) {
+        const std::vector<double> cash_flows = expand(runs);
+        for (const double r : kRates) {
+            EXPECT_EQ(PresentValuePolicy::calculate(r, cash_flows), RunLengthPresentValuePolicy::calculate(r, runs))
+                << runs.size() << " runs at " << r;
+        }
+    }
+
+    // Streams without long runs keep the per-period path
+    const std::vector<double> varying = {100.0, 200.0, 300.0, 400.0, 500.0, 600.0};
+    EXPECT_EQ(PresentValuePolicy::calculate(0.05, varying), pv_per_period(0.05, varying));
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/SimdKernels.hpp"
+#include "test_streams.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+const simd::Isa kAllIsas[] = {
+    simd::Isa::Scalar,
+    simd::Isa::SSE2,
+    simd::Isa::AVX2,
+    simd::Isa::AVX512,
+};
+
+std::vector<float> to_float(const std::vector<double>& cf) {
+    return std::vector<float>(cf.begin(), cf.end());
+}
+
+} // namespace
+
+// ===========================================================================
+// Kernel Tests (every ISA this CPU supports)
+// ===========================================================================
+
+TEST(SimdKernelsTest, DetectedIsaIsSupported) {
+    ASSERT_TRUE(simd::isa_supported(simd::detected_isa()));
+    ASSERT_TRUE(simd::isa_supported(simd::Isa::Scalar));
+    std::cout << "detected isa = " << simd::isa_name(simd::detected_isa()) << "\n";
+}
+
+TEST(SimdKernelsTest, AllPathsMatchPowPathIncludingTails) {
+    const double base = 1.0 + 0.05 / 12.0;
+
+    // Sizes straddle lane widths, the 2W unroll and the anchor interval
+    for (std::size_t n : {1u, 2u, 3u, 7u, 15u, 16u, 17u, 63u, 64u, 65u, 129u, 360u, 1001u}) {
+        const std::vector<double> cf = make_mixed_stream(n);
+        const double expected = PresentValuePolicy::calculate(base - 1.0, cf);
+        const double bound = (64.0 + 2.0 * static_cast<double>(n)) * std::ldexp(1.0, -53)
+                           * discounted_mass(base, cf);
+
+        for (simd::Isa isa : kAllIsas) {
+            if (!simd::isa_supported(isa)) {
+                continue;
+            }
+            ASSERT_NEAR(simd::present_value(isa, base, cf.data(), n), expected, bound)
+                << "isa=" << simd::isa_name(isa) << " n=" << n;
+        }
+    }
+}
+
+TEST(SimdKernelsTest, LongStreamWithinBound) {
+    const std::vector<double> cf = make_mixed_stream(1000000);
+    const double base = 1.00001;
+    const double expected = PresentValuePolicy::calculate(base - 1.0, cf);
+    const double bound = (64.0 + 2.0e6) * std::ldexp(1.0, -53) * discounted_mass(base, cf);
+
+    ASSERT_NEAR(simd::present_value(base, cf.data(), cf.size()), expected, bound);
+}
+
+TEST(SimdKernelsTest, ReproducibleModeIsScalarBitForBit) {
+    const std::vector<double> cf = make_mixed_stream(4097);
+    const double base = 1.03;
+
+    const double reproducible = simd::present_value_reproducible(base, cf.data(), cf.size());
+    ASSERT_EQ(reproducible, simd::present_value(simd::Isa::Scalar, base, cf.data(), cf.size()));
+    ASSERT_EQ(reproducible, RecurrencePresentValuePolicy::calculate(0.03, cf));
+}
+
+TEST(SimdKernelsTest, MixedPathsMatchDoubleKernelOnWidenedFlows) {
+    const double base = 1.0 + 0.05 / 12.0;
+
+    // make_mixed_stream values are exact in float: widening loses nothing,
+    // so every path must reproduce the double kernel bit for bit
+    for (std::size_t n : {1u, 3u, 7u, 15u, 16u, 17u, 63u, 64u, 65u, 129u, 360u, 1001u}) {
+        const std::vector<double> cf = make_mixed_stream(n);
+        const std::vector<float> cf32 = to_float(cf);
+
+        for (simd::Isa isa : kAllIsas) {
+            if (!simd::isa_supported(isa)) {
+                continue;
+            }
+            ASSERT_EQ(simd::present_value_mixed(isa, base, cf32.data(), n),
+                      simd::present_value(isa, base, cf.data(), n))
+                << "isa=" << simd::isa_name(isa) << " n=" << n;
+        }
+    }
+}
+
+TEST(SimdKernelsTest, SinglePrecisionPathsWithinFloatBound) {
+    const double base = 1.0 + 0.05 / 12.0;
+
+    // Sizes straddle the float lane widths (4 / 8 / 16), the anchor interval
+    // and the 1024-period widening interval; the last one is long enough
+    // that an unflushed float accumulator would drift past the bound
+    for (std::size_t n : {1u, 5u, 9u, 31u, 32u, 33u, 65u, 360u, 1023u, 1025u, 3001u, 200000u}) {
+        const std::vector<double> cf = make_mixed_stream(n);
+        const std::vector<float> cf32 = to_float(cf);
+        const double expected = simd::present_value(simd::Isa::Scalar, base, cf.data(), n);
+        const double bound = 256.0 * std::ldexp(1.0, -24) * discounted_mass(base, cf);
+
+        for (simd::Isa isa : kAllIsas) {
+            if (!simd::isa_supported(isa)) {
+                continue;
+            }
+            ASSERT_NEAR(simd::present_value_f32(isa, base, cf32.data(), n), expected, bound)
+                << "isa=" << simd::isa_name(isa) << " n=" << n;
+        }
+    }
+}
+
+TEST(SimdKernelsTest, FutureValuePathsBitIdenticalAndNearPow) {
+    // Periods 0..10000 with a ragged tail; rates from -50% to +50%
+    const std::size_t n = 10003;
+    std::vector<double> principals(n), rates(n), expected(n), scalar(n);
+    std::vector<int> periods(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        principals[i] = 1000.0 + static_cast<double>(i % 13);
+        rates[i] = -0.5 + static_cast<double>(i % 101) / 100.0;
+        periods[i] = static_cast<int>(i % 10001);
+        expected[i] = principals[i] * std::pow(1.0 + rates[i], static_cast<double>(periods[i]));
+    }
+
+    simd::future_value(simd::Isa::Scalar, principals.data(), rates.data(), periods.data(), n, scalar.data());
+    for (std::size_t i = 0; i < n; ++i) {
+        if (std::isinf(expected[i])) {
+            ASSERT_EQ(scalar[i], expected[i]) << "i=" << i;
+        } else if (expected[i] > 1e-300) {
+            ASSERT_NEAR(scalar[i], expected[i], 4.0 * std::ldexp(expected[i], -53)) << "i=" << i;
+        } else {
+            ASSERT_NEAR(scalar[i], expected[i], 1e-300) << "i=" << i;
+        }
+    }
+
+    for (simd::Isa isa : kAllIsas) {
+        if (!simd::isa_supported(isa)) {
+            continue;
+        }
+        std::vector<double> results(n);
+        simd::future_value(isa, principals.data(), rates.data(), periods.data(), n, results.data());
+        ASSERT_EQ(results, scalar) << "isa=" << simd::isa_name(isa);
+    }
+}
+
+TEST(SimdKernelsTest, DotPathsMatchScalarIncludingTails) {
+    // Sizes straddle every lane width and the 4W unroll
+    for (std::size_t n : {0u, 1u, 3u, 7u, 8u, 15u, 31u, 32u, 33u, 360u, 1001u}) {
+        const std::vector<double> a = make_mixed_stream(n);
+        std::vector<double> b(n);
+        double mass = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            b[i] = 1.0 / std::pow(1.004, static_cast<double>(i) + 1.0);
+            mass += std::fabs(a[i] * b[i]);
+        }
+        const double expected = simd::dot(simd::Isa::Scalar, a.data(), b.data(), n);
+        const double bound = 2.0 * static_cast<double>(n) * std::ldexp(1.0, -53) * mass;
+
+        for (simd::Isa isa : kAllIsas) {
+            if (!simd::isa_supported(isa)) {
+                continue;
+            }
+            ASSERT_NEAR(simd::dot(isa, a.data(), b.data(), n), expected, bound)
+                << "isa=" << simd::isa_name(isa) << " n=" << n;
+        }
+    }
+}
+
+// ===========================================================================
+// Policy Tests
+// ===========================================================================
+
+TEST(SimdPresentValuePolicyTest, BondValuation) {
+    Calculator<SimdPresentValuePolicy> calc;
+
+    std::vector<double> cash_flows = {50.0, 50.0, 1050.0};
+    ASSERT_NEAR(calc.calculate(0.06, cash_flows), 973.27, 1.0);
+}
+
+TEST(SimdPresentValuePolicyTest, InvalidInputs) {
+    Calculator<SimdPresentValuePolicy> calc;
+    Calculator<ReproducibleSimdPresentValuePolicy> reproducible_calc;
+
+    std::vector<double> empty_flows;
+    std::vector<double> cash_flows = {100.0};
+    ASSERT_THROW(calc.calculate(0.05, empty_flows), std::invalid_argument);
+    ASSERT_THROW(calc.calculate(-1.0, cash_flows), std::invalid_argument);
+    ASSERT_THROW(reproducible_calc.calculate(0.05, empty_flows), std::invalid_argument);
+}
+
+TEST(SimdFutureValuePolicyTest, BatchMatchesScalarCalls) {
+    Calculator<SimdFutureValuePolicy> calc;
+
+    const std::vector<double> principals = {1000.0, 5000.0, 100.0, 0.0, 250.0};
+    const std::vector<double> rates = {0.05, 0.0325, 1.0, 0.07, -0.02};
+    const std::vector<int> periods = {10, 8, 5, 30, 0};
+    std::vector<double> results(principals.size());
+    calc.calculate_batch(principals, rates, periods, results);
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        ASSERT_EQ(results[i], calc.calculate(principals[i], rates[i], periods[i]));
+        ASSERT_DOUBLE_EQ(results[i], FutureValuePolicy::calculate(principals[i], rates[i], periods[i]));
+    }
+}
+
+TEST(SimdFutureValuePolicyTest, InvalidInputs) {
+    Calculator<SimdFutureValuePolicy> calc;
+    ASSERT_THROW(calc.calculate(-1.0, 0.05, 10), std::invalid_argument);
+    ASSERT_THROW(calc.calculate(1000.0, -1.0, 10), std::invalid_argument);
+    ASSERT_THROW(calc.calculate(1000.0, 0.05, -1), std::invalid_argument);
+
+    const std::vector<double> principals = {1000.0, 1000.0};
+    const std::vector<double> rates = {0.05, 0.05};
+    const std::vector<int> periods = {10, -3};
+    std::vector<double> results(2, -7.0);
+    try {
+        calc.calculate_batch(principals, rates, periods, results);
+        FAIL() << "expected std::invalid_argument";
+    } catch (const std::invalid_argument& e) {
+        ASSERT_STREQ(e.what(), "element 1: periods must be >= 0");
+    }
+    ASSERT_EQ(results[0], -7.0);  // nothing written before validation passes
+
+    std::vector<double> short_results(1);
+    ASSERT_THROW(calc.calculate_batch(principals, rates, periods, short_results), std::invalid_argument);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/SummationPolicies.hpp"
+#include "test_streams.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+constexpr double kUnitRoundoff = 0x1p-53;
+
+template <typename Summation>
+double sum_all(const std::vector<double>& x) {
+    typename Summation::Accumulator acc;
+    acc.add(x.data(), x.size());
+    return acc.result();
+}
+
+// Σ CF_i / base^(i+1) with long double discount factors and Neumaier
+// summation; discounts with the same (rounded) base as the double kernels
+struct Reference {
+    long double pv = 0.0L;
+    long double mass = 0.0L;
+};
+
+Reference reference_pv(double base, const std::vector<double>& cf) {
+    Reference ref;
+    long double compensation = 0.0L;
+    for (std::size_t i = 0; i < cf.size(); ++i) {
+        const long double term = static_cast<long double>(cf[i])
+                               / std::pow(static_cast<long double>(base), static_cast<long double>(i) + 1.0L);
+        const long double t = ref.pv + term;
+        if (std::fabs(ref.pv) >= std::fabs(term)) {
+            compensation += (ref.pv - t) + term;
+        } else {
+            compensation += (term - t) + ref.pv;
+        }
+        ref.pv = t;
+        ref.mass += std::fabs(term);
+    }
+    ref.pv += compensation;
+    return ref;
+}
+
+template <typename Policy>
+double pv_error(double base, const std::vector<double>& cf, const Reference& ref) {
+    const long double pv = static_cast<long double>(Policy::calculate(base - 1.0, cf));
+    return static_cast<double>(std::fabs(pv - ref.pv));
+}
+
+} // namespace
+
+// ===========================================================================
+// Accumulator Tests
+// ===========================================================================
+
+TEST(SummationPoliciesTest, ExactOnRepresentableSums) {
+    std::vector<double> x(1000);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = static_cast<double>(i);
+    }
+    ASSERT_EQ(sum_all<NaiveSummation>(x), 499500.0);
+    ASSERT_EQ(sum_all<PairwiseSummation>(x), 499500.0);
+    ASSERT_EQ(sum_all<NeumaierSummation>(x), 499500.0);
+    ASSERT_EQ(sum_all<VectorCompensatedSummation>(x), 499500.0);
+}
+
+TEST(SummationPoliciesTest, CompensatedRecoverCancelledTerms) {
+    // 1 is lost entirely by a naive running sum
+    const std::vector<double> x = {1e16, 1.0, -1e16};
+    ASSERT_EQ(sum_all<NaiveSummation>(x), 0.0);
+    ASSERT_EQ(sum_all<NeumaierSummation>(x), 1.0);
+    ASSERT_EQ(sum_all<VectorCompensatedSummation>(x), 1.0);
+}
+
+TEST(SummationPoliciesTest, PairwiseIndependentOfBlocking) {
+    const std::vector<double> x = make_mixed_stream(10007);
+    const double whole = sum_all<PairwiseSummation>(x);
+
+    PairwiseSummation::Accumulator acc;
+    for (std::size_t start = 0; start < x.size(); start += 33) {
+        acc.add(x.data() + start, std::min<std::size_t>(33, x.size() - start));
+    }
+    ASSERT_EQ(acc.result(), whole);
+}
+
+TEST(SummationPoliciesTest, EmptyAccumulatorIsZero) {
+    ASSERT_EQ(PairwiseSummation::Accumulator().result(), 0.0);
+    ASSERT_EQ(VectorCompensatedSummation::Accumulator().result(), 0.0);
+}
+
+// ===========================================================================
+// SummedPresentValuePolicy Tests
+// ===========================================================================
+
+TEST(SummedPresentValueTest, NaiveMatchesRecurrenceBitForBit) {
+    for (std::size_t n : {1u, 31u, 32u, 33u, 1000u}) {
+        const std::vector<double> cf = make_mixed_stream(n);
+        ASSERT_EQ(SummedPresentValuePolicy<NaiveSummation>::calculate(0.004, cf),
+                  RecurrencePresentValuePolicy::calculate(0.004, cf)) << "n=" << n;
+    }
+}
+
+TEST(SummedPresentValueTest, AllSummationsWithinTheirBounds) {
+    const std::vector<double> cf = make_mixed_stream(200000);
+    const double base = 1.00001;
+    const Reference ref = reference_pv(base, cf);
+    const double mass = static_cast<double>(ref.mass);
+    const double n = static_cast<double>(cf.size());
+
+    // Term error of the recurrence generator (see RecurrenceDiscountFactors)
+    const double term = (32.0 + 4.0) * kUnitRoundoff * mass;
+    const double naive = pv_error<SummedPresentValuePolicy<NaiveSummation>>(base, cf, ref);
+    const double pairwise = pv_error<SummedPresentValuePolicy<PairwiseSummation>>(base, cf, ref);
+    const double neumaier = pv_error<SummedPresentValuePolicy<NeumaierSummation>>(base, cf, ref);
+    const double vector = pv_error<SummedPresentValuePolicy<VectorCompensatedSummation>>(base, cf, ref);
+
+    ASSERT_LE(naive, term + n * kUnitRoundoff * mass);
+    ASSERT_LE(pairwise, term + (64.0 + 18.0) * kUnitRoundoff * mass);
+    ASSERT_LE(neumaier, term + 2.0 * kUnitRoundoff * std::fabs(static_cast<double>(ref.pv)));
+    ASSERT_LE(vector, term + 2.0 * kUnitRoundoff * std::fabs(static_cast<double>(ref.pv)));
+    ASSERT_LT(neumaier, naive);
+    ASSERT_LT(vector, naive);
+}
+
+TEST(SummedPresentValueTest, CompensatedPowNearlyCorrectlyRounded) {
+    // Heavy cancellation: |PV| is ~5 orders of magnitude below Σ|terms|
+    std::vector<double> cf(100000);
+    for (std::size_t i = 0; i < cf.size(); ++i) {
+        cf[i] = ((i % 2) ? -1.0e6 : 1.0e6) + static_cast<double>(i % 7) * 0.013;
+    }
+    const double base = 1.00001;
+    const Reference ref = reference_pv(base, cf);
+
+    // ~1.5u per pow-based term, plus the compensated sum's 2u·|S|
+    const double bound = 2.0 * kUnitRoundoff * static_cast<double>(ref.mass)
+                       + 2.0 * kUnitRoundoff * std::fabs(static_cast<double>(ref.pv));
+    ASSERT_LE((pv_error<SummedPresentValuePolicy<NeumaierSummation, PowDiscountFactors>>(base, cf, ref)), bound);
+    ASSERT_LE((pv_error<SummedPresentValuePolicy<VectorCompensatedSummation, PowDiscountFactors>>(base, cf, ref)), bound);
+}
+
+TEST(SummedPresentValueTest, WorksThroughCalculator) {
+    Calculator<SummedPresentValuePolicy<NeumaierSummation>> calc;
+    ASSERT_NEAR(calc.calculate(0.05, {100.0, 100.0}), 100.0 / 1.05 + 100.0 / (1.05 * 1.05), 1e-12);
+    ASSERT_THROW(calc.calculate(-1.0, {100.0}), std::invalid_argument);
+    ASSERT_THROW(calc.calculate(0.05, std::span<const double>()), std::invalid_argument);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,35 @@
+#ifndef TEST_STREAMS_HPP
+#define TEST_STREAMS_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// ===========================================================================
+// Test Cash-Flow Streams
+// ===========================================================================
+// Deterministic streams shared by the kernel and policy tests (no RNG, so a
+// failure reproduces exactly).
+// ===========================================================================
+
+// Magnitudes 25..315 in 41 steps, every fourth flow negative
+inline std::vector<double> make_mixed_stream(std::size_t n) {
+    std::vector<double> cf(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double magnitude = 25.0 + static_cast<double>(i % 41) * 7.25;
+        cf[i] = (i % 4 == 3) ? -magnitude : magnitude;
+    }
+    return cf;
+}
+
+// Σ|CF_i| / base^(i+1): the scale the documented PV error bounds are
+// expressed in (base = 1 + rate)
+inline double discounted_mass(double base, const std::vector<double>& cf) {
+    double mass = 0.0;
+    for (std::size_t i = 0; i < cf.size(); ++i) {
+        mass += std::fabs(cf[i]) / std::pow(base, static_cast<double>(i) + 1.0);
+    }
+    return mass;
+}
+
+#endif // TEST_STREAMS_HPP
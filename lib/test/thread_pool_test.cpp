@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "../include/ThreadPool.hpp"
+
+// ===========================================================================
+// ThreadPool Tests
+// ===========================================================================
+
+TEST(ThreadPoolTest, RunsEveryChunkExactlyOnce) {
+    ThreadPool pool(3);
+    std::vector<std::atomic<int>> hits(1000);
+
+    pool.parallel_for(hits.size(), 0, [&](std::size_t chunk) {
+        hits[chunk].fetch_add(1);
+    });
+
+    for (const auto& h : hits) {
+        ASSERT_EQ(h.load(), 1);
+    }
+}
+
+TEST(ThreadPoolTest, ZeroChunksIsNoOp) {
+    ThreadPool pool(2);
+    bool called = false;
+    pool.parallel_for(0, 0, [&](std::size_t) { called = true; });
+    ASSERT_FALSE(called);
+}
+
+TEST(ThreadPoolTest, SingleThreadRunsInOrderOnCaller) {
+    ThreadPool pool(3);
+    const std::thread::id caller = std::this_thread::get_id();
+    std::vector<std::size_t> order;
+
+    pool.parallel_for(5, 1, [&](std::size_t chunk) {
+        ASSERT_EQ(std::this_thread::get_id(), caller);
+        order.push_back(chunk);
+    });
+
+    ASSERT_EQ(order, (std::vector<std::size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST(ThreadPoolTest, WorkerlessPoolStillCompletes) {
+    ThreadPool pool(0);
+    ASSERT_EQ(pool.concurrency(), 1u);
+
+    std::size_t sum = 0;
+    pool.parallel_for(10, 0, [&](std::size_t chunk) { sum += chunk; });
+    ASSERT_EQ(sum, 45u);
+}
+
+TEST(ThreadPoolTest, RethrowsChunkException) {
+    ThreadPool pool(3);
+    std::atomic<int> ran{0};
+
+    ASSERT_THROW(
+        pool.parallel_for(64, 0, [&](std::size_t chunk) {
+            ran.fetch_add(1);
+            if (chunk == 17) {
+                throw std::runtime_error("chunk failed");
+            }
+        }),
+        std::runtime_error);
+    ASSERT_EQ(ran.load(), 64);
+}
+
+TEST(ThreadPoolTest, ConcurrentCallersShareThePool) {
+    ThreadPool pool(2);
+    std::atomic<std::size_t> total{0};
+
+    std::vector<std::thread> callers;
+    for (int c = 0; c < 4; ++c) {
+        callers.emplace_back([&] {
+            pool.parallel_for(100, 0, [&](std::size_t) { total.fetch_add(1); });
+        });
+    }
+    for (std::thread& t : callers) {
+        t.join();
+    }
+
+    ASSERT_EQ(total.load(), 400u);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
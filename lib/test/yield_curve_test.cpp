@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "../include/Calculator.hpp"
+#include "../include/CalculationPolicies.hpp"
+#include "../include/YieldCurve.hpp"
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+
+namespace {
+
+const std::vector<double> kTimes = {0.25, 0.5, 1.0, 2.0, 5.0, 10.0, 30.0};
+const std::vector<double> kRates = {0.030, 0.031, 0.033, 0.036, 0.041, 0.043, 0.045};
+
+const CurveInterpolation kAllInterpolations[] = {
+    CurveInterpolation::Linear,
+    CurveInterpolation::LogLinear,
+    CurveInterpolation::MonotoneCubic,
+};
+
+} // namespace
+
+// ===========================================================================
+// Interpolation Tests
+// ===========================================================================
+
+TEST(YieldCurveTest, ReproducesPillarsAndFlatEnds) {
+    for (CurveInterpolation interpolation : kAllInterpolations) {
+        const YieldCurve curve(kTimes, kRates, CurveQuote::ZeroRate, interpolation);
+        EXPECT_EQ(curve.pillars(), kTimes.size());
+        for (std::size_t i = 0; i < kTimes.size(); ++i) {
+            EXPECT_NEAR(curve.discount_factor(kTimes[i]), std::exp(-kRates[i] * kTimes[i]), 1e-15) << i;
+        }
+        EXPECT_EQ(curve.discount_factor(0.0), 1.0);
+        EXPECT_NEAR(curve.zero_rate(0.1), kRates.front(), 1e-15);
+        EXPECT_NEAR(curve.zero_rate(50.0), kRates.back(), 1e-15);
+    }
+}
+
+TEST(YieldCurveTest, LinearInterpolatesZeroRates) {
+    const YieldCurve curve(kTimes, kRates, CurveQuote::ZeroRate, CurveInterpolation::Linear);
+    EXPECT_NEAR(curve.zero_rate(1.5), 0.5 * (0.033 + 0.036), 1e-15);
+    EXPECT_NEAR(curve.zero_rate(20.0), 0.043 + 0.5 * (0.045 - 0.043), 1e-15);
+}
+
+TEST(YieldCurveTest, LogLinearHasFlatForwardsBetweenPillars) {
+    const YieldCurve curve(kTimes, kRates, CurveQuote::ZeroRate, CurveInterpolation::LogLinear);
+    // ln DF linear in t: the DF at the midpoint is the geometric mean
+    const double df2 = curve.discount_factor(2.0);
+    const double df5 = curve.discount_factor(5.0);
+    EXPECT_NEAR(curve.discount_factor(3.5), std::sqrt(df2 * df5), 1e-15);
+}
+
+TEST(YieldCurveTest, MonotoneCubicDoesNotOvershoot) {
+    // Increasing zero rates with a plateau: the spline must stay monotone
+    // and flat on the plateau
+    const std::vector<double> times = {1.0, 2.0, 3.0, 4.0, 5.0};
+    const std::vector<double> rates = {0.01, 0.03, 0.03, 0.031, 0.05};
+    const YieldCurve curve(times, rates, CurveQuote::ZeroRate, CurveInterpolation::MonotoneCubic);
+
+    double previous = curve.zero_rate(1.0);
+    for (double t = 1.0; t <= 5.0; t += 0.01) {
+        const double r = curve.zero_rate(t);
+        EXPECT_GE(r, previous - 1e-15) << t;
+        EXPECT_LE(r, 0.05 + 1e-15) << t;
+        previous = r;
+    }
+    EXPECT_NEAR(curve.zero_rate(2.5), 0.03, 1e-15);
+
+    // Smooth: the one-sided slopes agree at an interior pillar
+    const double h = 1e-6;
+    const double left = (curve.zero_rate(4.0) - curve.zero_rate(4.0 - h)) / h;
+    const double right = (curve.zero_rate(4.0 + h) - curve.zero_rate(4.0)) / h;
+    EXPECT_NEAR(left, right, 1e-4);
+}
+
+TEST(YieldCurveTest, DiscountFactorQuotesMatchZeroRateQuotes) {
+    std::vector<double> dfs(kTimes.size());
+    for (std::size_t i = 0; i < kTimes.size(); ++i) {
+        dfs[i] = std::exp(-kRates[i] * kTimes[i]);
+    }
+    for (CurveInterpolation interpolation : kAllInterpolations) {
+        const YieldCurve from_rates(kTimes, kRates, CurveQuote::ZeroRate, interpolation);
+        const YieldCurve from_dfs(kTimes, dfs, CurveQuote::DiscountFactor, interpolation);
+        for (double t : {0.1, 0.75, 3.0, 7.5, 40.0}) {
+            EXPECT_NEAR(from_dfs.discount_factor(t), from_rates.discount_factor(t), 1e-14) << t;
+        }
+    }
+}
+
+TEST(YieldCurveTest, SegmentHintMatchesFreshSearch) {
+    const YieldCurve curve(kTimes, kRates, CurveQuote::ZeroRate, CurveInterpolation::MonotoneCubic);
+    std::size_t hint = 0;
+    // Forward walk, then a step backwards
+    for (double t : {0.0, 0.1, 0.25, 0.6, 0.6, 3.0, 29.9, 30.0, 45.0, 1.2}) {
+        EXPECT_EQ(curve.discount_factor(t, hint), curve.discount_factor(t)) << t;
+        EXPECT_EQ(hint, curve.segment(t)) << t;
+    }
+}
+
+TEST(YieldCurveTest, InvalidPillars) {
+    const std::vector<double> empty;
+    EXPECT_THROW(YieldCurve(empty, empty), std::invalid_argument);
+    EXPECT_THROW(YieldCurve(std::vector<double>{1.0, 2.0}, std::vector<double>{0.01}), std::invalid_argument);
+    EXPECT_THROW(YieldCurve(std::vector<double>{1.0, 1.0}, std::vector<double>{0.01, 0.02}),
+                 std::invalid_argument);
+    EXPECT_THROW(YieldCurve(std::vector<double>{0.0, 1.0}, std::vector<double>{0.01, 0.02}),
+                 std::invalid_argument);
+    EXPECT_THROW(YieldCurve(std::vector<double>{1.0}, std::vector<double>{0.0}, CurveQuote::DiscountFactor),
+                 std::invalid_argument);
+}
+
+// ===========================================================================
+// CurvePresentValuePolicy Tests
+// ===========================================================================
+
+TEST(CurvePresentValuePolicyTest, FlatCurveMatchesPresentValuePolicy) {
+    // Continuous rate ln(1.05) is 5% annually compounded
+    const double rate = std::log(1.05);
+    const std::vector<double> pillar_times = {1.0, 10.0};
+    const std::vector<double> pillar_rates = {rate, rate};
+    const std::vector<double> times = {1.0, 2.0, 3.0, 4.0, 5.0};
+    const std::vector<double> cash_flows = {60.0, 60.0, 60.0, 60.0, 1060.0};
+
+    for (CurveInterpolation interpolation : kAllInterpolations) {
+        const YieldCurve curve(pillar_times, pillar_rates, CurveQuote::ZeroRate, interpolation);
+        Calculator<CurvePresentValuePolicy> calc;
+        EXPECT_NEAR(calc.calculate(curve, times, cash_flows),
+                    PresentValuePolicy::calculate(0.05, cash_flows), 1e-10);
+    }
+}
+
+TEST(CurvePresentValuePolicyTest, UnorderedFlowsMatchOrdered) {
+    const YieldCurve curve(kTimes, kRates, CurveQuote::ZeroRate, CurveInterpolation::LogLinear);
+    const std::vector<double> ordered_times = {0.5, 1.5, 4.0, 12.0};
+    const std::vector<double> ordered_flows = {10.0, 20.0, 30.0, 40.0};
+    const std::vector<double> shuffled_times = {12.0, 0.5, 4.0, 1.5};
+    const std::vector<double> shuffled_flows = {40.0, 10.0, 30.0, 20.0};
+
+    EXPECT_NEAR(CurvePresentValuePolicy::calculate(curve, shuffled_times, shuffled_flows),
+                CurvePresentValuePolicy::calculate(curve, ordered_times, ordered_flows), 1e-12);
+}
+
+TEST(CurvePresentValuePolicyTest, InvalidInputs) {
+    const YieldCurve curve(kTimes, kRates);
+    const std::vector<double> empty;
+    const std::vector<double> one = {1.0};
+    const std::vector<double> negative = {-1.0};
+    const std::vector<double> two = {1.0, 2.0};
+
+    EXPECT_THROW(CurvePresentValuePolicy::calculate(curve, empty, empty), std::invalid_argument);
+    EXPECT_THROW(CurvePresentValuePolicy::calculate(curve, two, one), std::invalid_argument);
+    EXPECT_THROW(CurvePresentValuePolicy::calculate(curve, negative, one), std::invalid_argument);
+}
+
+// ===========================================================================
+// Main Test Runner
+// ===========================================================================
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -5,18 +5,29 @@ This module provides financial calculators with real mathematical logic:
   - Present Value: Calculate PV of future cash flows
   - Future Value: Calculate FV of a principal amount
   - Interest Rate Conversion: Convert nominal to effective annual rate
+  - Internal Rate of Return: Solve for the rate that zeroes a stream's PV
+  - Yield Curve: Discount dated cash flows on an interpolated term structure
+  - Bonds: Price, yield to maturity, duration and convexity from bond terms
 """
 
 from .calculator_cffi import (
+    BondCalculator,
     PresentValueCalculator,
     FutureValueCalculator,
     InterestRateCalculator,
+    InternalRateOfReturnCalculator,
+    YieldCurve,
+    simd_isa,
 )
 
 __all__ = [
+    'BondCalculator',
     'PresentValueCalculator',
     'FutureValueCalculator',
     'InterestRateCalculator',
+    'InternalRateOfReturnCalculator',
+    'YieldCurve',
+    'simd_isa',
 ]
 
 __version__ = '1.0.0'
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""
+Out-of-line API-mode CFFI builder for the calculator bindings.
+
+Compiles a small CPython extension, ``calculator._calculator``, that calls
+the C API directly instead of going through libffi (ABI mode). The
+extension links against the shared library that ``build.sh --build``
+copies into ``python/``, and finds it at runtime via an rpath relative to
+the extension, so the package directory stays relocatable.
+
+Usage:
+    python python/calculator/_calculator_build.py [--lib-dir DIR] [--build-dir DIR]
+
+calculator_cffi.py imports the extension when present and falls back to
+ABI mode otherwise.
+"""
+import argparse
+import os
+import platform
+import shutil
+import sys
+
+from cffi import FFI
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+PYTHON_DIR = os.path.dirname(HERE)
+REPO_ROOT = os.path.dirname(PYTHON_DIR)
+
+sys.path.insert(0, HERE)
+from _cdef import CDEF  # noqa: E402
+
+
+def make_builder(lib_dir: str, include_dir: str) -> FFI:
+    ffibuilder = FFI()
+    ffibuilder.cdef(CDEF)
+
+    if platform.system() == "Darwin":
+        # build.sh copies the dylib as libcalculator_c_api.so; ld64 will not
+        # resolve -l against a .so name, so link the file directly.
+        link = {
+            "extra_link_args": [
+                os.path.join(lib_dir, "libcalculator_c_api.so"),
+                "-Wl,-rpath,@loader_path/..",
+            ],
+        }
+    else:
+        link = {
+            "libraries": ["calculator_c_api"],
+            "library_dirs": [lib_dir],
+            "extra_link_args": ["-Wl,-rpath,$ORIGIN/.."],
+        }
+
+    ffibuilder.set_source(
+        "calculator._calculator",
+        '#include "calculator_c_api.h"',
+        include_dirs=[include_dir],
+        **link,
+    )
+    return ffibuilder
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument(
+        "--lib-dir",
+        default=PYTHON_DIR,
+        help="directory containing libcalculator_c_api.so (default: python/)",
+    )
+    parser.add_argument(
+        "--include-dir",
+        default=os.path.join(REPO_ROOT, "lib", "include"),
+        help="directory containing calculator_c_api.h",
+    )
+    parser.add_argument(
+        "--build-dir",
+        default=os.path.join(REPO_ROOT, "build", "cffi"),
+        help="scratch directory for generated C and object files",
+    )
+    args = parser.parse_args()
+
+    if not os.path.exists(os.path.join(args.lib_dir, "libcalculator_c_api.so")):
+        print(f"libcalculator_c_api.so not found in {args.lib_dir}; run ./build.sh --build first")
+        return 1
+
+    os.makedirs(args.build_dir, exist_ok=True)
+    built = make_builder(args.lib_dir, args.include_dir).compile(tmpdir=args.build_dir)
+
+    target = os.path.join(HERE, os.path.basename(built))
+    shutil.copy2(built, target)
+    print(f"Built API-mode extension: {target}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
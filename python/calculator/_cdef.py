@@ -0,0 +1,433 @@
+"""
+C declarations shared by the ABI-mode loader (calculator_cffi.py) and the
+API-mode extension builder (_calculator_build.py).
+
+Keep in sync with lib/include/calculator_c_api.h; the API-mode build
+compiles these against the real header, so any drift fails at build time.
+"""
+
+CDEF = """
+    typedef struct PVCalculator_t* PVCalculatorHandle;
+    typedef struct FVCalculator_t* FVCalculatorHandle;
+    typedef struct IRCalculator_t* IRCalculatorHandle;
+    typedef struct IRRCalculator_t* IRRCalculatorHandle;
+    typedef struct YieldCurve_t* YieldCurveHandle;
+    typedef struct BondCalculator_t* BondCalculatorHandle;
+
+    typedef struct PVCacheStats {
+        size_t hits;
+        size_t misses;
+        size_t evictions;
+        size_t rates;
+        size_t factors;
+    } PVCacheStats;
+
+    typedef struct BondAnalytics {
+        double price;
+        double macaulay_duration;
+        double modified_duration;
+        double convexity;
+    } BondAnalytics;
+
+    typedef struct PVSensitivities {
+        double pv;
+        double dpv_dr;
+        double d2pv_dr2;
+        double dv01;
+        double modified_duration;
+        double convexity;
+    } PVSensitivities;
+
+    PVCalculatorHandle pv_calculator_create(void);
+    int pv_calculator_calculate(
+        PVCalculatorHandle calc,
+        double discount_rate,
+        const double* cash_flows,
+        size_t n_cash_flows,
+        double* result
+    );
+    int pv_calculator_calculate_batch(
+        PVCalculatorHandle calc,
+        const double* discount_rates,
+        const double* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        double* results
+    );
+    int pv_calculator_calculate_batch_parallel(
+        PVCalculatorHandle calc,
+        const double* discount_rates,
+        const double* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        double* results,
+        size_t n_threads
+    );
+    int pv_calculator_calculate_sensitivities(
+        PVCalculatorHandle calc,
+        double discount_rate,
+        const double* cash_flows,
+        size_t n_cash_flows,
+        PVSensitivities* result
+    );
+    int pv_calculator_calculate_sensitivities_batch(
+        PVCalculatorHandle calc,
+        const double* discount_rates,
+        const double* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        PVSensitivities* results
+    );
+    int pv_calculator_calculate_sensitivities_batch_parallel(
+        PVCalculatorHandle calc,
+        const double* discount_rates,
+        const double* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        PVSensitivities* results,
+        size_t n_threads
+    );
+    int pv_calculator_calculate_f32(
+        PVCalculatorHandle calc,
+        float discount_rate,
+        const float* cash_flows,
+        size_t n_cash_flows,
+        float* result
+    );
+    int pv_calculator_calculate_mixed(
+        PVCalculatorHandle calc,
+        double discount_rate,
+        const float* cash_flows,
+        size_t n_cash_flows,
+        double* result
+    );
+    int pv_calculator_calculate_batch_f32(
+        PVCalculatorHandle calc,
+        const float* discount_rates,
+        const float* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        float* results
+    );
+    int pv_calculator_calculate_batch_f32_parallel(
+        PVCalculatorHandle calc,
+        const float* discount_rates,
+        const float* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        float* results,
+        size_t n_threads
+    );
+    int pv_calculator_calculate_batch_mixed(
+        PVCalculatorHandle calc,
+        const double* discount_rates,
+        const float* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        double* results
+    );
+    int pv_calculator_calculate_batch_mixed_parallel(
+        PVCalculatorHandle calc,
+        const double* discount_rates,
+        const float* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        double* results,
+        size_t n_threads
+    );
+    int pv_calculator_calculate_matrix(
+        PVCalculatorHandle calc,
+        const double* cash_flows,
+        size_t n_streams,
+        size_t n_periods,
+        size_t cash_flow_stride,
+        const double* discount_factors,
+        size_t n_curves,
+        size_t discount_factor_stride,
+        double* results
+    );
+    #define DAY_COUNT_ACT_365 0
+    #define DAY_COUNT_ACT_360 1
+    #define DAY_COUNT_30_360 2
+
+    int pv_calculator_calculate_xnpv(
+        PVCalculatorHandle calc,
+        double discount_rate,
+        const int64_t* dates,
+        const double* cash_flows,
+        size_t n_cash_flows,
+        int day_count,
+        double* result
+    );
+    int pv_calculator_calculate_xnpv_batch(
+        PVCalculatorHandle calc,
+        const double* discount_rates,
+        const int64_t* dates,
+        const double* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        int day_count,
+        double* results
+    );
+    int pv_calculator_calculate_runs(
+        PVCalculatorHandle calc,
+        double discount_rate,
+        const double* values,
+        const size_t* counts,
+        size_t n_runs,
+        double* result
+    );
+    int pv_calculator_set_reproducible(PVCalculatorHandle calc, int enabled);
+    int pv_calculator_set_cache(PVCalculatorHandle calc, size_t max_rates);
+    int pv_calculator_get_cache_stats(PVCalculatorHandle calc, PVCacheStats* stats);
+    const char* pv_calculator_get_error(PVCalculatorHandle calc);
+    void pv_calculator_destroy(PVCalculatorHandle calc);
+
+    #define CURVE_QUOTE_ZERO_RATE 0
+    #define CURVE_QUOTE_DISCOUNT_FACTOR 1
+    #define CURVE_INTERP_LINEAR 0
+    #define CURVE_INTERP_LOG_LINEAR 1
+    #define CURVE_INTERP_MONOTONE_CUBIC 2
+
+    YieldCurveHandle yield_curve_create(void);
+    int yield_curve_set_pillars(
+        YieldCurveHandle curve,
+        const double* times,
+        const double* values,
+        size_t n_pillars,
+        int quote,
+        int interpolation
+    );
+    int yield_curve_discount_factors(
+        YieldCurveHandle curve,
+        const double* times,
+        size_t n,
+        double* results
+    );
+    const char* yield_curve_get_error(YieldCurveHandle curve);
+    void yield_curve_destroy(YieldCurveHandle curve);
+    int pv_calculator_calculate_curve(
+        PVCalculatorHandle calc,
+        YieldCurveHandle curve,
+        const double* times,
+        const double* cash_flows,
+        size_t n_cash_flows,
+        double* result
+    );
+    int pv_calculator_calculate_curve_batch(
+        PVCalculatorHandle calc,
+        YieldCurveHandle curve,
+        const double* times,
+        const double* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        double* results
+    );
+
+    FVCalculatorHandle fv_calculator_create(void);
+    int fv_calculator_calculate(
+        FVCalculatorHandle calc,
+        double principal,
+        double interest_rate,
+        int periods,
+        double* result
+    );
+    int fv_calculator_calculate_f32(
+        FVCalculatorHandle calc,
+        float principal,
+        float interest_rate,
+        int periods,
+        float* result
+    );
+    int fv_calculator_calculate_batch(
+        FVCalculatorHandle calc,
+        const double* principals,
+        const double* interest_rates,
+        const int* periods,
+        size_t n,
+        double* results
+    );
+    int fv_calculator_calculate_batch_parallel(
+        FVCalculatorHandle calc,
+        const double* principals,
+        const double* interest_rates,
+        const int* periods,
+        size_t n,
+        double* results,
+        size_t n_threads
+    );
+    const char* fv_calculator_get_error(FVCalculatorHandle calc);
+    void fv_calculator_destroy(FVCalculatorHandle calc);
+
+    IRCalculatorHandle ir_calculator_create(void);
+    int ir_calculator_calculate(
+        IRCalculatorHandle calc,
+        double nominal_rate,
+        int compounding_periods,
+        double* result
+    );
+    int ir_calculator_calculate_f32(
+        IRCalculatorHandle calc,
+        float nominal_rate,
+        int compounding_periods,
+        float* result
+    );
+    int ir_calculator_calculate_batch(
+        IRCalculatorHandle calc,
+        const double* nominal_rates,
+        const int* compounding_periods,
+        size_t n,
+        double* results
+    );
+    int ir_calculator_calculate_batch_parallel(
+        IRCalculatorHandle calc,
+        const double* nominal_rates,
+        const int* compounding_periods,
+        size_t n,
+        double* results,
+        size_t n_threads
+    );
+    int ir_calculator_set_tabulated(IRCalculatorHandle calc, int enabled);
+    int ir_calculator_calculate_batch_uniform(
+        IRCalculatorHandle calc,
+        const double* nominal_rates,
+        size_t n,
+        int compounding_periods,
+        double* results
+    );
+    int ir_calculator_calculate_batch_uniform_parallel(
+        IRCalculatorHandle calc,
+        const double* nominal_rates,
+        size_t n,
+        int compounding_periods,
+        double* results,
+        size_t n_threads
+    );
+    const char* ir_calculator_get_error(IRCalculatorHandle calc);
+    void ir_calculator_destroy(IRCalculatorHandle calc);
+
+    IRRCalculatorHandle irr_calculator_create(void);
+    int irr_calculator_set_tolerance(IRRCalculatorHandle calc, double tolerance, int max_iterations);
+    int irr_calculator_calculate(
+        IRRCalculatorHandle calc,
+        const double* cash_flows,
+        size_t n_cash_flows,
+        double guess,
+        double* result
+    );
+    int irr_calculator_calculate_batch(
+        IRRCalculatorHandle calc,
+        const double* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        const double* guesses,
+        double* results
+    );
+    int irr_calculator_calculate_batch_parallel(
+        IRRCalculatorHandle calc,
+        const double* cash_flows,
+        const size_t* offsets,
+        size_t n_streams,
+        const double* guesses,
+        double* results,
+        size_t n_threads
+    );
+    const char* irr_calculator_get_error(IRRCalculatorHandle calc);
+    void irr_calculator_destroy(IRRCalculatorHandle calc);
+
+    BondCalculatorHandle bond_calculator_create(void);
+    int bond_calculator_price(
+        BondCalculatorHandle calc,
+        double face,
+        double coupon_rate,
+        int periods,
+        int frequency,
+        double yield,
+        double* result
+    );
+    int bond_calculator_yield(
+        BondCalculatorHandle calc,
+        double face,
+        double coupon_rate,
+        int periods,
+        int frequency,
+        double price,
+        double* result
+    );
+    int bond_calculator_analytics(
+        BondCalculatorHandle calc,
+        double face,
+        double coupon_rate,
+        int periods,
+        int frequency,
+        double yield,
+        BondAnalytics* result
+    );
+    int bond_calculator_price_batch(
+        BondCalculatorHandle calc,
+        const double* faces,
+        const double* coupon_rates,
+        const int* periods,
+        const int* frequencies,
+        const double* yields,
+        size_t n_bonds,
+        double* results
+    );
+    int bond_calculator_price_batch_parallel(
+        BondCalculatorHandle calc,
+        const double* faces,
+        const double* coupon_rates,
+        const int* periods,
+        const int* frequencies,
+        const double* yields,
+        size_t n_bonds,
+        double* results,
+        size_t n_threads
+    );
+    int bond_calculator_yield_batch(
+        BondCalculatorHandle calc,
+        const double* faces,
+        const double* coupon_rates,
+        const int* periods,
+        const int* frequencies,
+        const double* prices,
+        size_t n_bonds,
+        double* results
+    );
+    int bond_calculator_yield_batch_parallel(
+        BondCalculatorHandle calc,
+        const double* faces,
+        const double* coupon_rates,
+        const int* periods,
+        const int* frequencies,
+        const double* prices,
+        size_t n_bonds,
+        double* results,
+        size_t n_threads
+    );
+    int bond_calculator_analytics_batch(
+        BondCalculatorHandle calc,
+        const double* faces,
+        const double* coupon_rates,
+        const int* periods,
+        const int* frequencies,
+        const double* yields,
+        size_t n_bonds,
+        BondAnalytics* results
+    );
+    int bond_calculator_analytics_batch_parallel(
+        BondCalculatorHandle calc,
+        const double* faces,
+        const double* coupon_rates,
+        const int* periods,
+        const int* frequencies,
+        const double* yields,
+        size_t n_bonds,
+        BondAnalytics* results,
+        size_t n_threads
+    );
+    const char* bond_calculator_get_error(BondCalculatorHandle calc);
+    void bond_calculator_destroy(BondCalculatorHandle calc);
+
+    const char* calculator_simd_isa(void);
+"""
@@ -1,49 +1,20 @@
 """
 CFFI-based Python bindings for the Policy-Based Design Calculator
 """
+import datetime
+import operator
 import os
 import platform
+from typing import Any
 from cffi import FFI
 
-ffi = FFI()
-
-ffi.cdef("""
-    typedef struct PVCalculator_t* PVCalculatorHandle;
-    typedef struct FVCalculator_t* FVCalculatorHandle;
-    typedef struct IRCalculator_t* IRCalculatorHandle;
-
-    PVCalculatorHandle pv_calculator_create(void);
-    int pv_calculator_calculate(
-        PVCalculatorHandle calc,
-        double discount_rate,
-        const double* cash_flows,
-        size_t n_cash_flows,
-        double* result
-    );
-    const char* pv_calculator_get_error(PVCalculatorHandle calc);
-    void pv_calculator_destroy(PVCalculatorHandle calc);
-
-    FVCalculatorHandle fv_calculator_create(void);
-    int fv_calculator_calculate(
-        FVCalculatorHandle calc,
-        double principal,
-        double interest_rate,
-        int periods,
-        double* result
-    );
-    const char* fv_calculator_get_error(FVCalculatorHandle calc);
-    void fv_calculator_destroy(FVCalculatorHandle calc);
-
-    IRCalculatorHandle ir_calculator_create(void);
-    int ir_calculator_calculate(
-        IRCalculatorHandle calc,
-        double nominal_rate,
-        int compounding_periods,
-        double* result
-    );
-    const char* ir_calculator_get_error(IRCalculatorHandle calc);
-    void ir_calculator_destroy(IRCalculatorHandle calc);
-""")
+from ._cdef import CDEF
+
+try:
+    import numpy as np
+except ImportError:  # NumPy is optional: lists and buffer objects still work
+    np = None
+
 
 def _candidate_library_paths() -> list[str]:
     here = os.path.dirname(__file__)
@@ -65,7 +36,7 @@ def _candidate_library_paths() -> list[str]:
         f"libcalculator_c_api_shared.{ext_native}",
     ]
 
-def _load_library():
+def _load_library(ffi: FFI):
     possible_paths = _candidate_library_paths()
 
     for path in possible_paths:
@@ -90,7 +61,189 @@ def _load_library():
         f"Tried:\n  - " + "\n  - ".join(possible_paths)
     )
 
-lib = _load_library()
+def load_abi_backend():
+    """ABI mode: declare the API with cdef and dlopen the shared library."""
+    abi_ffi = FFI()
+    abi_ffi.cdef(CDEF)
+    return abi_ffi, _load_library(abi_ffi)
+
+
+def load_api_backend():
+    """API mode: import the compiled _calculator extension (ImportError if not built)."""
+    from ._calculator import ffi as api_ffi, lib as api_lib
+    return api_ffi, api_lib
+
+
+# Prefer the compiled API-mode extension (direct C calls, no libffi);
+# fall back to ABI mode when it has not been built for this interpreter.
+# CALCULATOR_CFFI_MODE=abi forces the fallback.
+if os.environ.get("CALCULATOR_CFFI_MODE", "").lower() == "abi":
+    ffi, lib = load_abi_backend()
+    BACKEND = "abi"
+else:
+    try:
+        ffi, lib = load_api_backend()
+        BACKEND = "api"
+    except ImportError:
+        ffi, lib = load_abi_backend()
+        BACKEND = "abi"
+
+
+def simd_isa() -> str:
+    """Name of the SIMD path the native library selected for this CPU."""
+    return ffi.string(lib.calculator_simd_isa()).decode("utf-8")
+
+
+# ============================================================================
+# Zero-copy argument marshalling
+# ============================================================================
+# Buffer-protocol objects (NumPy arrays, array.array, memoryview, ...) are
+# passed to C in place via ffi.from_buffer after their element type and
+# layout are checked. Plain Python sequences are copied into a C array.
+# Wrong-typed buffers are rejected rather than silently converted, so a
+# 50M-row column never takes a hidden copy.
+
+_BUFFER_FORMATS = {
+    "double": ("d",),
+    "float": ("f",),
+    "int": ("i",),
+    "int64_t": ("q", "l"),
+    "size_t": ("N", "L", "Q"),
+}
+
+
+def _is_buffer(obj: Any) -> bool:
+    if isinstance(obj, (list, tuple, range)):
+        return False
+    try:
+        memoryview(obj)
+    except TypeError:
+        return False
+    return True
+
+
+def _is_float32_buffer(values: Any) -> bool:
+    """True for float32 buffers, which PV calls price at mixed precision."""
+    return _is_buffer(values) and memoryview(values).format.lstrip("@=") in _BUFFER_FORMATS["float"]
+
+
+def _as_c_array(values: Any, ctype: str, name: str) -> tuple[Any, int]:
+    """Return (cdata, length) for a 1-D sequence or buffer of ``ctype``."""
+    if not _is_buffer(values):
+        values = list(values)
+        return ffi.new(f"{ctype}[]", values), len(values)
+
+    view = memoryview(values)
+    fmt = view.format.lstrip("@=")
+    if fmt not in _BUFFER_FORMATS[ctype] or view.itemsize != ffi.sizeof(ctype):
+        raise TypeError(
+            f"{name} must hold native {ctype} values (got buffer format {view.format!r}); "
+            f"convert with numpy.ascontiguousarray({name}, dtype=...)"
+        )
+    if view.ndim != 1:
+        raise ValueError(f"{name} must be one-dimensional")
+    if not view.c_contiguous:
+        raise ValueError(f"{name} must be contiguous")
+    return ffi.from_buffer(f"{ctype}[]", values), view.shape[0]
+
+
+def _as_c_matrix(values: Any, name: str) -> tuple[Any, int, int, int]:
+    """Return (cdata, rows, cols, row_stride) for a 2-D row-major float64 matrix.
+
+    NumPy arrays are passed in place, including row-padded views such as
+    ``padded[:, :n]`` (rows must be contiguous, the row stride may exceed the
+    row length). A 1-D input is a single row; nested sequences are copied.
+    """
+    if np is not None and isinstance(values, np.ndarray):
+        if values.dtype != np.float64:
+            raise TypeError(f"{name} must have dtype float64")
+        if values.ndim == 1:
+            values = values.reshape(1, -1)
+        if values.ndim != 2:
+            raise ValueError(f"{name} must be one- or two-dimensional")
+        rows, cols = values.shape
+        item = values.itemsize
+        if cols > 1 and values.strides[1] != item:
+            raise ValueError(f"{name} rows must be contiguous")
+        if rows > 1 and (values.strides[0] % item or values.strides[0] < cols * item):
+            raise ValueError(f"{name} must be row-major")
+        stride = values.strides[0] // item if rows > 1 else cols
+        return ffi.cast("double*", values.ctypes.data), rows, cols, stride
+
+    rows_list = list(values)
+    if rows_list and isinstance(rows_list[0], (int, float)):
+        rows_list = [rows_list]
+    rows_list = [list(row) for row in rows_list]
+    cols = len(rows_list[0]) if rows_list else 0
+    if any(len(row) != cols for row in rows_list):
+        raise ValueError(f"every row of {name} must have the same length")
+    flat = [x for row in rows_list for x in row]
+    return ffi.new("double[]", flat), len(rows_list), cols, cols
+
+
+_EPOCH_ORDINAL = datetime.date(1970, 1, 1).toordinal()
+
+
+def _date_serial(value: Any) -> int:
+    """Days since 1970-01-01 of a date, datetime, ISO string, datetime64 or int."""
+    if isinstance(value, datetime.date):
+        return value.toordinal() - _EPOCH_ORDINAL
+    if isinstance(value, str):
+        return datetime.date.fromisoformat(value).toordinal() - _EPOCH_ORDINAL
+    if np is not None and isinstance(value, np.datetime64):
+        if np.isnat(value):
+            raise ValueError("dates must not be NaT")
+        return int(value.astype("datetime64[D]").astype(np.int64))
+    return operator.index(value)
+
+
+def _as_c_dates(values: Any, name: str) -> tuple[Any, int]:
+    """Return (cdata, length) for dates as int64 day serials (days since 1970-01-01).
+
+    datetime64 arrays are truncated to days (passed in place when already
+    datetime64[D]); int64 buffers are taken as serials. Sequences of
+    datetime.date, ISO strings, numpy.datetime64 or ints are converted.
+    """
+    if np is not None and isinstance(values, np.ndarray) and values.dtype.kind == "M":
+        if values.ndim != 1:
+            raise ValueError(f"{name} must be one-dimensional")
+        if np.isnat(values).any():
+            raise ValueError(f"{name} must not contain NaT")
+        days = np.ascontiguousarray(values.astype("datetime64[D]", copy=False)).view(np.int64)
+        return ffi.from_buffer("int64_t[]", days), days.shape[0]
+    if _is_buffer(values):
+        return _as_c_array(values, "int64_t", name)
+    serials = [_date_serial(value) for value in values]
+    return ffi.new("int64_t[]", serials), len(serials)
+
+
+def _new_results(n: int) -> tuple[Any, Any]:
+    """Allocate an output array: NumPy when available, else a C array."""
+    if np is not None:
+        out = np.empty(n, dtype=np.float64)
+        return out, ffi.from_buffer("double[]", out, require_writable=True)
+    out = ffi.new("double[]", n)
+    return out, out
+
+
+def _finish_results(out: Any) -> Any:
+    return out if np is not None else list(out)
+
+
+# ============================================================================
+# Threading
+# ============================================================================
+# CFFI releases the GIL around every native call (ABI and API mode), so
+# batch calls from different Python threads already run concurrently as
+# long as each thread uses its own calculator object. threads=N goes one
+# step further and fans a single batch out over the library's native
+# thread pool; threads=0 uses every core.
+
+
+def _check_threads(threads: int) -> int:
+    if threads < 0:
+        raise ValueError("threads must be >= 0 (0 = all cores)")
+    return threads
 
 
 # ============================================================================
@@ -126,23 +279,343 @@ class _BaseCalculator:
 class PresentValueCalculator(_BaseCalculator):
     _destroy_fn = staticmethod(lib.pv_calculator_destroy)
 
-    def __init__(self):
+    _DAY_COUNTS = {
+        "act/365": lib.DAY_COUNT_ACT_365,
+        "act/360": lib.DAY_COUNT_ACT_360,
+        "30/360": lib.DAY_COUNT_30_360,
+    }
+
+    _SENSITIVITIES = ("pv", "dpv_dr", "d2pv_dr2", "dv01", "modified_duration", "convexity")
+
+    def __init__(self, reproducible: bool = False, cache_rates: int = 0):
+        """cache_rates > 0 keeps discount factors for that many distinct rates
+        (least recently used dropped first), so repeated PVs at the same rates
+        become dot products. Not used in reproducible mode; threaded batches
+        build their rates' tables first, so their results match serial ones
+        (more distinct rates than cache_rates: the batch runs on one thread).
+        """
+        if cache_rates < 0:
+            raise ValueError("cache_rates must be >= 0")
         self._handle = lib.pv_calculator_create()
         if self._handle == ffi.NULL:
             raise RuntimeError("Failed to create PV calculator")
+        if reproducible:
+            lib.pv_calculator_set_reproducible(self._handle, 1)
+        if cache_rates:
+            lib.pv_calculator_set_cache(self._handle, cache_rates)
+
+    def cache_stats(self) -> dict[str, int]:
+        """Discount-factor cache counters: hits, misses, evictions, rates, factors."""
+        stats = ffi.new("PVCacheStats*")
+        lib.pv_calculator_get_cache_stats(self._handle, stats)
+        return {
+            "hits": stats.hits,
+            "misses": stats.misses,
+            "evictions": stats.evictions,
+            "rates": stats.rates,
+            "factors": stats.factors,
+        }
+
+    def calculate(self, discount_rate: float, cash_flows: Any) -> float:
+        """PV of one stream; float64 buffers (e.g. NumPy arrays) are not copied.
 
-    def calculate(self, discount_rate: float, cash_flows: list[float]) -> float:
-        if not cash_flows:
+        float32 buffers are also passed in place and priced at mixed
+        precision: stored as float, discounted and summed in double.
+        """
+        mixed = _is_float32_buffer(cash_flows)
+        c_cash_flows, n = _as_c_array(cash_flows, "float" if mixed else "double", "cash_flows")
+        if n == 0:
             raise ValueError("cash_flows must not be empty")
 
-        n = len(cash_flows)
-        c_cash_flows = ffi.new("double[]", cash_flows)
         result = ffi.new("double*")
 
-        ret = lib.pv_calculator_calculate(
+        calculate = lib.pv_calculator_calculate_mixed if mixed else lib.pv_calculator_calculate
+        ret = calculate(self._handle, discount_rate, c_cash_flows, n, result)
+
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.pv_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return result[0]
+
+    def calculate_batch(
+        self, discount_rates: Any, cash_flow_streams: list[Any], threads: int = 1
+    ) -> Any:
+        """PV of many streams in one native call (stream i at discount_rates[i]).
+
+        threads > 1 prices the streams on the native thread pool (0 = all
+        cores); results are identical for every thread count. Returns a
+        NumPy array when NumPy is installed, else a list.
+        """
+        if len(discount_rates) != len(cash_flow_streams):
+            raise ValueError("discount_rates and cash_flow_streams must have the same length")
+
+        offsets = [0]
+        flat: list[float] = []
+        for stream in cash_flow_streams:
+            flat.extend(stream)
+            offsets.append(len(flat))
+
+        return self.calculate_batch_csr(discount_rates, flat, offsets, threads=threads)
+
+    def calculate_batch_csr(
+        self, discount_rates: Any, cash_flows: Any, offsets: Any, threads: int = 1
+    ) -> Any:
+        """PV of many streams given in CSR layout (flat cash_flows + offsets).
+
+        float64 rates/cash flows and size_t (e.g. numpy.uint64) offsets are
+        passed without copying. float32 cash flows are passed in place too and
+        priced at mixed precision (half the memory traffic; see calculate).
+        threads > 1 prices the streams on the native thread pool (0 = all
+        cores). Returns a NumPy array when NumPy is installed, else a list.
+        """
+        _check_threads(threads)
+        mixed = _is_float32_buffer(cash_flows)
+        c_rates, n_streams = _as_c_array(discount_rates, "double", "discount_rates")
+        c_cash_flows, n_cash_flows = _as_c_array(cash_flows, "float" if mixed else "double", "cash_flows")
+        c_offsets, n_offsets = _as_c_array(offsets, "size_t", "offsets")
+        if n_offsets != n_streams + 1:
+            raise ValueError("offsets must have len(discount_rates) + 1 entries")
+        if c_offsets[n_streams] > n_cash_flows:
+            raise ValueError("offsets run past the end of cash_flows")
+
+        out, c_results = _new_results(n_streams)
+        if n_streams == 0:
+            return _finish_results(out)
+
+        if threads == 1:
+            batch = lib.pv_calculator_calculate_batch_mixed if mixed else lib.pv_calculator_calculate_batch
+            ret = batch(self._handle, c_rates, c_cash_flows, c_offsets, n_streams, c_results)
+        else:
+            batch = (lib.pv_calculator_calculate_batch_mixed_parallel if mixed
+                     else lib.pv_calculator_calculate_batch_parallel)
+            ret = batch(self._handle, c_rates, c_cash_flows, c_offsets, n_streams, c_results, threads)
+
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.pv_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return _finish_results(out)
+
+    def calculate_sensitivities(self, discount_rate: float, cash_flows: Any) -> dict[str, float]:
+        """PV, dPV/dr, d²PV/dr², DV01, modified duration and convexity of one
+        stream from a single native pass (the derivatives share the PV's
+        discount factors; no bumped repricing).
+        """
+        c_cash_flows, n = _as_c_array(cash_flows, "double", "cash_flows")
+        if n == 0:
+            raise ValueError("cash_flows must not be empty")
+
+        result = ffi.new("PVSensitivities*")
+        ret = lib.pv_calculator_calculate_sensitivities(
             self._handle, discount_rate, c_cash_flows, n, result
         )
 
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.pv_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return {name: getattr(result, name) for name in self._SENSITIVITIES}
+
+    def calculate_sensitivities_batch_csr(
+        self, discount_rates: Any, cash_flows: Any, offsets: Any, threads: int = 1
+    ) -> dict[str, Any]:
+        """Sensitivities of many streams in CSR layout (as calculate_batch_csr).
+
+        Returns a dict of per-stream columns keyed as calculate_sensitivities()
+        (NumPy arrays when NumPy is installed, else lists).
+        """
+        _check_threads(threads)
+        c_rates, n_streams = _as_c_array(discount_rates, "double", "discount_rates")
+        c_cash_flows, n_cash_flows = _as_c_array(cash_flows, "double", "cash_flows")
+        c_offsets, n_offsets = _as_c_array(offsets, "size_t", "offsets")
+        if n_offsets != n_streams + 1:
+            raise ValueError("offsets must have len(discount_rates) + 1 entries")
+        if c_offsets[n_streams] > n_cash_flows:
+            raise ValueError("offsets run past the end of cash_flows")
+
+        results = ffi.new("PVSensitivities[]", max(n_streams, 1))
+        if n_streams > 0:
+            if threads == 1:
+                ret = lib.pv_calculator_calculate_sensitivities_batch(
+                    self._handle, c_rates, c_cash_flows, c_offsets, n_streams, results
+                )
+            else:
+                ret = lib.pv_calculator_calculate_sensitivities_batch_parallel(
+                    self._handle, c_rates, c_cash_flows, c_offsets, n_streams, results, threads
+                )
+            if ret != 0:
+                error_msg = ffi.string(
+                    lib.pv_calculator_get_error(self._handle)
+                ).decode("utf-8")
+                raise ValueError(error_msg)
+
+        columns = {}
+        for name in self._SENSITIVITIES:
+            out, c_out = _new_results(n_streams)
+            for i in range(n_streams):
+                c_out[i] = getattr(results[i], name)
+            columns[name] = _finish_results(out)
+        return columns
+
+    def calculate_matrix(self, cash_flows: Any, discount_factors: Any) -> Any:
+        """PVs of every stream (row of cash_flows) against every curve (row of
+        discount_factors): result[s][c] = sum_t cash_flows[s][t] * discount_factors[c][t].
+
+        Both are 2-D row-major float64 (a 1-D discount_factors is one curve)
+        with the same number of periods; discount factor t discounts period
+        t + 1. NumPy arrays, including row-padded views, are not copied.
+        Returns an (n_streams, n_curves) NumPy array when NumPy is installed,
+        else a list of lists.
+        """
+        c_cf, n_streams, n_periods, cf_stride = _as_c_matrix(cash_flows, "cash_flows")
+        c_df, n_curves, df_periods, df_stride = _as_c_matrix(discount_factors, "discount_factors")
+        if df_periods != n_periods:
+            raise ValueError("cash_flows and discount_factors must have the same number of periods")
+        if n_periods == 0:
+            raise ValueError("cash_flows must not be empty")
+
+        out, c_results = _new_results(n_streams * n_curves)
+        if n_streams and n_curves:
+            ret = lib.pv_calculator_calculate_matrix(
+                self._handle, c_cf, n_streams, n_periods, cf_stride,
+                c_df, n_curves, df_stride, c_results
+            )
+            if ret != 0:
+                error_msg = ffi.string(
+                    lib.pv_calculator_get_error(self._handle)
+                ).decode("utf-8")
+                raise ValueError(error_msg)
+
+        if np is not None:
+            return out.reshape(n_streams, n_curves)
+        return [list(out[s * n_curves:(s + 1) * n_curves]) for s in range(n_streams)]
+
+    def _day_count(self, day_count: str) -> int:
+        if day_count not in self._DAY_COUNTS:
+            raise ValueError(f"day_count must be one of {sorted(self._DAY_COUNTS)}")
+        return self._DAY_COUNTS[day_count]
+
+    def calculate_xnpv(
+        self, discount_rate: float, dates: Any, cash_flows: Any, day_count: str = "act/365"
+    ) -> float:
+        """XNPV: cash flows on arbitrary dates discounted from the first date,
+        sum of cash_flows[i] / (1 + discount_rate) ** yf(dates[0], dates[i]).
+
+        dates may be a datetime64 array, int64 day serials (days since
+        1970-01-01) or a sequence of datetime.date / ISO strings.
+        day_count: "act/365" (Excel XNPV), "act/360" or "30/360".
+        """
+        code = self._day_count(day_count)
+        c_dates, n_dates = _as_c_dates(dates, "dates")
+        c_cash_flows, n = _as_c_array(cash_flows, "double", "cash_flows")
+        if n == 0:
+            raise ValueError("cash_flows must not be empty")
+        if n_dates != n:
+            raise ValueError("dates and cash_flows must have the same length")
+
+        result = ffi.new("double*")
+        ret = lib.pv_calculator_calculate_xnpv(
+            self._handle, discount_rate, c_dates, c_cash_flows, n, code, result
+        )
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.pv_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return result[0]
+
+    def calculate_xnpv_batch(
+        self, discount_rates: Any, date_streams: list[Any], cash_flow_streams: list[Any],
+        day_count: str = "act/365"
+    ) -> Any:
+        """XNPV of many dated streams (stream i at discount_rates[i], from its
+        own first date) in one native call. Returns a NumPy array when NumPy
+        is installed, else a list.
+        """
+        if not len(discount_rates) == len(date_streams) == len(cash_flow_streams):
+            raise ValueError("discount_rates, date_streams and cash_flow_streams must have the same length")
+
+        offsets = [0]
+        flat_dates: list[int] = []
+        flat_flows: list[float] = []
+        for i, (dates, stream) in enumerate(zip(date_streams, cash_flow_streams)):
+            c_dates, n_dates = _as_c_dates(dates, "dates")
+            stream = list(stream)
+            if n_dates != len(stream):
+                raise ValueError(f"stream {i}: dates and cash_flows must have the same length")
+            flat_dates.extend(c_dates[0:n_dates])
+            flat_flows.extend(stream)
+            offsets.append(len(flat_flows))
+
+        return self.calculate_xnpv_batch_csr(
+            discount_rates, flat_dates, flat_flows, offsets, day_count
+        )
+
+    def calculate_xnpv_batch_csr(
+        self, discount_rates: Any, dates: Any, cash_flows: Any, offsets: Any,
+        day_count: str = "act/365"
+    ) -> Any:
+        """XNPV of many streams in CSR layout (flat dates / cash_flows + offsets).
+
+        datetime64[D] / int64 dates, float64 rates and cash flows and size_t
+        offsets are passed without copying.
+        """
+        code = self._day_count(day_count)
+        c_rates, n_streams = _as_c_array(discount_rates, "double", "discount_rates")
+        c_dates, n_dates = _as_c_dates(dates, "dates")
+        c_cash_flows, n_cash_flows = _as_c_array(cash_flows, "double", "cash_flows")
+        c_offsets, n_offsets = _as_c_array(offsets, "size_t", "offsets")
+        if n_dates != n_cash_flows:
+            raise ValueError("dates and cash_flows must have the same length")
+        if n_offsets != n_streams + 1:
+            raise ValueError("offsets must have len(discount_rates) + 1 entries")
+        if c_offsets[n_streams] > n_cash_flows:
+            raise ValueError("offsets run past the end of cash_flows")
+
+        out, c_results = _new_results(n_streams)
+        if n_streams == 0:
+            return _finish_results(out)
+
+        ret = lib.pv_calculator_calculate_xnpv_batch(
+            self._handle, c_rates, c_dates, c_cash_flows, c_offsets, n_streams, code, c_results
+        )
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.pv_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return _finish_results(out)
+
+    def calculate_runs(self, discount_rate: float, values: Any, counts: Any) -> float:
+        """PV of a run-length encoded stream: values[i] paid in each of
+        counts[i] consecutive periods, run after run.
+
+        Each run is priced by its closed-form annuity, so a 30-year monthly
+        mortgage costs one run, not 360 periods. calculate() does not detect
+        runs in a plain stream, so pass level payments here.
+        """
+        c_values, n_runs = _as_c_array(values, "double", "values")
+        if any(count < 0 for count in counts):
+            raise ValueError("counts must be >= 0")
+        c_counts, n_counts = _as_c_array(counts, "size_t", "counts")
+        if n_runs == 0:
+            raise ValueError("values must not be empty")
+        if n_counts != n_runs:
+            raise ValueError("values and counts must have the same length")
+
+        result = ffi.new("double*")
+        ret = lib.pv_calculator_calculate_runs(
+            self._handle, discount_rate, c_values, c_counts, n_runs, result
+        )
         if ret != 0:
             error_msg = ffi.string(
                 lib.pv_calculator_get_error(self._handle)
@@ -151,6 +624,134 @@ class PresentValueCalculator(_BaseCalculator):
 
         return result[0]
 
+    def calculate_curve(self, curve: "YieldCurve", times: Any, cash_flows: Any) -> float:
+        """PV of dated cash flows on a yield curve: sum of cash_flows[i] * DF(times[i]).
+
+        times are in years (>= 0); time-ordered flows are fastest. float64
+        buffers are not copied.
+        """
+        c_times, n_times = _as_c_array(times, "double", "times")
+        c_cash_flows, n = _as_c_array(cash_flows, "double", "cash_flows")
+        if n == 0:
+            raise ValueError("cash_flows must not be empty")
+        if n_times != n:
+            raise ValueError("times and cash_flows must have the same length")
+
+        result = ffi.new("double*")
+        ret = lib.pv_calculator_calculate_curve(
+            self._handle, curve._handle, c_times, c_cash_flows, n, result
+        )
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.pv_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return result[0]
+
+    def calculate_curve_batch(
+        self, curve: "YieldCurve", times_streams: list[Any], cash_flow_streams: list[Any]
+    ) -> Any:
+        """PVs of many dated streams on one yield curve in a single native call.
+
+        Returns a NumPy array when NumPy is installed, else a list.
+        """
+        if len(times_streams) != len(cash_flow_streams):
+            raise ValueError("times_streams and cash_flow_streams must have the same length")
+
+        offsets = [0]
+        flat_times: list[float] = []
+        flat_flows: list[float] = []
+        for i, (times, stream) in enumerate(zip(times_streams, cash_flow_streams)):
+            times, stream = list(times), list(stream)
+            if len(times) != len(stream):
+                raise ValueError(f"stream {i}: times and cash_flows must have the same length")
+            flat_times.extend(times)
+            flat_flows.extend(stream)
+            offsets.append(len(flat_flows))
+
+        n_streams = len(cash_flow_streams)
+        out, c_results = _new_results(n_streams)
+        if n_streams == 0:
+            return _finish_results(out)
+
+        ret = lib.pv_calculator_calculate_curve_batch(
+            self._handle, curve._handle,
+            ffi.new("double[]", flat_times), ffi.new("double[]", flat_flows),
+            ffi.new("size_t[]", offsets), n_streams, c_results
+        )
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.pv_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return _finish_results(out)
+
+
+class YieldCurve(_BaseCalculator):
+    """Discount curve from pillar times (years) and zero rates or discount factors.
+
+    quote: "zero_rate" (continuously compounded) or "discount_factor".
+    interpolation: "linear" (zero rates), "log_linear" (log discount factors,
+    flat forwards) or "monotone_cubic" (monotone spline on zero rates).
+    The zero rate is flat before the first and after the last pillar.
+    """
+    _destroy_fn = staticmethod(lib.yield_curve_destroy)
+
+    _QUOTES = {
+        "zero_rate": lib.CURVE_QUOTE_ZERO_RATE,
+        "discount_factor": lib.CURVE_QUOTE_DISCOUNT_FACTOR,
+    }
+    _INTERPOLATIONS = {
+        "linear": lib.CURVE_INTERP_LINEAR,
+        "log_linear": lib.CURVE_INTERP_LOG_LINEAR,
+        "monotone_cubic": lib.CURVE_INTERP_MONOTONE_CUBIC,
+    }
+
+    def __init__(self, times: Any, values: Any, quote: str = "zero_rate",
+                 interpolation: str = "linear"):
+        if quote not in self._QUOTES:
+            raise ValueError(f"quote must be one of {sorted(self._QUOTES)}")
+        if interpolation not in self._INTERPOLATIONS:
+            raise ValueError(f"interpolation must be one of {sorted(self._INTERPOLATIONS)}")
+        c_times, n = _as_c_array(times, "double", "times")
+        c_values, n_values = _as_c_array(values, "double", "values")
+        if n_values != n:
+            raise ValueError("times and values must have the same length")
+
+        self._handle = lib.yield_curve_create()
+        if self._handle == ffi.NULL:
+            raise RuntimeError("Failed to create yield curve")
+
+        ret = lib.yield_curve_set_pillars(
+            self._handle, c_times, c_values, n,
+            self._QUOTES[quote], self._INTERPOLATIONS[interpolation]
+        )
+        if ret != 0:
+            error_msg = ffi.string(lib.yield_curve_get_error(self._handle)).decode("utf-8")
+            self.close()
+            raise ValueError(error_msg)
+
+    def discount_factor(self, t: float) -> float:
+        """Discount factor at time t (years, >= 0)."""
+        return self.discount_factors([t])[0]
+
+    def discount_factors(self, times: Any) -> Any:
+        """Discount factors at many times; returns a NumPy array when NumPy is
+        installed, else a list."""
+        c_times, n = _as_c_array(times, "double", "times")
+        out, c_results = _new_results(n)
+        if n == 0:
+            return _finish_results(out)
+
+        ret = lib.yield_curve_discount_factors(self._handle, c_times, n, c_results)
+        if ret != 0:
+            error_msg = ffi.string(lib.yield_curve_get_error(self._handle)).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return _finish_results(out)
+
 
 class FutureValueCalculator(_BaseCalculator):
     _destroy_fn = staticmethod(lib.fv_calculator_destroy)
@@ -175,14 +776,62 @@ class FutureValueCalculator(_BaseCalculator):
 
         return result[0]
 
+    def calculate_batch(
+        self, principals: Any, interest_rates: Any, periods: Any, threads: int = 1
+    ) -> Any:
+        """Vectorized FV over equal-length arrays of principals, rates and periods.
+
+        float64 principals/rates and C int (numpy.intc) periods are passed
+        without copying. threads > 1 uses the native thread pool (0 = all
+        cores). Returns a NumPy array when NumPy is installed, else a list.
+        """
+        _check_threads(threads)
+        c_principals, n = _as_c_array(principals, "double", "principals")
+        c_rates, n_rates = _as_c_array(interest_rates, "double", "interest_rates")
+        c_periods, n_periods = _as_c_array(periods, "int", "periods")
+        if not n == n_rates == n_periods:
+            raise ValueError("principals, interest_rates and periods must have the same length")
+
+        out, c_results = _new_results(n)
+        if n == 0:
+            return _finish_results(out)
+
+        if threads == 1:
+            ret = lib.fv_calculator_calculate_batch(
+                self._handle, c_principals, c_rates, c_periods, n, c_results
+            )
+        else:
+            ret = lib.fv_calculator_calculate_batch_parallel(
+                self._handle, c_principals, c_rates, c_periods, n, c_results, threads
+            )
+
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.fv_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return _finish_results(out)
+
 
 class InterestRateCalculator(_BaseCalculator):
     _destroy_fn = staticmethod(lib.ir_calculator_destroy)
 
-    def __init__(self):
+    def __init__(self, tabulated: bool = False):
+        """tabulated=True reads compounding frequencies 2, 4, 12, 52, 360 and
+        365 from shared EAR tables on a 0.01bp grid: identical results for
+        rates on the grid, last-bit differences between grid points.
+        """
         self._handle = lib.ir_calculator_create()
         if self._handle == ffi.NULL:
             raise RuntimeError("Failed to create IR calculator")
+        if tabulated and lib.ir_calculator_set_tabulated(self._handle, 1) != 0:
+            error_msg = ffi.string(
+                lib.ir_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            lib.ir_calculator_destroy(self._handle)
+            self._handle = ffi.NULL
+            raise MemoryError(error_msg)
 
     def calculate(self, nominal_rate: float, compounding_periods: int) -> float:
         result = ffi.new("double*")
@@ -199,3 +848,288 @@ class InterestRateCalculator(_BaseCalculator):
 
         return result[0]
 
+    def calculate_batch(
+        self, nominal_rates: Any, compounding_periods: Any, threads: int = 1
+    ) -> Any:
+        """Vectorized EAR over equal-length arrays of rates and compounding periods.
+
+        compounding_periods may also be one int shared by every rate (the
+        fastest form, vectorized end to end when tabulated). float64 rates
+        and C int (numpy.intc) periods are passed without copying.
+        threads > 1 uses the native thread pool (0 = all cores).
+        Returns a NumPy array when NumPy is installed, else a list.
+        """
+        _check_threads(threads)
+        c_rates, n = _as_c_array(nominal_rates, "double", "nominal_rates")
+        if isinstance(compounding_periods, int):
+            return self._calculate_batch_uniform(c_rates, n, compounding_periods, threads)
+        c_periods, n_periods = _as_c_array(compounding_periods, "int", "compounding_periods")
+        if n != n_periods:
+            raise ValueError("nominal_rates and compounding_periods must have the same length")
+
+        out, c_results = _new_results(n)
+        if n == 0:
+            return _finish_results(out)
+
+        if threads == 1:
+            ret = lib.ir_calculator_calculate_batch(
+                self._handle, c_rates, c_periods, n, c_results
+            )
+        else:
+            ret = lib.ir_calculator_calculate_batch_parallel(
+                self._handle, c_rates, c_periods, n, c_results, threads
+            )
+
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.ir_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return _finish_results(out)
+
+    def _calculate_batch_uniform(
+        self, c_rates: Any, n: int, compounding_periods: int, threads: int
+    ) -> Any:
+        out, c_results = _new_results(n)
+        if n == 0:
+            return _finish_results(out)
+
+        if threads == 1:
+            ret = lib.ir_calculator_calculate_batch_uniform(
+                self._handle, c_rates, n, compounding_periods, c_results
+            )
+        else:
+            ret = lib.ir_calculator_calculate_batch_uniform_parallel(
+                self._handle, c_rates, n, compounding_periods, c_results, threads
+            )
+
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.ir_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return _finish_results(out)
+
+
+class InternalRateOfReturnCalculator(_BaseCalculator):
+    """Internal rate of return: the rate at which PresentValueCalculator.calculate
+    of a stream is zero, solved natively (Halley steps from a guess, with a
+    bracketed Newton fallback) so no Python code runs per iteration.
+    """
+    _destroy_fn = staticmethod(lib.irr_calculator_destroy)
+
+    def __init__(self, tolerance: float = 1e-12, max_iterations: int = 100):
+        self._handle = lib.irr_calculator_create()
+        if self._handle == ffi.NULL:
+            raise RuntimeError("Failed to create IRR calculator")
+        if lib.irr_calculator_set_tolerance(self._handle, tolerance, max_iterations) != 0:
+            error_msg = ffi.string(lib.irr_calculator_get_error(self._handle)).decode("utf-8")
+            self.close()
+            raise ValueError(error_msg)
+
+    def calculate(self, cash_flows: Any, guess: float = 0.1) -> float:
+        """IRR of one stream (cash flows must change sign); guess warm-starts the solver."""
+        c_cash_flows, n = _as_c_array(cash_flows, "double", "cash_flows")
+        result = ffi.new("double*")
+
+        ret = lib.irr_calculator_calculate(self._handle, c_cash_flows, n, guess, result)
+
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.irr_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return result[0]
+
+    def calculate_batch(
+        self, cash_flow_streams: list[Any], guesses: Any = None, threads: int = 1
+    ) -> Any:
+        """IRRs of many streams in one native call.
+
+        guesses (one per stream, e.g. the previous run's IRRs) warm-start
+        the solver; None starts every stream at 0.1. threads > 1 uses the
+        native thread pool (0 = all cores). Returns a NumPy array when NumPy
+        is installed, else a list.
+        """
+        offsets = [0]
+        flat: list[float] = []
+        for stream in cash_flow_streams:
+            flat.extend(stream)
+            offsets.append(len(flat))
+
+        return self.calculate_batch_csr(flat, offsets, guesses, threads=threads)
+
+    def calculate_batch_csr(
+        self, cash_flows: Any, offsets: Any, guesses: Any = None, threads: int = 1
+    ) -> Any:
+        """IRRs of many streams in CSR layout (flat cash_flows + offsets).
+
+        float64 cash flows / guesses and size_t offsets are passed without
+        copying.
+        """
+        _check_threads(threads)
+        c_cash_flows, n_cash_flows = _as_c_array(cash_flows, "double", "cash_flows")
+        c_offsets, n_offsets = _as_c_array(offsets, "size_t", "offsets")
+        n_streams = n_offsets - 1
+        if n_streams < 0:
+            raise ValueError("offsets must have n_streams + 1 entries")
+        if c_offsets[n_streams] > n_cash_flows:
+            raise ValueError("offsets run past the end of cash_flows")
+        c_guesses = ffi.NULL
+        if guesses is not None:
+            c_guesses, n_guesses = _as_c_array(guesses, "double", "guesses")
+            if n_guesses != n_streams:
+                raise ValueError("guesses must have one entry per stream")
+
+        out, c_results = _new_results(n_streams)
+        if n_streams == 0:
+            return _finish_results(out)
+
+        if threads == 1:
+            ret = lib.irr_calculator_calculate_batch(
+                self._handle, c_cash_flows, c_offsets, n_streams, c_guesses, c_results
+            )
+        else:
+            ret = lib.irr_calculator_calculate_batch_parallel(
+                self._handle, c_cash_flows, c_offsets, n_streams, c_guesses, c_results, threads
+            )
+
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.irr_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+        return _finish_results(out)
+
+
+class BondCalculator(_BaseCalculator):
+    """Fixed-coupon bonds priced from their terms (face, annual coupon rate,
+    coupons remaining, coupons per year) with closed-form annuity sums, so
+    no cash-flow schedule is built. Yields are annual, compounded
+    ``frequency`` times a year.
+    """
+    _destroy_fn = staticmethod(lib.bond_calculator_destroy)
+
+    _ANALYTICS = ("price", "macaulay_duration", "modified_duration", "convexity")
+
+    def __init__(self):
+        self._handle = lib.bond_calculator_create()
+        if self._handle == ffi.NULL:
+            raise RuntimeError("Failed to create bond calculator")
+
+    def _check(self, ret: int) -> None:
+        if ret != 0:
+            error_msg = ffi.string(
+                lib.bond_calculator_get_error(self._handle)
+            ).decode("utf-8")
+            raise ValueError(error_msg)
+
+    def price(self, face: float, coupon_rate: float, periods: int, ytm: float,
+              frequency: int = 1) -> float:
+        """Price at annual yield ``ytm``."""
+        result = ffi.new("double*")
+        self._check(lib.bond_calculator_price(
+            self._handle, face, coupon_rate, periods, frequency, ytm, result
+        ))
+        return result[0]
+
+    def yield_to_maturity(self, face: float, coupon_rate: float, periods: int, price: float,
+                          frequency: int = 1) -> float:
+        """Annual yield at which the bond prices to ``price``."""
+        result = ffi.new("double*")
+        self._check(lib.bond_calculator_yield(
+            self._handle, face, coupon_rate, periods, frequency, price, result
+        ))
+        return result[0]
+
+    def analytics(self, face: float, coupon_rate: float, periods: int, ytm: float,
+                  frequency: int = 1) -> dict[str, float]:
+        """Price, Macaulay / modified duration (years) and convexity (years²)."""
+        result = ffi.new("BondAnalytics*")
+        self._check(lib.bond_calculator_analytics(
+            self._handle, face, coupon_rate, periods, frequency, ytm, result
+        ))
+        return {name: getattr(result, name) for name in self._ANALYTICS}
+
+    def _portfolio(self, faces: Any, coupon_rates: Any, periods: Any, frequencies: Any,
+                   values: Any, values_name: str) -> tuple[Any, ...]:
+        c_faces, n = _as_c_array(faces, "double", "faces")
+        c_coupons, n_coupons = _as_c_array(coupon_rates, "double", "coupon_rates")
+        c_periods, n_periods = _as_c_array(periods, "int", "periods")
+        if isinstance(frequencies, int):
+            frequencies = [frequencies] * n
+        c_frequencies, n_frequencies = _as_c_array(frequencies, "int", "frequencies")
+        c_values, n_values = _as_c_array(values, "double", values_name)
+        if not n == n_coupons == n_periods == n_frequencies == n_values:
+            raise ValueError(
+                f"faces, coupon_rates, periods, frequencies and {values_name} must have the same length"
+            )
+        return n, c_faces, c_coupons, c_periods, c_frequencies, c_values
+
+    def price_batch(self, faces: Any, coupon_rates: Any, periods: Any, ytms: Any,
+                    frequencies: Any = 1, threads: int = 1) -> Any:
+        """Prices of a portfolio, one yield per bond.
+
+        Terms are equal-length arrays (float64 faces / coupon rates / yields,
+        C int periods / frequencies, passed without copying); frequencies
+        may be one int for every bond. threads > 1 uses the native thread
+        pool (0 = all cores). Returns a NumPy array when NumPy is installed,
+        else a list.
+        """
+        _check_threads(threads)
+        n, *terms = self._portfolio(faces, coupon_rates, periods, frequencies, ytms, "ytms")
+        out, c_results = _new_results(n)
+        if n == 0:
+            return _finish_results(out)
+
+        if threads == 1:
+            ret = lib.bond_calculator_price_batch(self._handle, *terms, n, c_results)
+        else:
+            ret = lib.bond_calculator_price_batch_parallel(self._handle, *terms, n, c_results, threads)
+        self._check(ret)
+        return _finish_results(out)
+
+    def yield_batch(self, faces: Any, coupon_rates: Any, periods: Any, prices: Any,
+                    frequencies: Any = 1, threads: int = 1) -> Any:
+        """Yields to maturity of a portfolio, one price per bond (layout as price_batch)."""
+        _check_threads(threads)
+        n, *terms = self._portfolio(faces, coupon_rates, periods, frequencies, prices, "prices")
+        out, c_results = _new_results(n)
+        if n == 0:
+            return _finish_results(out)
+
+        if threads == 1:
+            ret = lib.bond_calculator_yield_batch(self._handle, *terms, n, c_results)
+        else:
+            ret = lib.bond_calculator_yield_batch_parallel(self._handle, *terms, n, c_results, threads)
+        self._check(ret)
+        return _finish_results(out)
+
+    def analytics_batch(self, faces: Any, coupon_rates: Any, periods: Any, ytms: Any,
+                        frequencies: Any = 1, threads: int = 1) -> dict[str, Any]:
+        """Analytics of a portfolio (layout as price_batch).
+
+        Returns a dict of per-bond columns keyed as analytics() (NumPy arrays
+        when NumPy is installed, else lists).
+        """
+        _check_threads(threads)
+        n, *terms = self._portfolio(faces, coupon_rates, periods, frequencies, ytms, "ytms")
+        results = ffi.new("BondAnalytics[]", max(n, 1))
+        if n > 0:
+            if threads == 1:
+                ret = lib.bond_calculator_analytics_batch(self._handle, *terms, n, results)
+            else:
+                ret = lib.bond_calculator_analytics_batch_parallel(self._handle, *terms, n, results, threads)
+            self._check(ret)
+
+        columns = {}
+        for name in self._ANALYTICS:
+            out, c_out = _new_results(n)
+            for i in range(n):
+                c_out[i] = getattr(results[i], name)
+            columns[name] = _finish_results(out)
+        return columns
@@ -3,13 +3,26 @@
 Comprehensive tests for the CFFI-based Calculator bindings
 """
 
+import array
+import datetime
+import threading
 import unittest
 import math
 from calculator import (
+    BondCalculator,
     PresentValueCalculator,
     FutureValueCalculator,
     InterestRateCalculator,
+    InternalRateOfReturnCalculator,
+    YieldCurve,
+    simd_isa,
 )
+from calculator import calculator_cffi
+
+try:
+    import numpy as np
+except ImportError:
+    np = None
 
 
 class TestPresentValueCalculator(unittest.TestCase):
@@ -85,6 +98,257 @@ class TestPresentValueCalculator(unittest.TestCase):
             result = calc.calculate(0.05, [100.0])
             self.assertAlmostEqual(result, 100.0 / 1.05, places=6)
 
+    def test_reproducible_mode(self):
+        """Test reproducible mode agrees with the default SIMD path"""
+        cash_flows = [float(i % 7) - 2.5 for i in range(1000)]
+        with PresentValueCalculator(reproducible=True) as calc:
+            reproducible = calc.calculate(0.01, cash_flows)
+            self.assertEqual(reproducible, calc.calculate(0.01, cash_flows))
+        self.assertAlmostEqual(self.calc.calculate(0.01, cash_flows), reproducible, places=9)
+
+    def test_discount_factor_cache(self):
+        """Test the cache reuses discount factors and matches uncached PVs"""
+        streams = [[100.0] * 360, [50.0] * 12, [75.0] * 120]
+        with PresentValueCalculator(cache_rates=2) as calc:
+            for _ in range(3):
+                for stream in streams:
+                    self.assertAlmostEqual(
+                        calc.calculate(0.004, stream), self.calc.calculate(0.004, stream), places=8
+                    )
+            stats = calc.cache_stats()
+        self.assertEqual(stats["misses"], 1)
+        self.assertEqual(stats["hits"], 8)
+        self.assertEqual(stats["rates"], 1)
+        self.assertEqual(stats["factors"], 360)
+        self.assertEqual(self.calc.cache_stats()["hits"], 0)
+
+    def test_calculate_batch(self):
+        """Test batch PV matches one call per stream"""
+        rates = [0.05, 0.10, 0.0]
+        streams = [[100.0], [50.0, 50.0, 1050.0], [1.0, 2.0, 3.0, 4.0]]
+        results = self.calc.calculate_batch(rates, streams)
+
+        self.assertEqual(len(results), 3)
+        for rate, stream, result in zip(rates, streams, results):
+            self.assertAlmostEqual(result, self.calc.calculate(rate, stream), places=9)
+
+    def test_calculate_batch_csr(self):
+        """Test batch PV with an explicit CSR layout"""
+        results = self.calc.calculate_batch_csr(
+            [0.05, 0.05], [100.0, 100.0, 100.0], [0, 1, 3]
+        )
+        self.assertAlmostEqual(results[0], 100.0 / 1.05, places=6)
+        self.assertAlmostEqual(results[1], 100.0 / 1.05 + 100.0 / 1.05**2, places=6)
+
+    def test_calculate_batch_errors(self):
+        """Test batch PV reports the failing stream"""
+        with self.assertRaisesRegex(ValueError, "stream 1"):
+            self.calc.calculate_batch([0.05, -1.5], [[100.0], [100.0]])
+
+        with self.assertRaisesRegex(ValueError, "stream 0"):
+            self.calc.calculate_batch([0.05], [[]])
+
+        with self.assertRaises(ValueError):
+            self.calc.calculate_batch([0.05, 0.05], [[100.0]])
+
+        self.assertEqual(len(self.calc.calculate_batch([], [])), 0)
+
+    def test_calculate_batch_threads(self):
+        """Test the native thread pool gives the same results as one thread"""
+        rates = [0.001 * (i % 50) for i in range(2000)]
+        streams = [[100.0 + j for j in range(1 + i % 40)] for i in range(2000)]
+        serial = list(self.calc.calculate_batch(rates, streams))
+        self.assertEqual(list(self.calc.calculate_batch(rates, streams, threads=4)), serial)
+        self.assertEqual(list(self.calc.calculate_batch(rates, streams, threads=0)), serial)
+
+        rates[1500] = -2.0
+        with self.assertRaisesRegex(ValueError, "stream 1500"):
+            self.calc.calculate_batch(rates, streams, threads=4)
+
+        with self.assertRaises(ValueError):
+            self.calc.calculate_batch(rates, streams, threads=-1)
+
+    def test_calculate_batch_python_threads(self):
+        """Test concurrent batches from Python threads, one calculator each"""
+        rates = [0.05] * 500
+        streams = [[100.0] * 120] * 500
+        expected = list(self.calc.calculate_batch(rates, streams))
+        results = [None] * 4
+
+        def worker(slot):
+            with PresentValueCalculator() as calc:
+                results[slot] = list(calc.calculate_batch(rates, streams, threads=2))
+
+        threads = [threading.Thread(target=worker, args=(i,)) for i in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual(results, [expected] * 4)
+
+    def test_calculate_matrix(self):
+        """Test matrix PV against one call per stream and flat-rate curve"""
+        rates = [0.01, 0.05, 0.0]
+        n_periods = 37
+        curves = [[1.0 / (1.0 + r) ** (t + 1) for t in range(n_periods)] for r in rates]
+        streams = [[float((s * 7 + t) % 11) - 3.0 for t in range(n_periods)] for s in range(9)]
+
+        results = self.calc.calculate_matrix(streams, curves)
+        self.assertEqual(len(results), 9)
+        for s, stream in enumerate(streams):
+            self.assertEqual(len(results[s]), 3)
+            for c, rate in enumerate(rates):
+                self.assertAlmostEqual(results[s][c], self.calc.calculate(rate, stream), places=9)
+
+        # A flat list is a single curve
+        single = self.calc.calculate_matrix(streams, curves[1])
+        self.assertAlmostEqual(single[4][0], results[4][1], places=12)
+
+    def test_calculate_matrix_errors(self):
+        """Test matrix PV shape validation"""
+        with self.assertRaises(ValueError):
+            self.calc.calculate_matrix([[1.0, 2.0]], [[0.9, 0.8, 0.7]])
+        with self.assertRaises(ValueError):
+            self.calc.calculate_matrix([[1.0, 2.0], [1.0]], [[0.9, 0.8]])
+        with self.assertRaises(ValueError):
+            self.calc.calculate_matrix([[]], [[]])
+
+    def test_calculate_runs(self):
+        """Test run-length PV matches the expanded stream"""
+        values = [-1000.0, 0.0, 120.0, 1120.0]
+        counts = [1, 11, 23, 1]
+        expanded = [v for v, k in zip(values, counts) for _ in range(k)]
+        for rate in (0.0, 0.004, 0.05):
+            self.assertAlmostEqual(
+                self.calc.calculate_runs(rate, values, counts),
+                self.calc.calculate(rate, expanded), places=9
+            )
+        with self.assertRaises(ValueError):
+            self.calc.calculate_runs(0.05, [100.0], [0])
+        with self.assertRaises(ValueError):
+            self.calc.calculate_runs(0.05, [100.0, 5.0], [3])
+        with self.assertRaises(ValueError):
+            self.calc.calculate_runs(-1.0, [100.0], [3])
+
+    def test_calculate_sensitivities(self):
+        """Test one-pass sensitivities against bumped PVs"""
+        cash_flows = [-1000.0, 300.0, 400.0, 500.0, 200.0]
+        rate, h = 0.05, 1e-5
+        risk = self.calc.calculate_sensitivities(rate, cash_flows)
+        up = self.calc.calculate(rate + h, cash_flows)
+        down = self.calc.calculate(rate - h, cash_flows)
+        self.assertAlmostEqual(risk["pv"], self.calc.calculate(rate, cash_flows), places=9)
+        self.assertAlmostEqual(risk["dpv_dr"], (up - down) / (2 * h), places=4)
+        self.assertAlmostEqual(risk["d2pv_dr2"], (up - 2 * risk["pv"] + down) / (h * h), delta=1.0)
+        self.assertAlmostEqual(risk["dv01"], -risk["dpv_dr"] * 1e-4, places=12)
+        with self.assertRaises(ValueError):
+            self.calc.calculate_sensitivities(-1.0, cash_flows)
+        with self.assertRaises(ValueError):
+            self.calc.calculate_sensitivities(0.05, [])
+
+    def test_calculate_sensitivities_batch_csr(self):
+        """Test batch sensitivities match single calls for any thread count"""
+        rates = [0.05, 0.03, 0.08]
+        cash_flows = [100.0, 200.0, 300.0, 50.0, 50.0, 1050.0]
+        offsets = [0, 3, 3 + 2, 6]
+        for threads in (1, 0):
+            columns = self.calc.calculate_sensitivities_batch_csr(
+                rates, cash_flows, offsets, threads=threads
+            )
+            for i, rate in enumerate(rates):
+                single = self.calc.calculate_sensitivities(
+                    rate, cash_flows[offsets[i]:offsets[i + 1]]
+                )
+                for name, value in single.items():
+                    self.assertEqual(columns[name][i], value)
+        with self.assertRaises(ValueError):
+            self.calc.calculate_sensitivities_batch_csr([0.05, -2.0], [1.0, 2.0], [0, 1, 2])
+
+    @unittest.skipUnless(np is not None, "NumPy not installed")
+    def test_calculate_matrix_numpy_padded(self):
+        """Test matrix PV reads row-padded NumPy views in place"""
+        padded = np.full((5, 16), np.nan)
+        padded[:, :13] = np.arange(65, dtype=np.float64).reshape(5, 13)
+        curve = np.array([1.0 / 1.02 ** (t + 1) for t in range(13)])
+
+        results = self.calc.calculate_matrix(padded[:, :13], curve)
+        self.assertEqual(results.shape, (5, 1))
+        for s in range(5):
+            self.assertAlmostEqual(
+                results[s, 0], self.calc.calculate(0.02, padded[s, :13].copy()), places=9
+            )
+
+    def test_buffer_protocol_input(self):
+        """Test float64 buffers are accepted without conversion"""
+        cash_flows = array.array("d", [100.0, 200.0, 300.0])
+        expected = self.calc.calculate(0.05, [100.0, 200.0, 300.0])
+        self.assertAlmostEqual(self.calc.calculate(0.05, cash_flows), expected, places=12)
+        self.assertAlmostEqual(
+            self.calc.calculate(0.05, memoryview(cash_flows)), expected, places=12
+        )
+
+    def test_buffer_validation(self):
+        """Test wrong-typed or empty buffers are rejected"""
+        with self.assertRaises(TypeError):
+            self.calc.calculate_batch_csr(array.array("f", [0.05]), [100.0], [0, 1])
+
+        with self.assertRaises(TypeError):
+            self.calc.calculate(0.05, array.array("i", [100]))
+
+        with self.assertRaises(ValueError):
+            self.calc.calculate(0.05, array.array("d"))
+
+    def test_calculate_batch_csr_buffers(self):
+        """Test CSR batch with buffer inputs and offset bounds checking"""
+        rates = array.array("d", [0.05, 0.05])
+        cash_flows = array.array("d", [100.0, 100.0, 100.0])
+        offsets = array.array("L" if array.array("L").itemsize == 8 else "Q", [0, 1, 3])
+        results = self.calc.calculate_batch_csr(rates, cash_flows, offsets)
+        self.assertAlmostEqual(results[0], 100.0 / 1.05, places=6)
+
+        with self.assertRaises(ValueError):
+            self.calc.calculate_batch_csr([0.05], [100.0], [0, 2])
+
+    def test_float32_buffers_use_mixed_precision(self):
+        """Test float32 cash flows are priced in double, as if widened"""
+        flows = [100.25, -40.5, 300.0, 12.125]
+        rates = array.array("d", [0.05, 0.02])
+        offsets = array.array("L" if array.array("L").itemsize == 8 else "Q", [0, 1, 4])
+        expected = self.calc.calculate_batch_csr(rates, array.array("d", flows), offsets)
+        mixed = self.calc.calculate_batch_csr(rates, array.array("f", flows), offsets, threads=2)
+        self.assertEqual(list(mixed), list(expected))
+        self.assertEqual(self.calc.calculate(0.05, array.array("f", flows)), self.calc.calculate(0.05, flows))
+
+        with self.assertRaises(ValueError):
+            self.calc.calculate(-1.0, array.array("f", flows))
+
+    @unittest.skipUnless(np is not None, "NumPy not installed")
+    def test_numpy_input(self):
+        """Test NumPy arrays: zero-copy float64, rejected non-contiguous/wrong dtype"""
+        cash_flows = np.array([100.0, 200.0, 300.0, 400.0])
+        expected = self.calc.calculate(0.05, cash_flows.tolist())
+        self.assertAlmostEqual(self.calc.calculate(0.05, cash_flows), expected, places=12)
+
+        with self.assertRaises(ValueError):
+            self.calc.calculate(0.05, cash_flows[::2])
+
+        with self.assertRaises(TypeError):
+            self.calc.calculate(0.05, cash_flows.astype(np.float16))
+
+        results = self.calc.calculate_batch_csr(
+            np.array([0.05, 0.10]), cash_flows, np.array([0, 1, 4], dtype=np.uintp)
+        )
+        self.assertIsInstance(results, np.ndarray)
+        self.assertAlmostEqual(results[0], 100.0 / 1.05, places=9)
+
+    def test_cffi_backend(self):
+        """Test the active CFFI mode is reported"""
+        self.assertIn(calculator_cffi.BACKEND, ("api", "abi"))
+
+    def test_simd_isa(self):
+        """Test the selected SIMD path is reported"""
+        self.assertIn(simd_isa(), ("scalar", "sse2", "avx2", "avx512"))
+
 
 class TestFutureValueCalculator(unittest.TestCase):
     """Tests for Future Value Calculator"""
@@ -147,6 +411,61 @@ class TestFutureValueCalculator(unittest.TestCase):
         expected = 1.0 * (1.01 ** 100)
         self.assertAlmostEqual(result, expected, places=6)
     
+    def test_calculate_batch(self):
+        """Test vectorized FV matches scalar calls"""
+        principals = [1000.0, 5000.0, 100.0]
+        rates = [0.05, 0.0325, 1.0]
+        periods = [10, 8, 5]
+        results = self.calc.calculate_batch(principals, rates, periods)
+
+        for p, r, n, result in zip(principals, rates, periods, results):
+            self.assertAlmostEqual(result, self.calc.calculate(p, r, n), places=9)
+
+    def test_calculate_batch_threads(self):
+        """Test threaded FV matches serial and reports the lowest bad index"""
+        principals = [1000.0 + i for i in range(3000)]
+        rates = [0.0001 * i for i in range(3000)]
+        periods = [i % 30 for i in range(3000)]
+        serial = list(self.calc.calculate_batch(principals, rates, periods))
+        self.assertEqual(
+            list(self.calc.calculate_batch(principals, rates, periods, threads=4)), serial
+        )
+
+        principals[2900] = -1.0
+        principals[700] = -1.0
+        with self.assertRaisesRegex(ValueError, "element 700"):
+            self.calc.calculate_batch(principals, rates, periods, threads=4)
+
+    def test_calculate_batch_buffers(self):
+        """Test vectorized FV with float64/int buffers"""
+        results = self.calc.calculate_batch(
+            array.array("d", [1000.0, 1000.0]),
+            array.array("d", [0.05, 0.10]),
+            array.array("i", [10, 7]),
+        )
+        self.assertAlmostEqual(results[0], 1000.0 * 1.05**10, places=6)
+        self.assertAlmostEqual(results[1], 1000.0 * 1.10**7, places=6)
+
+    def test_calculate_batch_errors(self):
+        """Test vectorized FV validation"""
+        with self.assertRaisesRegex(ValueError, "element 1"):
+            self.calc.calculate_batch([1000.0, -1.0], [0.05, 0.05], [10, 10])
+
+        with self.assertRaises(ValueError):
+            self.calc.calculate_batch([1000.0], [0.05, 0.05], [10])
+
+        with self.assertRaises(TypeError):
+            self.calc.calculate_batch([1000.0], [0.05], array.array("q", [10]))
+
+    @unittest.skipUnless(np is not None, "NumPy not installed")
+    def test_calculate_batch_numpy(self):
+        """Test vectorized FV returns a NumPy array"""
+        results = self.calc.calculate_batch(
+            np.full(4, 1000.0), np.linspace(0.01, 0.04, 4), np.arange(4, dtype=np.intc)
+        )
+        self.assertIsInstance(results, np.ndarray)
+        self.assertAlmostEqual(results[3], 1000.0 * 1.04**3, places=6)
+
     def test_context_manager(self):
         """Test calculator works as context manager"""
         with FutureValueCalculator() as calc:
@@ -221,6 +540,57 @@ class TestInterestRateCalculator(unittest.TestCase):
         expected = (1.0 + 0.10/2) ** 2 - 1.0
         self.assertAlmostEqual(result, expected, places=6)
     
+    def test_calculate_batch(self):
+        """Test vectorized EAR matches scalar calls"""
+        rates = [0.05, 0.12, 0.06]
+        periods = [1, 12, 365]
+        results = self.calc.calculate_batch(rates, periods)
+
+        for r, n, result in zip(rates, periods, results):
+            self.assertAlmostEqual(result, self.calc.calculate(r, n), places=12)
+
+    def test_calculate_batch_threads(self):
+        """Test threaded EAR matches serial"""
+        rates = [0.0001 * i for i in range(3000)]
+        periods = [1 + i % 365 for i in range(3000)]
+        serial = list(self.calc.calculate_batch(rates, periods))
+        self.assertEqual(list(self.calc.calculate_batch(rates, periods, threads=0)), serial)
+
+    def test_calculate_batch_errors(self):
+        """Test vectorized EAR validation"""
+        with self.assertRaisesRegex(ValueError, "element 0"):
+            self.calc.calculate_batch([0.05], [0])
+
+        with self.assertRaises(ValueError):
+            self.calc.calculate_batch([0.05, 0.06], [12])
+
+    def test_calculate_batch_one_frequency(self):
+        """Test one compounding frequency for every rate, exact and tabulated"""
+        rates = [0.04 + 0.000001 * i for i in range(3000)]
+        expected = [self.calc.calculate(r, 365) for r in rates]
+        self.assertEqual(list(self.calc.calculate_batch(rates, 365)), expected)
+        self.assertEqual(list(self.calc.calculate_batch(rates, 365, threads=0)), expected)
+
+        tabulated = InterestRateCalculator(tabulated=True)
+        self.assertEqual(tabulated.calculate(0.0523, 12), self.calc.calculate(0.0523, 12))
+        for result, exact in zip(tabulated.calculate_batch(rates, 365), expected):
+            self.assertAlmostEqual(result, exact, places=14)
+
+        with self.assertRaisesRegex(ValueError, "element 1"):
+            tabulated.calculate_batch([0.05, -1.0], 12)
+        with self.assertRaisesRegex(ValueError, "compounding_periods"):
+            tabulated.calculate_batch([0.05], 0)
+        tabulated.close()
+
+    @unittest.skipUnless(np is not None, "NumPy not installed")
+    def test_calculate_batch_numpy(self):
+        """Test vectorized EAR with NumPy arrays"""
+        results = self.calc.calculate_batch(
+            np.array([0.12, 0.06]), np.array([12, 4], dtype=np.intc)
+        )
+        self.assertIsInstance(results, np.ndarray)
+        self.assertAlmostEqual(results[0], (1.0 + 0.12 / 12) ** 12 - 1.0, places=12)
+
     def test_context_manager(self):
         """Test calculator works as context manager"""
         with InterestRateCalculator() as calc:
@@ -229,6 +599,273 @@ class TestInterestRateCalculator(unittest.TestCase):
             self.assertAlmostEqual(result, expected, places=6)
 
 
+class TestInternalRateOfReturnCalculator(unittest.TestCase):
+    """Tests for the native IRR solver"""
+
+    def setUp(self):
+        self.calc = InternalRateOfReturnCalculator()
+
+    def tearDown(self):
+        self.calc.close()
+
+    def test_known_rates(self):
+        """Test simple and Excel-documented IRRs"""
+        self.assertAlmostEqual(self.calc.calculate([-100, 110]), 0.1, places=14)
+        self.assertAlmostEqual(
+            self.calc.calculate([-70000, 12000, 15000, 18000, 21000, 26000]), 0.086630948036531, places=12
+        )
+
+    def test_zero_present_value(self):
+        """Test the IRR zeroes the PV calculator's result"""
+        stream = [-1000.0, 300.0, 400.0, 500.0, -50.0, 200.0]
+        irr = self.calc.calculate(stream)
+        with PresentValueCalculator() as pv:
+            self.assertAlmostEqual(pv.calculate(irr, stream), 0.0, places=9)
+
+    def test_guess_selects_root(self):
+        """Test the guess picks between multiple IRRs"""
+        self.assertAlmostEqual(self.calc.calculate([100, -230, 132], guess=0.05), 0.1, places=12)
+        self.assertAlmostEqual(self.calc.calculate([100, -230, 132], guess=0.3), 0.2, places=12)
+
+    def test_calculate_batch(self):
+        """Test batch IRRs with and without guesses and threads"""
+        streams = [[-100, 110], [-1000, 300, 400, 500], [100, -230, 132]] * 100
+        expected = [self.calc.calculate(s) for s in streams]
+        self.assertEqual(list(self.calc.calculate_batch(streams)), expected)
+        self.assertEqual(list(self.calc.calculate_batch(streams, threads=4)), expected)
+
+        warm = self.calc.calculate_batch(streams, guesses=[0.3] * len(streams))
+        self.assertAlmostEqual(warm[2], 0.2, places=12)
+
+    def test_errors(self):
+        """Test invalid streams, guesses and options"""
+        with self.assertRaises(ValueError):
+            self.calc.calculate([])
+        with self.assertRaises(ValueError):
+            self.calc.calculate([1.0, 2.0])
+        with self.assertRaises(ValueError):
+            self.calc.calculate([-1.0, 2.0], guess=-1.5)
+        with self.assertRaises(ValueError):
+            self.calc.calculate([1.0, -1.0, 1.0])
+        with self.assertRaisesRegex(ValueError, "stream 1"):
+            self.calc.calculate_batch([[-1.0, 2.0], [1.0, 2.0]])
+        with self.assertRaises(ValueError):
+            self.calc.calculate_batch([[-1.0, 2.0]], guesses=[0.1, 0.2])
+        with self.assertRaises(ValueError):
+            InternalRateOfReturnCalculator(tolerance=0.0)
+
+
+class TestBondCalculator(unittest.TestCase):
+    """Tests for closed-form bond pricing, yield and risk"""
+
+    def setUp(self):
+        self.calc = BondCalculator()
+
+    def tearDown(self):
+        self.calc.close()
+
+    def test_price_matches_schedule_pv(self):
+        """Test the price equals the PV of the materialized schedule"""
+        schedule = [50.0] * 9 + [1050.0]
+        with PresentValueCalculator() as pv:
+            expected = pv.calculate(0.04, schedule)
+        self.assertAlmostEqual(self.calc.price(1000, 0.05, 10, 0.04), expected, places=9)
+        self.assertAlmostEqual(self.calc.price(100, 0.06, 30, 0.06, frequency=2), 100.0, places=10)
+
+    def test_yield_round_trip(self):
+        """Test yield_to_maturity inverts price"""
+        price = self.calc.price(100, 0.0425, 20, 0.051, frequency=2)
+        self.assertAlmostEqual(self.calc.yield_to_maturity(100, 0.0425, 20, price, frequency=2), 0.051, places=12)
+
+    def test_analytics(self):
+        """Test durations and convexity against finite differences"""
+        a = self.calc.analytics(100, 0.045, 40, 0.052, frequency=2)
+        h = 1e-5
+        up = self.calc.price(100, 0.045, 40, 0.052 + h, frequency=2)
+        down = self.calc.price(100, 0.045, 40, 0.052 - h, frequency=2)
+        self.assertAlmostEqual(a["modified_duration"], -(up - down) / (2 * h * a["price"]), places=6)
+        self.assertAlmostEqual(a["modified_duration"], a["macaulay_duration"] / 1.026, places=12)
+        self.assertAlmostEqual(a["convexity"], (up - 2 * a["price"] + down) / (h * h * a["price"]), places=2)
+        zero = self.calc.analytics(100, 0.0, 12, 0.03, frequency=4)
+        self.assertAlmostEqual(zero["macaulay_duration"], 3.0, places=12)
+
+    def test_batches(self):
+        """Test portfolio batches against single calls, with threads"""
+        faces = [1000.0, 100.0, 100.0, 250.0] * 50
+        coupons = [0.05, 0.0425, 0.0, 0.07] * 50
+        periods = [10, 20, 12, 360] * 50
+        frequencies = [1, 2, 4, 12] * 50
+        ytms = [0.04, 0.05, 0.03, 0.065] * 50
+        expected = [self.calc.price(*terms) for terms in zip(faces, coupons, periods, ytms, frequencies)]
+        prices = self.calc.price_batch(faces, coupons, periods, ytms, frequencies)
+        self.assertEqual(list(prices), expected)
+        self.assertEqual(list(self.calc.price_batch(faces, coupons, periods, ytms, frequencies, threads=4)),
+                         expected)
+
+        back = self.calc.yield_batch(faces, coupons, periods, list(prices), frequencies, threads=0)
+        for got, want in zip(back, ytms):
+            self.assertAlmostEqual(got, want, places=12)
+
+        columns = self.calc.analytics_batch(faces, coupons, periods, ytms, frequencies)
+        self.assertEqual(set(columns), {"price", "macaulay_duration", "modified_duration", "convexity"})
+        self.assertEqual(columns["convexity"][1], self.calc.analytics(100, 0.0425, 20, 0.05, 2)["convexity"])
+
+        # One frequency for the whole portfolio
+        annual = self.calc.price_batch([100.0, 100.0], [0.05, 0.06], [10, 5], [0.04, 0.04], frequencies=1)
+        self.assertEqual(annual[1], self.calc.price(100, 0.06, 5, 0.04))
+
+    def test_errors(self):
+        """Test invalid terms, prices and shapes"""
+        with self.assertRaisesRegex(ValueError, "periods must be >= 1"):
+            self.calc.price(100, 0.05, 0, 0.04)
+        with self.assertRaisesRegex(ValueError, "price must be > 0"):
+            self.calc.yield_to_maturity(100, 0.05, 10, -1.0)
+        with self.assertRaisesRegex(ValueError, "bond 1: frequency must be >= 1"):
+            self.calc.price_batch([100.0, 100.0], [0.05, 0.05], [10, 10], [0.04, 0.04], frequencies=[1, 0])
+        with self.assertRaises(ValueError):
+            self.calc.price_batch([100.0], [0.05, 0.05], [10], [0.04])
+
+
+class TestXnpv(unittest.TestCase):
+    """Tests for dated cash flows (XNPV) and day-count conventions"""
+
+    DATES = ["2008-01-01", "2008-03-01", "2008-10-30", "2009-02-15", "2009-04-01"]
+    FLOWS = [-10000.0, 2750.0, 4250.0, 3250.0, 2750.0]
+
+    def setUp(self):
+        self.calc = PresentValueCalculator()
+
+    def tearDown(self):
+        self.calc.close()
+
+    def test_matches_excel(self):
+        """Test ACT/365 XNPV reproduces Excel's XNPV example"""
+        self.assertAlmostEqual(self.calc.calculate_xnpv(0.09, self.DATES, self.FLOWS), 2086.647602, places=6)
+
+    def test_date_inputs(self):
+        """Test datetime.date, ISO strings and int serials give the same result"""
+        as_dates = [datetime.date.fromisoformat(d) for d in self.DATES]
+        as_serials = [(d - datetime.date(1970, 1, 1)).days for d in as_dates]
+        expected = self.calc.calculate_xnpv(0.09, self.DATES, self.FLOWS, day_count="30/360")
+        self.assertEqual(self.calc.calculate_xnpv(0.09, as_dates, self.FLOWS, day_count="30/360"), expected)
+        self.assertEqual(self.calc.calculate_xnpv(0.09, as_serials, self.FLOWS, day_count="30/360"), expected)
+        self.assertEqual(
+            self.calc.calculate_xnpv(0.09, array.array("q", as_serials), self.FLOWS, day_count="30/360"),
+            expected,
+        )
+
+    def test_day_counts(self):
+        """Test one year of 30/360 and ACT/360 against the annual rate"""
+        # 2023-01-15 -> 2024-01-15 is 360 days under 30/360 and 365 actual days
+        dates = ["2023-01-15", "2024-01-15"]
+        self.assertAlmostEqual(self.calc.calculate_xnpv(0.1, dates, [0.0, 110.0], "30/360"), 100.0, places=12)
+        self.assertAlmostEqual(self.calc.calculate_xnpv(0.1, dates, [0.0, 110.0], "act/365"), 100.0, places=12)
+        self.assertAlmostEqual(
+            self.calc.calculate_xnpv(0.1, dates, [0.0, 110.0], "act/360"), 110.0 / 1.1 ** (365 / 360), places=12
+        )
+
+    def test_batch(self):
+        """Test the batch form against single calls"""
+        streams = [self.FLOWS, self.FLOWS[:3]]
+        dates = [self.DATES, self.DATES[:3]]
+        results = self.calc.calculate_xnpv_batch([0.09, 0.04], dates, streams, day_count="act/360")
+        self.assertEqual(len(results), 2)
+        self.assertEqual(results[0], self.calc.calculate_xnpv(0.09, self.DATES, self.FLOWS, "act/360"))
+        self.assertEqual(results[1], self.calc.calculate_xnpv(0.04, self.DATES[:3], self.FLOWS[:3], "act/360"))
+
+    def test_errors(self):
+        """Test invalid day counts, lengths and rates"""
+        with self.assertRaises(ValueError):
+            self.calc.calculate_xnpv(0.05, self.DATES, self.FLOWS, day_count="act/act")
+        with self.assertRaises(ValueError):
+            self.calc.calculate_xnpv(0.05, self.DATES[:2], self.FLOWS)
+        with self.assertRaises(ValueError):
+            self.calc.calculate_xnpv(-1.0, self.DATES, self.FLOWS)
+        with self.assertRaises(TypeError):
+            self.calc.calculate_xnpv(0.05, array.array("d", [0.0] * 5), self.FLOWS)
+        with self.assertRaisesRegex(ValueError, "stream 1"):
+            self.calc.calculate_xnpv_batch([0.05, -2.0], [self.DATES] * 2, [self.FLOWS] * 2)
+
+    @unittest.skipUnless(np is not None, "NumPy not installed")
+    def test_numpy_datetime64(self):
+        """Test datetime64 arrays of any unit are read as day serials"""
+        days = np.array(self.DATES, dtype="datetime64[D]")
+        expected = self.calc.calculate_xnpv(0.09, self.DATES, self.FLOWS)
+        self.assertEqual(self.calc.calculate_xnpv(0.09, days, np.array(self.FLOWS)), expected)
+        self.assertEqual(self.calc.calculate_xnpv(0.09, days.astype("datetime64[s]"), self.FLOWS), expected)
+        self.assertEqual(self.calc.calculate_xnpv(0.09, days.view(np.int64), self.FLOWS), expected)
+
+        results = self.calc.calculate_xnpv_batch_csr(
+            np.array([0.09]), days, np.array(self.FLOWS), np.array([0, 5], dtype=np.uint64)
+        )
+        self.assertEqual(results[0], expected)
+        with self.assertRaises(ValueError):
+            self.calc.calculate_xnpv(0.09, np.array(["NaT"] * 5, dtype="datetime64[D]"), self.FLOWS)
+
+
+class TestYieldCurve(unittest.TestCase):
+    """Tests for YieldCurve and curve-based present values"""
+
+    TIMES = [0.5, 1.0, 2.0, 5.0, 10.0]
+    RATES = [0.030, 0.032, 0.035, 0.040, 0.042]
+
+    def setUp(self):
+        self.calc = PresentValueCalculator()
+
+    def tearDown(self):
+        self.calc.close()
+
+    def test_pillars_and_interpolation(self):
+        """Test every interpolation reproduces the pillars"""
+        for interpolation in ("linear", "log_linear", "monotone_cubic"):
+            with YieldCurve(self.TIMES, self.RATES, interpolation=interpolation) as curve:
+                dfs = curve.discount_factors(self.TIMES)
+                for t, r, df in zip(self.TIMES, self.RATES, dfs):
+                    self.assertAlmostEqual(df, math.exp(-r * t), places=14)
+                self.assertEqual(curve.discount_factor(0.0), 1.0)
+
+        linear = YieldCurve(self.TIMES, self.RATES)
+        self.assertAlmostEqual(linear.discount_factor(1.5), math.exp(-0.0335 * 1.5), places=14)
+
+    def test_discount_factor_quotes(self):
+        """Test discount-factor pillars match the equivalent zero rates"""
+        dfs = [math.exp(-r * t) for t, r in zip(self.TIMES, self.RATES)]
+        from_dfs = YieldCurve(self.TIMES, dfs, quote="discount_factor", interpolation="log_linear")
+        from_rates = YieldCurve(self.TIMES, self.RATES, interpolation="log_linear")
+        self.assertAlmostEqual(from_dfs.discount_factor(3.3), from_rates.discount_factor(3.3), places=14)
+
+    def test_calculate_curve(self):
+        """Test curve PV and its batch form"""
+        curve = YieldCurve(self.TIMES, self.RATES, interpolation="monotone_cubic")
+        times = [0.5 * i for i in range(1, 11)]
+        flows = [2.0] * 9 + [102.0]
+
+        expected = sum(cf * df for cf, df in zip(flows, curve.discount_factors(times)))
+        self.assertAlmostEqual(self.calc.calculate_curve(curve, times, flows), expected, places=10)
+
+        results = self.calc.calculate_curve_batch(curve, [times, times[:4]], [flows, flows[:4]])
+        self.assertEqual(len(results), 2)
+        self.assertEqual(results[0], self.calc.calculate_curve(curve, times, flows))
+        self.assertEqual(results[1], self.calc.calculate_curve(curve, times[:4], flows[:4]))
+
+    def test_errors(self):
+        """Test invalid pillars and dated flows are reported"""
+        with self.assertRaises(ValueError):
+            YieldCurve([2.0, 1.0], [0.01, 0.02])
+        with self.assertRaises(ValueError):
+            YieldCurve([1.0], [0.01], interpolation="spline")
+        with self.assertRaises(ValueError):
+            YieldCurve([1.0], [0.0], quote="discount_factor")
+
+        curve = YieldCurve(self.TIMES, self.RATES)
+        with self.assertRaises(ValueError):
+            self.calc.calculate_curve(curve, [], [])
+        with self.assertRaises(ValueError):
+            self.calc.calculate_curve(curve, [1.0, 2.0], [1.0])
+        with self.assertRaisesRegex(ValueError, "stream 1"):
+            self.calc.calculate_curve_batch(curve, [[1.0], [-1.0]], [[1.0], [1.0]])
+
+
 class TestCalculatorIntegration(unittest.TestCase):
     """Integration tests combining multiple calculators"""
     
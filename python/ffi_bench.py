@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+"""
+Per-call latency of fv_calculator_calculate through CFFI ABI vs. API mode
+
+ABI mode dlopens the shared library and routes every call through libffi;
+API mode calls the C function directly from the compiled _calculator
+extension (build it with python/calculator/_calculator_build.py).
+"""
+
+import sys
+import timeit
+
+from calculator.calculator_cffi import load_abi_backend, load_api_backend
+
+CALLS = 200_000
+REPEATS = 5
+
+
+def bench(label, ffi, lib):
+    calc = lib.fv_calculator_create()
+    result = ffi.new("double*")
+    fn = lib.fv_calculator_calculate
+
+    def run():
+        for _ in range(CALLS):
+            fn(calc, 1000.0, 0.05, 10, result)
+
+    best = min(timeit.repeat(run, number=1, repeat=REPEATS))
+    lib.fv_calculator_destroy(calc)
+
+    ns_per_call = best / CALLS * 1e9
+    print(f"  {label:4s}: {ns_per_call:8.1f} ns/call")
+    return ns_per_call
+
+
+def main():
+    print("=" * 70)
+    print(f"fv_calculator_calculate latency (best of {REPEATS} x {CALLS:,} calls)")
+    print("=" * 70)
+
+    abi_ns = bench("ABI", *load_abi_backend())
+
+    try:
+        api = load_api_backend()
+    except ImportError:
+        print("  API : extension not built (run python/calculator/_calculator_build.py)")
+        return 0
+
+    api_ns = bench("API", *api)
+    print(f"  API mode speedup: {abi_ns / api_ns:.2f}x")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -2,6 +2,7 @@
 #include <vector>
 #include <iomanip>
 
+#include "BondPricing.hpp"
 #include "Calculator.hpp"
 #include "CalculationPolicies.hpp"
 
@@ -58,19 +59,24 @@ int main() {
         return 1;
     }
 
-    // Example 2: Bond-like cash flows
-    std::vector<double> bond_cash_flows;
-    for (int i = 0; i < 10; ++i) {
-        bond_cash_flows.push_back(50.0);  // 10 coupon payments
-    }
-    bond_cash_flows.push_back(1050.0);  // Final payment with principal
+    // Example 2: Bond priced from its terms (no cash-flow vector)
+    Calculator<BondPricingPolicy> bond_calc;
+    const BondTerms bond{1000.0, 0.05, 10, 1};  // 10 annual 5% coupons, $1000 face
 
     try {
-        double pv_bond = pv_calc.calculate(0.04, bond_cash_flows);
-        std::cout << "\nBond valuation (4% discount, 10 periods):\n";
-        std::cout << "  Coupon payments: 10 × $50\n";
-        std::cout << "  Final payment: $1050 (including principal)\n";
+        double pv_bond = bond_calc.calculate(bond, 0.04);
+        BondPricingPolicy::Analytics risk = BondPricingPolicy::analytics(bond, 0.04);
+        double ytm = BondPricingPolicy::yield_to_maturity(bond, pv_bond);
+
+        std::cout << "\nBond valuation (4% yield, 10 annual periods):\n";
+        std::cout << "  Coupon payments: 10 × $50, face $1000 with the last\n";
         std::cout << "  Present Value: $" << pv_bond << "\n";
+        std::cout << "  Yield to maturity at that price: " << (ytm * 100) << "%\n";
+        std::cout << std::setprecision(4);
+        std::cout << "  Macaulay duration: " << risk.macaulay_duration << " years\n";
+        std::cout << "  Modified duration: " << risk.modified_duration << " years\n";
+        std::cout << "  Convexity: " << risk.convexity << "\n";
+        std::cout << std::setprecision(2);  // Reset precision
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << "\n";
         return 1;